@@ -0,0 +1,329 @@
+#if CONFIG_MODEL_OTA
+
+#include "ble_model_ota.h"
+#include "model_ota_protocol.h"
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+
+#include <neuton/nn/neuton_nn_model_blob.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Control characteristic value attribute index in the service */
+#define CONTROL_ATTR_INDEX (2)
+
+/* Kconfig option depends on the partitions, this check catches a flash layout without them */
+#if !FIXED_PARTITION_EXISTS(model_slot_a) || !FIXED_PARTITION_EXISTS(model_slot_b)
+#error "CONFIG_MODEL_OTA requires model_slot_a and model_slot_b flash partitions"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int slot_erase_(uint8_t slot, uint32_t size);
+static void erase_work_handler_(struct k_work* p_work);
+static int slot_write_(uint8_t slot, uint32_t offset, const void* p_data, uint32_t len);
+static const void* slot_map_(uint8_t slot);
+static int notify_(const uint8_t* p_data, uint16_t len, void* p_ctx);
+static bool verify_(const void* p_image, uint32_t size, void* p_ctx);
+static uint32_t uptime_ms_(void);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static struct bt_uuid_128 service_uuid_ = BT_UUID_INIT_128(BLE_MODEL_OTA_UUID_SERVICE_VAL);
+static struct bt_uuid_128 control_uuid_ = BT_UUID_INIT_128(BLE_MODEL_OTA_UUID_CONTROL_VAL);
+static struct bt_uuid_128 data_uuid_ = BT_UUID_INIT_128(BLE_MODEL_OTA_UUID_DATA_VAL);
+
+static const struct flash_area* slots_[MODEL_OTA_SLOTS_NUM];
+static const uint8_t SLOT_IDS[MODEL_OTA_SLOTS_NUM] = {
+    FIXED_PARTITION_ID(model_slot_a),
+    FIXED_PARTITION_ID(model_slot_b),
+};
+
+static model_ota_storage_t storage_ = {
+    .erase = slot_erase_,
+    .write = slot_write_,
+    .map = slot_map_,
+};
+
+static model_ota_t ota_ = {
+    .p_storage = &storage_,
+    .notify = notify_,
+    .verify = verify_,
+    .uptime_ms = uptime_ms_,
+    .active_slot = MODEL_OTA_SLOT_NONE,
+};
+
+static const neuton_nn_t* p_nn_ = NULL;
+static bool notify_enabled_ = false;
+static atomic_t pending_ = ATOMIC_INIT(0);
+
+/* Slot erase takes up to hundreds of milliseconds, so it is done out of the GATT write callback */
+static K_WORK_DEFINE(erase_work_, erase_work_handler_);
+static uint8_t erase_slot_;
+static uint32_t erase_size_;
+
+K_MUTEX_DEFINE(ota_lock_);
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void control_ccc_changed_(const struct bt_gatt_attr* attr, uint16_t value)
+{
+    notify_enabled_ = (value == BT_GATT_CCC_NOTIFY);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static ssize_t write_control_(struct bt_conn* conn,
+                              const struct bt_gatt_attr* attr,
+                              const void* buf, uint16_t len, uint16_t offset,
+                              uint8_t flags)
+{
+    if (offset != 0)
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+
+    /* Data chunk is written without response, so it takes the whole ATT payload */
+    ota_.mtu = bt_gatt_get_mtu(conn) - 3;
+
+    model_ota_status_t status = model_ota_on_control(&ota_, buf, len);
+
+    if ((status == MODEL_OTA_STATUS_SUCCESS) && model_ota_pending(&ota_, NULL))
+    {
+        const model_ota_stats_t* p_stats = &ota_.stats;
+
+        printk("Model received: %u bytes in %u ms (%u B/s), %u chunks, %u dropped, verified in %u ms\r\n",
+               p_stats->image_size, p_stats->transfer_ms,
+               (p_stats->transfer_ms != 0) ? (p_stats->image_size * 1000U / p_stats->transfer_ms) : 0,
+               p_stats->chunks, p_stats->dropped, p_stats->verify_ms);
+
+        atomic_set(&pending_, 1);
+    }
+
+    k_mutex_unlock(&ota_lock_);
+
+    return len;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static ssize_t write_data_(struct bt_conn* conn,
+                           const struct bt_gatt_attr* attr,
+                           const void* buf, uint16_t len, uint16_t offset,
+                           uint8_t flags)
+{
+    if (offset != 0)
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+    model_ota_on_data(&ota_, buf, len);
+    k_mutex_unlock(&ota_lock_);
+
+    return len;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BT_GATT_SERVICE_DEFINE(model_ota_svc,
+                       BT_GATT_PRIMARY_SERVICE(&service_uuid_),
+                       BT_GATT_CHARACTERISTIC(&control_uuid_.uuid,
+                                              BT_GATT_CHRC_WRITE | BT_GATT_CHRC_NOTIFY,
+                                              BT_GATT_PERM_WRITE_ENCRYPT,
+                                              NULL, write_control_, NULL),
+                       BT_GATT_CCC(control_ccc_changed_,
+                                   BT_GATT_PERM_READ_ENCRYPT | BT_GATT_PERM_WRITE_ENCRYPT),
+                       BT_GATT_CHARACTERISTIC(&data_uuid_.uuid,
+                                              BT_GATT_CHRC_WRITE_WITHOUT_RESP,
+                                              BT_GATT_PERM_WRITE_ENCRYPT,
+                                              NULL, write_data_, NULL), );
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void disconnected_(struct bt_conn* conn, uint8_t reason)
+{
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+
+    /* Interrupted transfer is discarded, the verified one is still activated */
+    if (!model_ota_pending(&ota_, NULL))
+        model_ota_reset(&ota_);
+
+    k_mutex_unlock(&ota_lock_);
+
+    notify_enabled_ = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BT_CONN_CB_DEFINE(model_ota_conn_callbacks) = {
+    .disconnected = disconnected_,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int slot_erase_(uint8_t slot, uint32_t size)
+{
+    if (slots_[slot] == NULL)
+        return -ENODEV;
+
+    /* Called with ota_lock_ held, the work handler reads the arguments under the same lock */
+    erase_slot_ = slot;
+    erase_size_ = size;
+
+    return (k_work_submit(&erase_work_) >= 0) ? 0 : -EBUSY;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void erase_work_handler_(struct k_work* p_work)
+{
+    ARG_UNUSED(p_work);
+
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+    const struct flash_area* p_area = slots_[erase_slot_];
+    const uint32_t size = erase_size_;
+    k_mutex_unlock(&ota_lock_);
+
+    struct flash_pages_info page;
+    int err = flash_get_page_info_by_offs(flash_area_get_device(p_area), p_area->fa_off, &page);
+
+    /* Only the pages of the image are erased to keep the transfer start short */
+    if (!err)
+        err = flash_area_erase(p_area, 0, ROUND_UP(size, page.size));
+
+    /* Protocol ignores the completion, if the transfer is aborted during the erase */
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+    model_ota_erased(&ota_, err);
+    k_mutex_unlock(&ota_lock_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int slot_write_(uint8_t slot, uint32_t offset, const void* p_data, uint32_t len)
+{
+    if (slots_[slot] == NULL)
+        return -ENODEV;
+
+    return flash_area_write(slots_[slot], offset, p_data, len);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const void* slot_map_(uint8_t slot)
+{
+    /* Slots are in the internal memory-mapped flash, so the model is executed in place */
+    return (const void*)(CONFIG_FLASH_BASE_ADDRESS + slots_[slot]->fa_off);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int notify_(const uint8_t* p_data, uint16_t len, void* p_ctx)
+{
+    (void)p_ctx;
+
+    if (!notify_enabled_)
+        return -EACCES;
+
+    return bt_gatt_notify(NULL, &model_ota_svc.attrs[CONTROL_ATTR_INDEX], p_data, len);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool verify_(const void* p_image, uint32_t size, void* p_ctx)
+{
+    (void)p_ctx;
+
+    if ((p_nn_ == NULL) || (neuton_nn_blob_validate(p_nn_, p_image, size) != NEUTON_STATUS_SUCCESS))
+        return false;
+
+    /* Image should be newer than the other slot one, otherwise the other slot is loaded after reboot */
+    const uint8_t other = (ota_.target_slot == 0) ? 1 : 0;
+    const void* p_other = slot_map_(other);
+
+    if (neuton_nn_blob_validate(p_nn_, p_other, storage_.slot_size) != NEUTON_STATUS_SUCCESS)
+        return true;
+
+    const uint32_t sequence = ((const neuton_nn_blob_header_t*)p_image)->sequence;
+    const uint32_t other_sequence = ((const neuton_nn_blob_header_t*)p_other)->sequence;
+
+    return (int32_t)(sequence - other_sequence) > 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t uptime_ms_(void)
+{
+    return k_uptime_get_32();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int ble_model_ota_init(neuton_nn_t* p_nn)
+{
+    for (uint8_t slot = 0; slot < MODEL_OTA_SLOTS_NUM; slot++)
+    {
+        int err = flash_area_open(SLOT_IDS[slot], &slots_[slot]);
+
+        if (err)
+        {
+            printk("Failed to open model slot %u, error = %d\r\n", slot, err);
+            return err;
+        }
+    }
+
+    /* Both slots have the same size, the smaller one is used to be sure */
+    storage_.slot_size = MIN(slots_[0]->fa_size, slots_[1]->fa_size);
+
+    uint8_t slot = MODEL_OTA_SLOT_NONE;
+    neuton_status_t status = neuton_nn_blob_load_ab(p_nn, slot_map_(0), slot_map_(1), storage_.slot_size, &slot);
+
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+    p_nn_ = p_nn;
+    ota_.active_slot = (status == NEUTON_STATUS_SUCCESS) ? slot : MODEL_OTA_SLOT_NONE;
+    model_ota_reset(&ota_);
+    k_mutex_unlock(&ota_lock_);
+
+    if (status == NEUTON_STATUS_SUCCESS)
+        printk("Model loaded from slot %u, solution id: %s\r\n", slot, neuton_nn_solution_id_str(p_nn));
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ble_model_ota_apply(neuton_nn_t* p_nn)
+{
+    uint8_t slot;
+    bool activated = false;
+
+    if (!atomic_get(&pending_))
+        return false;
+
+    k_mutex_lock(&ota_lock_, K_FOREVER);
+
+    if (model_ota_pending(&ota_, &slot))
+    {
+        const uint32_t start = k_cycle_get_32();
+
+        activated = (neuton_nn_blob_load(p_nn, slot_map_(slot), storage_.slot_size) == NEUTON_STATUS_SUCCESS);
+
+        const uint32_t swap_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+        model_ota_activated(&ota_, activated, swap_us);
+
+        printk("Model %s slot %u in %u us, solution id: %s\r\n",
+               activated ? "activated from" : "rejected in", slot, swap_us, neuton_nn_solution_id_str(p_nn));
+    }
+
+    atomic_set(&pending_, 0);
+    k_mutex_unlock(&ota_lock_);
+
+    return activated;
+}
+
+#endif // CONFIG_MODEL_OTA
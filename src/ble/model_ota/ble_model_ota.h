@@ -0,0 +1,73 @@
+/**
+ *
+ * @defgroup ble_model_ota Bluetooth model update service
+ * @{
+ * @ingroup ble
+ *
+ * @brief GATT model transfer service, that streams a serialized model (@ref neuton_nn_model_blob)
+ *        into the inactive one of model_slot_a / model_slot_b flash partitions with @ref model_ota_protocol
+ *        and activates it between inference cycles.
+ *
+ *        Service has the control characteristic (write, notify) and the data characteristic (write without response).
+ *        The newest valid slot is loaded on initialization, the compiled model is kept if both slots are not valid.
+ *
+ */
+#ifndef __BLE_MODEL_OTA_H__
+#define __BLE_MODEL_OTA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <neuton/neuton.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/**
+ * @brief Model transfer service UUID
+ */
+#define BLE_MODEL_OTA_UUID_SERVICE_VAL \
+    BT_UUID_128_ENCODE(0x4e540001, 0x7a1b, 0x4c3d, 0x9e8f, 0x6d2c5b4a3f10)
+
+/**
+ * @brief Control characteristic UUID
+ */
+#define BLE_MODEL_OTA_UUID_CONTROL_VAL \
+    BT_UUID_128_ENCODE(0x4e540002, 0x7a1b, 0x4c3d, 0x9e8f, 0x6d2c5b4a3f10)
+
+/**
+ * @brief Data characteristic UUID
+ */
+#define BLE_MODEL_OTA_UUID_DATA_VAL \
+    BT_UUID_128_ENCODE(0x4e540003, 0x7a1b, 0x4c3d, 0x9e8f, 0x6d2c5b4a3f10)
+
+/**
+ * @brief Initialize model slots and load the newest valid model from them
+ *
+ * @param p_nn      Model context, set up by neuton_nn_setup()
+ *
+ * @return Operation status, 0 for success
+ */
+int ble_model_ota_init(neuton_nn_t* p_nn);
+
+/**
+ * @brief Activate the received model if it is pending, should be called between inference cycles
+ *        in the same thread as neuton_nn_run_inference()
+ *
+ * @param p_nn      Model context
+ *
+ * @return true if the model is changed
+ */
+bool ble_model_ota_apply(neuton_nn_t* p_nn);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __BLE_MODEL_OTA_H__
+
+/**
+ * @}
+ */
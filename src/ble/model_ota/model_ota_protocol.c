@@ -0,0 +1,335 @@
+#include "model_ota_protocol.h"
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define START_CMD_LEN (10U)
+#define DATA_HEADER_LEN (4U)
+#define RESPONSE_LEN (5U)
+#define ACK_LEN (5U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const uint32_t CRC32_NIBBLE_TABLE[16] = {
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t get_u32_(const uint8_t* p_data)
+{
+    return (uint32_t)p_data[0] | ((uint32_t)p_data[1] << 8) | ((uint32_t)p_data[2] << 16) |
+           ((uint32_t)p_data[3] << 24);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void put_u32_(uint8_t* p_data, uint32_t value)
+{
+    p_data[0] = (uint8_t)value;
+    p_data[1] = (uint8_t)(value >> 8);
+    p_data[2] = (uint8_t)(value >> 16);
+    p_data[3] = (uint8_t)(value >> 24);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t uptime_ms_(const model_ota_t* p_ota)
+{
+    return (p_ota->uptime_ms != NULL) ? p_ota->uptime_ms() : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void send_response_(model_ota_t* p_ota, uint8_t command, model_ota_status_t status)
+{
+    const uint8_t response[RESPONSE_LEN] = {
+        MODEL_OTA_OP_RESPONSE,
+        command,
+        (uint8_t)status,
+        (uint8_t)p_ota->chunk_size,
+        (uint8_t)(p_ota->chunk_size >> 8),
+    };
+
+    p_ota->notify(response, sizeof(response), p_ota->p_ctx);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void send_ack_(model_ota_t* p_ota)
+{
+    uint8_t ack[ACK_LEN] = {MODEL_OTA_OP_ACK};
+
+    put_u32_(&ack[1], p_ota->received);
+
+    p_ota->notify(ack, sizeof(ack), p_ota->p_ctx);
+
+    p_ota->in_window = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static model_ota_status_t start_(model_ota_t* p_ota, const uint8_t* p_data, uint16_t len)
+{
+    if (len < START_CMD_LEN)
+        return MODEL_OTA_STATUS_INVALID_SIZE;
+
+    /** Receiving slot couldn't be erased while the previous image is pending for activation
+     * or while the slot is still erased for the aborted transfer */
+    if ((p_ota->state == MODEL_OTA_STATE_PENDING) || p_ota->erasing)
+        return MODEL_OTA_STATUS_INVALID_STATE;
+
+    const uint32_t image_size = get_u32_(&p_data[1]);
+
+    if ((image_size == 0) || (image_size > p_ota->p_storage->slot_size))
+        return MODEL_OTA_STATUS_INVALID_SIZE;
+
+    /** Write to the slot, that doesn't hold the active model */
+    const uint8_t slot = (p_ota->active_slot == 0) ? 1 : 0;
+
+    uint32_t chunk_size = (p_ota->mtu > DATA_HEADER_LEN) ? (uint32_t)(p_ota->mtu - DATA_HEADER_LEN) : 0;
+
+    if (chunk_size > MODEL_OTA_CHUNK_MAX)
+        chunk_size = MODEL_OTA_CHUNK_MAX;
+
+    chunk_size -= chunk_size % MODEL_OTA_WRITE_ALIGN;
+
+    if (chunk_size == 0)
+        return MODEL_OTA_STATUS_INVALID_SIZE;
+
+    /** Erase could complete before the return, so the transfer is set up before it is started */
+    p_ota->state = MODEL_OTA_STATE_ERASING;
+    p_ota->erasing = true;
+    p_ota->target_slot = slot;
+    p_ota->image_size = image_size;
+    p_ota->image_crc32 = get_u32_(&p_data[5]);
+    p_ota->window = (p_data[9] != 0) ? p_data[9] : 1;
+    p_ota->chunk_size = (uint16_t)chunk_size;
+    p_ota->received = 0;
+    p_ota->in_window = 0;
+    p_ota->ack_sent = false;
+
+    memset(&p_ota->stats, 0, sizeof(p_ota->stats));
+    p_ota->stats.image_size = image_size;
+
+    if (p_ota->p_storage->erase(slot, image_size) != 0)
+    {
+        p_ota->state = MODEL_OTA_STATE_IDLE;
+        p_ota->erasing = false;
+        return MODEL_OTA_STATUS_STORAGE_ERROR;
+    }
+
+    return MODEL_OTA_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static model_ota_status_t finish_(model_ota_t* p_ota)
+{
+    if (p_ota->state != MODEL_OTA_STATE_RECEIVING)
+        return MODEL_OTA_STATUS_INVALID_STATE;
+
+    if (p_ota->received != p_ota->image_size)
+        return MODEL_OTA_STATUS_INVALID_SIZE;
+
+    const uint32_t verify_start_ms = uptime_ms_(p_ota);
+
+    /** Verify what is actually in flash, not what was received */
+    const void* p_image = p_ota->p_storage->map(p_ota->target_slot);
+
+    model_ota_status_t status = MODEL_OTA_STATUS_SUCCESS;
+
+    if (model_ota_crc32(0, p_image, p_ota->image_size) != p_ota->image_crc32)
+        status = MODEL_OTA_STATUS_CRC_MISMATCH;
+    else if ((p_ota->verify != NULL) && !p_ota->verify(p_image, p_ota->image_size, p_ota->p_ctx))
+        status = MODEL_OTA_STATUS_INVALID_IMAGE;
+
+    p_ota->stats.verify_ms = uptime_ms_(p_ota) - verify_start_ms;
+    p_ota->state = (status == MODEL_OTA_STATUS_SUCCESS) ? MODEL_OTA_STATE_PENDING : MODEL_OTA_STATE_IDLE;
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void model_ota_reset(model_ota_t* p_ota)
+{
+    /** Erase in progress is not reset, the storage still completes it with model_ota_erased() */
+    p_ota->state = MODEL_OTA_STATE_IDLE;
+    p_ota->chunk_size = 0;
+    p_ota->received = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+model_ota_status_t model_ota_on_control(model_ota_t* p_ota, const uint8_t* p_data, uint16_t len)
+{
+    model_ota_status_t status;
+
+    if (len == 0)
+        return MODEL_OTA_STATUS_UNKNOWN_COMMAND;
+
+    switch (p_data[0])
+    {
+        case MODEL_OTA_OP_START:
+            status = start_(p_ota, p_data, len);
+
+            /** Successful START is answered when the slot is erased */
+            if (status == MODEL_OTA_STATUS_SUCCESS)
+                return status;
+            break;
+        case MODEL_OTA_OP_FINISH:
+            status = finish_(p_ota);
+            break;
+        case MODEL_OTA_OP_ABORT:
+            if ((p_ota->state == MODEL_OTA_STATE_ERASING) || (p_ota->state == MODEL_OTA_STATE_RECEIVING))
+                p_ota->state = MODEL_OTA_STATE_IDLE;
+            status = MODEL_OTA_STATUS_SUCCESS;
+            break;
+        default:
+            status = MODEL_OTA_STATUS_UNKNOWN_COMMAND;
+            break;
+    }
+
+    send_response_(p_ota, p_data[0], status);
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void model_ota_erased(model_ota_t* p_ota, int err)
+{
+    p_ota->erasing = false;
+
+    if (p_ota->state != MODEL_OTA_STATE_ERASING)
+        return;
+
+    if (err != 0)
+    {
+        p_ota->state = MODEL_OTA_STATE_IDLE;
+        send_response_(p_ota, MODEL_OTA_OP_START, MODEL_OTA_STATUS_STORAGE_ERROR);
+        return;
+    }
+
+    /** Transfer time doesn't include the erase, it is measured from the RESPONSE to START */
+    p_ota->state = MODEL_OTA_STATE_RECEIVING;
+    p_ota->start_ms = uptime_ms_(p_ota);
+
+    send_response_(p_ota, MODEL_OTA_OP_START, MODEL_OTA_STATUS_SUCCESS);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool model_ota_on_data(model_ota_t* p_ota, const uint8_t* p_data, uint16_t len)
+{
+    if ((p_ota->state != MODEL_OTA_STATE_RECEIVING) || (len <= DATA_HEADER_LEN))
+        return false;
+
+    const uint32_t offset = get_u32_(p_data);
+    const uint32_t payload_len = len - DATA_HEADER_LEN;
+    const uint32_t remaining = p_ota->image_size - p_ota->received;
+    const uint32_t expected_len = (remaining < p_ota->chunk_size) ? remaining : p_ota->chunk_size;
+
+    /** Go-back-N: chunks after a lost one are dropped, the first of them is acknowledged
+     * with the expected offset, so the peer resends from it */
+    if ((offset != p_ota->received) || (payload_len != expected_len))
+    {
+        p_ota->stats.dropped++;
+
+        if (!p_ota->ack_sent)
+        {
+            send_ack_(p_ota);
+            p_ota->ack_sent = true;
+        }
+
+        return false;
+    }
+
+    int err;
+
+    if ((payload_len % MODEL_OTA_WRITE_ALIGN) == 0)
+    {
+        err = p_ota->p_storage->write(p_ota->target_slot, offset, &p_data[DATA_HEADER_LEN], payload_len);
+    }
+    else
+    {
+        /** Only the last chunk could be unaligned, it is padded with erased flash value */
+        uint8_t padded[MODEL_OTA_CHUNK_MAX];
+        const uint32_t padded_len = payload_len + MODEL_OTA_WRITE_ALIGN - (payload_len % MODEL_OTA_WRITE_ALIGN);
+
+        memset(padded, 0xFF, padded_len);
+        memcpy(padded, &p_data[DATA_HEADER_LEN], payload_len);
+
+        err = p_ota->p_storage->write(p_ota->target_slot, offset, padded, padded_len);
+    }
+
+    if (err != 0)
+    {
+        p_ota->state = MODEL_OTA_STATE_IDLE;
+        send_response_(p_ota, MODEL_OTA_OP_START, MODEL_OTA_STATUS_STORAGE_ERROR);
+        return false;
+    }
+
+    p_ota->received += payload_len;
+    p_ota->in_window++;
+    p_ota->ack_sent = false;
+    p_ota->stats.chunks++;
+
+    if (p_ota->received == p_ota->image_size)
+        p_ota->stats.transfer_ms = uptime_ms_(p_ota) - p_ota->start_ms;
+
+    if ((p_ota->in_window >= p_ota->window) || (p_ota->received == p_ota->image_size))
+        send_ack_(p_ota);
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool model_ota_pending(const model_ota_t* p_ota, uint8_t* p_slot)
+{
+    if (p_ota->state != MODEL_OTA_STATE_PENDING)
+        return false;
+
+    if (p_slot != NULL)
+        *p_slot = p_ota->target_slot;
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void model_ota_activated(model_ota_t* p_ota, bool activated, uint32_t swap_us)
+{
+    if (p_ota->state != MODEL_OTA_STATE_PENDING)
+        return;
+
+    if (activated)
+    {
+        p_ota->active_slot = p_ota->target_slot;
+        p_ota->stats.swap_us = swap_us;
+    }
+
+    p_ota->state = MODEL_OTA_STATE_IDLE;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t model_ota_crc32(uint32_t crc, const void* p_data, uint32_t len)
+{
+    const uint8_t* p_bytes = (const uint8_t*)p_data;
+
+    crc = ~crc;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        crc ^= p_bytes[i];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE[crc & 0x0FU];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE[crc & 0x0FU];
+    }
+
+    return ~crc;
+}
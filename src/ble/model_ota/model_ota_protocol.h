@@ -0,0 +1,251 @@
+/**
+ *
+ * @defgroup model_ota_protocol Model transfer protocol
+ * @{
+ * @ingroup ble
+ *
+ * @brief Transport independent protocol of the over-the-air model update,
+ *        that streams a serialized model into the inactive flash slot.
+ *
+ *        The peer writes control commands and data chunks, the device replies with notifications.
+ *        All values are little-endian.
+ *
+ *        Control commands:
+ *        - START  { 0x01, image_size (u32), image_crc32 (u32), window (u8) }
+ *        - FINISH { 0x02 }
+ *        - ABORT  { 0x03 }
+ *
+ *        Data chunk: { offset (u32), payload }, payload is chunk_size bytes except the last one.
+ *
+ *        Notifications:
+ *        - RESPONSE { 0x80, command, status @ref model_ota_status_t, chunk_size (u16) }
+ *        - ACK      { 0x81, offset (u32) }
+ *
+ *        The peer sends up to window chunks after the last acknowledged offset and waits for the ACK.
+ *        ACK is sent after each window of the in-order chunks, after the last chunk and after the first
+ *        out-of-order chunk, that the device drops, so the peer resumes from the acknowledged offset.
+ *        The peer also resumes from the last acknowledged offset, if the ACK is not received in time.
+ *        Slot erase is started on START and is completed asynchronously by the storage with model_ota_erased(),
+ *        RESPONSE to START is sent when the slot is erased, so the peer sends the first chunk after it.
+ *        RESPONSE to START with an error status aborts the transfer, it is also sent if a chunk write is failed.
+ *        The image CRC-32 is verified over the flash slot on FINISH, then the image is verified
+ *        by the application, and the slot is pending for activation between inference cycles.
+ *        CRC-32 detects transfer and flash write errors only, authenticity of the image relies on
+ *        the encrypted link of the bonded peer, that also delivers the CRC.
+ *
+ */
+#ifndef __MODEL_OTA_PROTOCOL_H__
+#define __MODEL_OTA_PROTOCOL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/**
+ * @brief Maximum payload of the data chunk in bytes
+ */
+#ifndef MODEL_OTA_CHUNK_MAX
+#define MODEL_OTA_CHUNK_MAX (240U)
+#endif
+
+/**
+ * @brief Flash write block size, data chunks are multiples of it
+ */
+#ifndef MODEL_OTA_WRITE_ALIGN
+#define MODEL_OTA_WRITE_ALIGN (4U)
+#endif
+
+/**
+ * @brief Number of flash slots for the models
+ */
+#define MODEL_OTA_SLOTS_NUM (2U)
+
+/**
+ * @brief Active slot value, if the compiled model is active
+ */
+#define MODEL_OTA_SLOT_NONE (0xFFU)
+
+/**
+ * @brief Protocol operation codes
+ */
+typedef enum
+{
+    MODEL_OTA_OP_START = 0x01,
+    MODEL_OTA_OP_FINISH = 0x02,
+    MODEL_OTA_OP_ABORT = 0x03,
+
+    MODEL_OTA_OP_RESPONSE = 0x80,
+    MODEL_OTA_OP_ACK = 0x81,
+} model_ota_op_t;
+
+/**
+ * @brief Command status in the RESPONSE notification
+ */
+typedef enum
+{
+    MODEL_OTA_STATUS_SUCCESS = 0,
+    MODEL_OTA_STATUS_INVALID_STATE, /**< Command is not expected, e.g. activation is pending */
+    MODEL_OTA_STATUS_INVALID_SIZE,  /**< Image doesn't fit the slot or is not completely received */
+    MODEL_OTA_STATUS_STORAGE_ERROR, /**< Flash erase or write is failed */
+    MODEL_OTA_STATUS_CRC_MISMATCH,  /**< Image CRC-32 in the slot doesn't match the START one */
+    MODEL_OTA_STATUS_INVALID_IMAGE, /**< Image is rejected by the application verification */
+    MODEL_OTA_STATUS_UNKNOWN_COMMAND,
+} model_ota_status_t;
+
+/**
+ * @brief Protocol state
+ */
+typedef enum
+{
+    MODEL_OTA_STATE_IDLE = 0,
+    MODEL_OTA_STATE_ERASING,   /**< START is accepted, slot erase is in progress */
+    MODEL_OTA_STATE_RECEIVING,
+    MODEL_OTA_STATE_PENDING, /**< Verified image is waiting for activation */
+} model_ota_state_t;
+
+/**
+ * @brief Flash slots storage
+ */
+typedef struct
+{
+    /** Start erasing the slot for the image of size bytes, returns 0 if the erase is started,
+     *  its completion is reported with model_ota_erased() */
+    int (*erase)(uint8_t slot, uint32_t size);
+    /** Write data to the slot at offset, offset and len are multiples of MODEL_OTA_WRITE_ALIGN, returns 0 on success */
+    int (*write)(uint8_t slot, uint32_t offset, const void* p_data, uint32_t len);
+    /** Memory-mapped slot content */
+    const void* (*map)(uint8_t slot);
+    /** Size of each slot in bytes */
+    uint32_t slot_size;
+} model_ota_storage_t;
+
+/**
+ * @brief Transfer statistics
+ */
+typedef struct
+{
+    uint32_t image_size;    /**< Size of the last transferred image in bytes */
+    uint32_t chunks;        /**< Number of accepted data chunks */
+    uint32_t dropped;       /**< Number of dropped out-of-order data chunks */
+    uint32_t transfer_ms;   /**< Time from the erased slot RESPONSE to START to the last chunk */
+    uint32_t verify_ms;     /**< Time of the image verification on FINISH */
+    uint32_t swap_us;       /**< Time of the last model activation, reported by the application */
+} model_ota_stats_t;
+
+/**
+ * @brief Protocol context, callbacks and storage should be set by the user before model_ota_reset()
+ */
+typedef struct
+{
+    const model_ota_storage_t* p_storage;
+
+    /** Send notification to the peer, returns 0 on success */
+    int (*notify)(const uint8_t* p_data, uint16_t len, void* p_ctx);
+    /** Verify the received image in the slot memory before activation, returns true if it could be activated */
+    bool (*verify)(const void* p_image, uint32_t size, void* p_ctx);
+    /** Monotonic time in milliseconds for statistics, could be NULL */
+    uint32_t (*uptime_ms)(void);
+    /** User context of the callbacks */
+    void* p_ctx;
+
+    uint16_t mtu;        /**< Maximum size of the written data chunk, including offset, set by the transport */
+    uint8_t active_slot; /**< Slot of the active model, MODEL_OTA_SLOT_NONE for the compiled model */
+
+    /* Internal state */
+    model_ota_state_t state;
+    uint8_t target_slot;
+    uint8_t window;
+    uint8_t in_window;
+    bool ack_sent;
+    bool erasing;
+    uint16_t chunk_size;
+    uint32_t image_size;
+    uint32_t image_crc32;
+    uint32_t received;
+    uint32_t start_ms;
+
+    model_ota_stats_t stats;
+} model_ota_t;
+
+/**
+ * @brief Reset the protocol to the idle state, pending image is discarded
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ */
+void model_ota_reset(model_ota_t* p_ota);
+
+/**
+ * @brief Handle the control command written by the peer
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ * @param p_data    Command data
+ * @param len       Command length
+ *
+ * @return Command status @ref model_ota_status_t, it is also sent to the peer,
+ *         successful START is answered after the slot erase with model_ota_erased()
+ */
+model_ota_status_t model_ota_on_control(model_ota_t* p_ota, const uint8_t* p_data, uint16_t len);
+
+/**
+ * @brief Complete the slot erase started by the START command and send RESPONSE to it,
+ *        completion is ignored if the transfer is aborted or reset during the erase
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ * @param err       Erase status, 0 on success
+ */
+void model_ota_erased(model_ota_t* p_ota, int err);
+
+/**
+ * @brief Handle the data chunk written by the peer
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ * @param p_data    Data chunk
+ * @param len       Data chunk length
+ *
+ * @return true if the chunk is accepted, false if it is dropped
+ */
+bool model_ota_on_data(model_ota_t* p_ota, const uint8_t* p_data, uint16_t len);
+
+/**
+ * @brief Check if the verified image is pending for activation
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ * @param p_slot    Slot of the pending image
+ *
+ * @return true if the image is pending
+ */
+bool model_ota_pending(const model_ota_t* p_ota, uint8_t* p_slot);
+
+/**
+ * @brief Complete activation of the pending image, the protocol is ready for the next transfer
+ *
+ * @param p_ota     Protocol context @ref model_ota_t
+ * @param activated true if the pending image is active now, false if it is rejected
+ * @param swap_us   Time of the model activation
+ */
+void model_ota_activated(model_ota_t* p_ota, bool activated, uint32_t swap_us);
+
+/**
+ * @brief Calculate CRC-32 (IEEE 802.3) of the data
+ *
+ * @param crc       Initial value, 0 for the first block
+ * @param p_data    Data
+ * @param len       Data length
+ *
+ * @return CRC-32 of the data
+ */
+uint32_t model_ota_crc32(uint32_t crc, const void* p_data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __MODEL_OTA_PROTOCOL_H__
+
+/**
+ * @}
+ */
@@ -22,6 +22,9 @@
 #include <sensor/imu/bsp_imu.h>
 
 #include "ble/hid/ble_hid.h"
+#if CONFIG_MODEL_OTA
+#include "ble/model_ota/ble_model_ota.h"
+#endif
 #include "inference_postprocessing.h"
 #include "app_version.h"
 
@@ -115,6 +118,11 @@ int main(void)
     p_nn_ = neuton_nn_user_model();
     neuton_nn_setup(p_nn_);
 
+#if CONFIG_MODEL_OTA
+    /** Load the newest model update from flash, if there is a valid one */
+    ble_model_ota_init(p_nn_);
+#endif
+
     printk("Neuton.AI Nordic Thingy 53 Gestures Recognition Demo: \r\n");
     printk("\t Application version: %d.%d.%d\r\n", APP_VERSION_MAJOR, APP_VERSION_MINOR, APP_VERSION_PATCH);
     printk("\t Neuton Version: %d.%d.%d\r\n", NEUTON_MAJOR_VERSION, NEUTON_MINOR_VERSION, NEUTON_PATCH_VERSION);
@@ -132,6 +140,11 @@ int main(void)
         if (bsp_imu_read(&imu_data) != BSP_STATUS_SUCCESS)
             continue;
 
+#if CONFIG_MODEL_OTA
+        /** Switch to the received model between inference cycles */
+        ble_model_ota_apply(p_nn_);
+#endif
+
         input_data[0] = imu_data.accel[0].raw;
         input_data[1] = imu_data.accel[1].raw;
         input_data[2] = imu_data.accel[2].raw;
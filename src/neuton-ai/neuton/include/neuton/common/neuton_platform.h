@@ -31,6 +31,13 @@
 #define __NEUTON_STATIC_FORCEINLINE __NEUTON_STATIC_INLINE
 #endif
 
+/* Multiply and add are not fused to FMA, e.g. to get the same floating-point results as the prebuilt library */
+#if defined(__GNUC__) && !defined(__clang__)
+#define __NEUTON_NO_FP_CONTRACT     __attribute__((optimize("fp-contract=off")))
+#else
+#define __NEUTON_NO_FP_CONTRACT
+#endif
+
 #define NEUTON_INT8_MAX           ((neuton_i8_t)(0x7F))
 #define NEUTON_INT8_MIN           ((neuton_i8_t)(0x80))
 #define NEUTON_INT8_ABSMAX        ((neuton_i8_t)(0x7F))
@@ -47,6 +54,9 @@
 #define NEUTON_INT16_SIGN_BIT      ((neuton_i16_t)1 << 15)
 #define NEUTON_INT16_CHECK_SIGN(x) (bool)((x) & NEUTON_INT16_SIGN_BIT)
 
+#define NEUTON_UINT8_MAX ((neuton_u8_t)(0xFF))
+#define NEUTON_UINT8_MIN ((neuton_u8_t)(0x00))
+
 #define NEUTON_UINT16_MAX ((neuton_u16_t)(0xFFFF))
 #define NEUTON_UINT16_MIN ((neuton_u16_t)(0x0000))
 
@@ -17,6 +17,7 @@
 #include "statistic/neuton_dsp_amdf.h"
 #include "statistic/neuton_dsp_autocorr.h"
 #include "statistic/neuton_dsp_crest.h"
+#include "statistic/neuton_dsp_fused_moments.h"
 #include "statistic/neuton_dsp_hjorth.h"
 #include "statistic/neuton_dsp_kur.h"
 #include "statistic/neuton_dsp_lrp.h"
@@ -28,6 +29,7 @@
 #include "statistic/neuton_dsp_min.h"
 #include "statistic/neuton_dsp_min_max.h"
 #include "statistic/neuton_dsp_moments.h"
+#include "statistic/neuton_dsp_multichannel.h"
 #include "statistic/neuton_dsp_pk2pk.h"
 #include "statistic/neuton_dsp_psom.h"
 #include "statistic/neuton_dsp_psos.h"
@@ -38,6 +40,7 @@
 #include "statistic/neuton_dsp_rms.h"
 #include "statistic/neuton_dsp_rssq.h"
 #include "statistic/neuton_dsp_scr.h"
+#include "statistic/neuton_dsp_segment_stats.h"
 #include "statistic/neuton_dsp_skew.h"
 #include "statistic/neuton_dsp_stddev.h"
 #include "statistic/neuton_dsp_sum.h"
@@ -16,11 +16,15 @@ extern "C"
 #endif
 
 #include "support/neuton_dsp_quantization.h"
+#include "support/neuton_dsp_quantization_stats.h"
 #include "support/neuton_dsp_scale_minmax.h"
 #include "support/neuton_dsp_scale_zscore.h"
+#include "support/neuton_dsp_scale_plan.h"
 #include "support/neuton_dsp_clipping.h"
+#include "support/neuton_dsp_running_median.h"
 #include "support/neuton_dsp_windowing.h"
 #include "support/neuton_f24.h"
+#include "support/neuton_f24_vector.h"
 
 #ifdef   __cplusplus
 }
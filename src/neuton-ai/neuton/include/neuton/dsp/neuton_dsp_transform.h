@@ -13,6 +13,8 @@
 #include "transform/neuton_dsp_fft.h"
 #include "transform/neuton_dsp_rfht.h"
 #include "transform/neuton_dsp_melspectr.h"
+#include "transform/neuton_dsp_mel_filterbank.h"
+#include "transform/neuton_dsp_melspectr_ring.h"
 
 
 #endif /* _NEUTON_DSP_TRANSFORM_FUNCTIONS_H_ */
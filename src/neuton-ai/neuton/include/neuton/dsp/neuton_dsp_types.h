@@ -41,11 +41,13 @@ typedef union neuton_dsp_spectral_ctx_flags_u
  * @brief Macro definitions for setting flags of @ref neuton_dsp_stat_ctx_flags_t
  * 
  */
-#define NEUTON_DSP_STAT_CTX_EMPTY       (0)
-#define NEUTON_DSP_STAT_CTX_SUM_FLAG    (1 << 0)
-#define NEUTON_DSP_STAT_CTX_TSS_FLAG    (1 << 1)
-#define NEUTON_DSP_STAT_CTX_VAR_FLAG    (1 << 2)
-#define NEUTON_DSP_STAT_CTX_ABSSUM_FLAG (1 << 4)
+#define NEUTON_DSP_STAT_CTX_EMPTY        (0)
+#define NEUTON_DSP_STAT_CTX_SUM_FLAG     (1 << 0)
+#define NEUTON_DSP_STAT_CTX_TSS_FLAG     (1 << 1)
+#define NEUTON_DSP_STAT_CTX_VAR_FLAG     (1 << 2)
+#define NEUTON_DSP_STAT_CTX_ABSSUM_FLAG  (1 << 4)
+#define NEUTON_DSP_STAT_CTX_SEGMENT_FLAG (1 << 6)
+#define NEUTON_DSP_STAT_CTX_FUSED_FLAG   (1 << 7)
 
 #define NEUTON_DSP_STAT_CTX_SUM_TSS_FLAGS \
     (NEUTON_DSP_STAT_CTX_SUM_FLAG | NEUTON_DSP_STAT_CTX_TSS_FLAG)
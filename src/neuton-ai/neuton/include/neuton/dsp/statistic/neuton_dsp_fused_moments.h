@@ -0,0 +1,187 @@
+/**
+ *
+ * @defgroup neuton_dsp_statistic_fused_moments Fused Statistical Moments
+ * @{
+ * @ingroup neuton_dsp_statistic
+ *
+ * @brief Single pass engine over the signal and its first and second differences,
+ *        all dependent statistics (mean, variance, skewness, kurtosis, Hjorth parameters,
+ *        derivatives of variance) are derived from the engine result without re-reading the input.
+ *
+ */
+#ifndef _NEUTON_DSP_STAT_FUSED_MOMENTS_FUNCTIONS_H_
+#define _NEUTON_DSP_STAT_FUSED_MOMENTS_FUNCTIONS_H_
+
+#include <neuton/dsp/neuton_dsp_types.h>
+#include <neuton/dsp/statistic/neuton_dsp_moments.h>
+#include <neuton/dsp/statistic/neuton_dsp_hjorth.h>
+#include <neuton/dsp/statistic/neuton_dsp_var.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Floating-point fused moments container, central moments are accumulated
+ *        with numerically stable Welford / Pebay online updates
+ */
+typedef struct neuton_dsp_fused_moments_f32_s
+{
+    /** Number of samples */
+    neuton_u16_t num;
+
+    /** Mean value */
+    neuton_f32_t mean;
+
+    /** Sum of 2nd powers of deviations from the mean */
+    neuton_f32_t m2;
+
+    /** Sum of 3rd powers of deviations from the mean */
+    neuton_f32_t m3;
+
+    /** Sum of 4th powers of deviations from the mean */
+    neuton_f32_t m4;
+
+    /** Variances of the first and second differences of the signal */
+    neuton_dsp_derivative_var_f32_t deriv_var;
+} neuton_dsp_fused_moments_f32_t;
+
+/**
+ * @brief INT16 fused moments container, exact integer power sums of the signal
+ *        taken relative to the first sample (pivot) to avoid cancellation on signals with large offset
+ */
+typedef struct neuton_dsp_fused_moments_i16_s
+{
+    /** Number of samples */
+    neuton_u16_t num;
+
+    /** First sample of the signal, all power sums are taken relative to it */
+    neuton_i16_t pivot;
+
+    /** Sum of deviations from the pivot */
+    neuton_i64_t sum;
+
+    /** Sum of 2nd powers of deviations from the pivot */
+    neuton_u64_t sum2;
+
+    /** Sum of 3rd powers of deviations from the pivot */
+    neuton_i64_t sum3;
+
+    /** Sum of 4th powers of deviations from the pivot, high 32 bits of each power */
+    neuton_u64_t sum4_hi;
+
+    /** Sum of 4th powers of deviations from the pivot, low 32 bits of each power */
+    neuton_u64_t sum4_lo;
+
+    /** Variances of the first and second differences of the signal */
+    neuton_dsp_derivative_var_i16_t deriv_var;
+} neuton_dsp_fused_moments_i16_t;
+
+/**
+ * @brief Calculate fused moments of a floating-point vector in a single pass.
+ *
+ * @param[in]   p_input   Pointer to the input vector
+ * @param[in]   num       Number of samples in input vector
+ * @param[out]  p_fm      Pointer to the fused moments container @ref neuton_dsp_fused_moments_f32_t
+ */
+void neuton_dsp_fused_moments_f32(const neuton_f32_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_fused_moments_f32_t* p_fm);
+
+/**
+ * @brief Calculate fused moments of a floating-point vector ​​using values ​​in increments of 'stride'.
+ *
+ * @param[in]   p_input   Pointer to the input vector
+ * @param[in]   num       Number of samples with 'stride' in input vector
+ * @param[in]   stride    Vector element offset stride
+ * @param[out]  p_fm      Pointer to the fused moments container @ref neuton_dsp_fused_moments_f32_t
+ */
+void neuton_dsp_fused_moments_f32_s(const neuton_f32_t* p_input, neuton_u16_t num, size_t stride,
+                                    neuton_dsp_fused_moments_f32_t* p_fm);
+
+/**
+ * @brief Calculate fused moments of a INT16 vector in a single pass.
+ *
+ * @param[in]   p_input   Pointer to the input vector
+ * @param[in]   num       Number of samples in input vector, should not exceed 32767
+ * @param[out]  p_fm      Pointer to the fused moments container @ref neuton_dsp_fused_moments_i16_t
+ */
+void neuton_dsp_fused_moments_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_fused_moments_i16_t* p_fm);
+
+/**
+ * @brief Calculate fused moments of a INT16 vector ​​using values ​​in increments of 'stride'.
+ *
+ * @param[in]   p_input   Pointer to the input vector
+ * @param[in]   num       Number of samples with 'stride' in input vector, should not exceed 32767
+ * @param[in]   stride    Vector element offset stride
+ * @param[out]  p_fm      Pointer to the fused moments container @ref neuton_dsp_fused_moments_i16_t
+ */
+void neuton_dsp_fused_moments_i16_s(const neuton_i16_t* p_input, neuton_u16_t num, size_t stride,
+                                    neuton_dsp_fused_moments_i16_t* p_fm);
+
+/**
+ * @brief Fill the statistics context from the fused moments, so the other statistics functions
+ *        will reuse <pre> p_ctx->value.sum, p_ctx->value.tss, p_ctx->value.var </pre> instead of recalculation
+ *
+ * @param[in]   p_fm      Pointer to the fused moments container
+ * @param[out]  p_ctx     Pointer to the statistics context
+ */
+void neuton_dsp_fused_moments_to_ctx_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                         neuton_dsp_stat_ctx_f32_t*            p_ctx);
+
+/**
+ * @brief Fill the statistics context from the fused moments, so the other statistics functions
+ *        will reuse <pre> p_ctx->value.sum, p_ctx->value.tss, p_ctx->value.var </pre> instead of recalculation
+ *
+ * @param[in]   p_fm      Pointer to the fused moments container
+ * @param[out]  p_ctx     Pointer to the statistics context
+ */
+void neuton_dsp_fused_moments_to_ctx_i16(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                         neuton_dsp_stat_ctx_i16_t*            p_ctx);
+
+/**
+ * @brief Convert INT16 fused moments to the floating-point central moments
+ *
+ * @param[in]   p_fm      Pointer to the INT16 fused moments container
+ * @param[out]  p_output  Pointer to the floating-point fused moments container
+ */
+void neuton_dsp_fused_moments_i16_to_f32(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                         neuton_dsp_fused_moments_f32_t*       p_output);
+
+/**
+ * @brief Derive Variance, Skewness and Excess Kurtosis from the fused moments
+ *
+ * @param[in]   p_fm      Pointer to the fused moments container
+ * @param[out]  p_m       Pointer to the moments container @ref neuton_dsp_moments_f32_t
+ */
+void neuton_dsp_fused_moments_get_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                      neuton_dsp_moments_f32_t*             p_m);
+
+/**
+ * @brief Derive Hjorth Parameters from the fused moments
+ *
+ * @param[in]   p_fm      Pointer to the fused moments container
+ * @param[out]  p_params  Hjorth Parameters @ref neuton_dsp_hjorth_params_f32_t
+ */
+void neuton_dsp_fused_hjorth_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                 neuton_dsp_hjorth_params_f32_t*       p_params);
+
+/**
+ * @brief Derive Hjorth Parameters from the fused moments
+ *
+ * @param[in]   p_fm      Pointer to the fused moments container
+ * @param[out]  p_params  Hjorth Parameters @ref neuton_dsp_hjorth_params_i16_t
+ */
+void neuton_dsp_fused_hjorth_i16(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                 neuton_dsp_hjorth_params_i16_t*       p_params);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_STAT_FUSED_MOMENTS_FUNCTIONS_H_ */
+
+/**
+ * @}
+ */
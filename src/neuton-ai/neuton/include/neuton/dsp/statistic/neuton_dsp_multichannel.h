@@ -0,0 +1,180 @@
+/**
+ *
+ * @defgroup neuton_dsp_statistic_multichannel Multi-channel Statistics
+ * @{
+ * @ingroup neuton_dsp_statistic
+ *
+ * @brief Batched statistics over interleaved multi-channel windows <pre> p_input[sample * channels + channel] </pre>
+ *        Each function traverses the window once in sequential order and produces results for all channels,
+ *        results are equal to the single channel '_s' functions called with stride equal to 'channels'.
+ *
+ */
+#ifndef _NEUTON_DSP_STAT_MULTICHANNEL_FUNCTIONS_H_
+#define _NEUTON_DSP_STAT_MULTICHANNEL_FUNCTIONS_H_
+
+#include <neuton/dsp/neuton_dsp_types.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Calculate Sum, Absolute Sum and Total Sum of Squares of all channels of
+ *        a floating-point interleaved window and store them into the statistics contexts,
+ *        so the other statistics functions will reuse
+ *        <pre> p_ctx[channel].value.sum, p_ctx[channel].value.abssum, p_ctx[channel].value.tss </pre>
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_ctx     Pointer to the array of 'channels' statistics contexts
+ */
+void neuton_dsp_mc_stat_ctx_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                                neuton_dsp_stat_ctx_f32_t* p_ctx);
+
+/**
+ * @brief Calculate Sum, Absolute Sum and Total Sum of Squares of all channels of
+ *        a INT16 interleaved window and store them into the statistics contexts,
+ *        so the other statistics functions will reuse
+ *        <pre> p_ctx[channel].value.sum, p_ctx[channel].value.abssum, p_ctx[channel].value.tss </pre>
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_ctx     Pointer to the array of 'channels' statistics contexts
+ */
+void neuton_dsp_mc_stat_ctx_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                                neuton_dsp_stat_ctx_i16_t* p_ctx);
+
+/**
+ * @brief Calculate Mean value of all channels from the statistics contexts
+ *        filled by @ref neuton_dsp_mc_stat_ctx_f32
+ *
+ * @param[in]   p_ctx     Pointer to the array of 'channels' statistics contexts
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_mean    Pointer to the array of 'channels' Mean values
+ */
+void neuton_dsp_mc_mean_f32(const neuton_dsp_stat_ctx_f32_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                            neuton_f32_t* p_mean);
+
+/**
+ * @brief Calculate Mean value of all channels from the statistics contexts
+ *        filled by @ref neuton_dsp_mc_stat_ctx_i16
+ *
+ * @param[in]   p_ctx     Pointer to the array of 'channels' statistics contexts
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_mean    Pointer to the array of 'channels' Mean values
+ */
+void neuton_dsp_mc_mean_i16(const neuton_dsp_stat_ctx_i16_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                            neuton_i16_t* p_mean);
+
+/**
+ * @brief Calculate Root Mean Square of all channels from the statistics contexts
+ *        filled by @ref neuton_dsp_mc_stat_ctx_f32
+ *
+ * @param[in]   p_ctx     Pointer to the array of 'channels' statistics contexts
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_rms     Pointer to the array of 'channels' Root Mean Square values
+ */
+void neuton_dsp_mc_rms_f32(const neuton_dsp_stat_ctx_f32_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_f32_t* p_rms);
+
+/**
+ * @brief Calculate Root Mean Square of all channels from the statistics contexts
+ *        filled by @ref neuton_dsp_mc_stat_ctx_i16
+ *
+ * @param[in]   p_ctx     Pointer to the array of 'channels' statistics contexts
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_rms     Pointer to the array of 'channels' Root Mean Square values
+ */
+void neuton_dsp_mc_rms_i16(const neuton_dsp_stat_ctx_i16_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_i32_t* p_rms);
+
+/**
+ * @brief Finds Maximum and Minimum value of all channels of a floating-point interleaved window.
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_min     Pointer to the array of 'channels' Minimum values
+ * @param[out]  p_max     Pointer to the array of 'channels' Maximum values
+ */
+void neuton_dsp_mc_min_max_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                               neuton_f32_t* p_min, neuton_f32_t* p_max);
+
+/**
+ * @brief Finds Maximum and Minimum value of all channels of a INT16 interleaved window.
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_min     Pointer to the array of 'channels' Minimum values
+ * @param[out]  p_max     Pointer to the array of 'channels' Maximum values
+ */
+void neuton_dsp_mc_min_max_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                               neuton_i16_t* p_min, neuton_i16_t* p_max);
+
+/**
+ * @brief Calculate Zero-crossing Rate of all channels of a floating-point interleaved window.
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_zcr     Pointer to the array of 'channels' Zero-crossing Rate values
+ */
+void neuton_dsp_mc_zcr_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_f32_t* p_zcr);
+
+/**
+ * @brief Calculate Zero-crossing Rate of all channels of a INT16 interleaved window.
+ *
+ * @param[in]   p_input   Pointer to the interleaved input window
+ * @param[in]   num       Number of samples in each channel
+ * @param[in]   channels  Number of interleaved channels
+ * @param[out]  p_zcr     Pointer to the array of 'channels' Zero-crossing Rate values,
+ *                        scaled by NEUTON_PERCENTAGE_TO_INT_FACTOR
+ */
+void neuton_dsp_mc_zcr_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_i16_t* p_zcr);
+
+/**
+ * @brief Calculate Threshold-crossing Rate of all channels of a floating-point interleaved window.
+ *        Mean-crossing Rate is calculated by passing Mean values from @ref neuton_dsp_mc_mean_f32 as thresholds.
+ *
+ * @param[in]   p_input      Pointer to the interleaved input window
+ * @param[in]   num          Number of samples in each channel
+ * @param[in]   channels     Number of interleaved channels
+ * @param[in]   p_threshold  Pointer to the array of 'channels' threshold values
+ * @param[out]  p_tcr        Pointer to the array of 'channels' Threshold-crossing Rate values
+ */
+void neuton_dsp_mc_tcr_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           const neuton_f32_t* p_threshold, neuton_f32_t* p_tcr);
+
+/**
+ * @brief Calculate Threshold-crossing Rate of all channels of a INT16 interleaved window.
+ *        Mean-crossing Rate is calculated by passing Mean values from @ref neuton_dsp_mc_mean_i16 as thresholds.
+ *
+ * @param[in]   p_input      Pointer to the interleaved input window
+ * @param[in]   num          Number of samples in each channel
+ * @param[in]   channels     Number of interleaved channels
+ * @param[in]   p_threshold  Pointer to the array of 'channels' threshold values
+ * @param[out]  p_tcr        Pointer to the array of 'channels' Threshold-crossing Rate values,
+ *                           scaled by NEUTON_PERCENTAGE_TO_INT_FACTOR
+ */
+void neuton_dsp_mc_tcr_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           const neuton_i16_t* p_threshold, neuton_i16_t* p_tcr);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_STAT_MULTICHANNEL_FUNCTIONS_H_ */
+
+/**
+ * @}
+ */
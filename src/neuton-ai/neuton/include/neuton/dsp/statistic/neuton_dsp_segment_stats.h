@@ -0,0 +1,112 @@
+/**
+ * @defgroup neuton_dsp_statistic_segment_stats Segment Partial Aggregates
+ * @{
+ * @ingroup neuton_dsp_statistic
+ * @brief Mergeable partial aggregates of the signal segments: sum, sum of squares, minimum, maximum
+ *        and zero crossings. Aggregates of the adjacent segments are merged into the aggregates
+ *        of the joined segment, so statistics of the window and its subwindows are derived
+ *        from a single pass over the smallest segments.
+ */
+#ifndef _NEUTON_DSP_STAT_SEGMENT_STATS_FUNCTIONS_H_
+#define _NEUTON_DSP_STAT_SEGMENT_STATS_FUNCTIONS_H_
+
+#include <neuton/dsp/neuton_dsp_types.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief INT16 segment partial aggregates
+ */
+typedef struct neuton_dsp_segment_stats_i16_s
+{
+    /** Number of samples */
+    neuton_u16_t num;
+
+    /** Minimum value */
+    neuton_i16_t min;
+
+    /** Maximum value */
+    neuton_i16_t max;
+
+    /** First sample, used to count the zero crossing on the border of merged segments */
+    neuton_i16_t first;
+
+    /** Last sample, used to count the zero crossing on the border of merged segments */
+    neuton_i16_t last;
+
+    /** Number of sign changes between the adjacent samples */
+    neuton_u16_t crossings;
+
+    /** Sum of samples */
+    neuton_i64_t sum;
+
+    /** Total sum of squares of samples */
+    neuton_u64_t tss;
+} neuton_dsp_segment_stats_i16_t;
+
+/**
+ * @brief Calculate partial aggregates of a INT16 segment in a single pass.
+ *
+ * @param[in]   p_input   Pointer to the input vector
+ * @param[in]   num       Number of samples in input vector
+ * @param[out]  p_stats   Pointer to the segment aggregates @ref neuton_dsp_segment_stats_i16_t
+ */
+void neuton_dsp_segment_stats_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_segment_stats_i16_t* p_stats);
+
+/**
+ * @brief Calculate partial aggregates of the INT16 vector segments in a single pass,
+ *        vector is split to segments_num equal segments, the remainder is added to the last segment
+ *        the same way as the input window is split to subwindows.
+ *
+ * @param[in]   p_input         Pointer to the input vector
+ * @param[in]   num             Number of samples in input vector, should not be less than segments_num
+ * @param[in]   segments_num    Number of segments
+ * @param[out]  p_segments      Pointer to the array of segments_num aggregates
+ */
+void neuton_dsp_segment_stats_split_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                        neuton_u16_t segments_num,
+                                        neuton_dsp_segment_stats_i16_t* p_segments);
+
+/**
+ * @brief Merge aggregates of the segment and the segment, that follows it
+ *
+ * @param[in]   p_head    Pointer to the aggregates of the first segment
+ * @param[in]   p_tail    Pointer to the aggregates of the following segment
+ * @param[out]  p_output  Pointer to the aggregates of the joined segment, could be the same as p_head
+ */
+void neuton_dsp_segment_stats_merge_i16(const neuton_dsp_segment_stats_i16_t* p_head,
+                                        const neuton_dsp_segment_stats_i16_t* p_tail,
+                                        neuton_dsp_segment_stats_i16_t*       p_output);
+
+/**
+ * @brief Zero-crossing rate from the segment aggregates, same as @ref neuton_dsp_zcr_i16
+ *
+ * @param[in]   p_stats   Pointer to the segment aggregates
+ *
+ * @return  neuton_i16_t  Zero-crossing rate
+ */
+neuton_i16_t neuton_dsp_segment_stats_zcr_i16(const neuton_dsp_segment_stats_i16_t* p_stats);
+
+/**
+ * @brief Fill the statistics context from the segment aggregates, so the other statistics functions
+ *        will reuse <pre> p_ctx->value.sum, p_ctx->value.tss </pre> instead of recalculation
+ *
+ * @param[in]   p_stats   Pointer to the segment aggregates
+ * @param[out]  p_ctx     Pointer to the statistics context
+ */
+void neuton_dsp_segment_stats_to_ctx_i16(const neuton_dsp_segment_stats_i16_t* p_stats,
+                                         neuton_dsp_stat_ctx_i16_t*            p_ctx);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_STAT_SEGMENT_STATS_FUNCTIONS_H_ */
+
+/**
+ * @}
+ */
@@ -55,6 +55,114 @@ void neuton_dsp_clip_i16(neuton_i16_t*      p_input,
                          const neuton_i16_t min,
                          const neuton_i16_t max);
 
+/**
+ * @brief Clips interleaved multichannel floating-point values to the per-channel limits (min[ch], max[ch])
+ *
+ * @param[in, out] p_input       Pointer to the input vector of interleaved channels samples
+ * @param[in]      num           Number of samples in the input vector, should be a multiple of channels_num
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ */
+void neuton_dsp_clip_channels_f32(neuton_f32_t*       p_input,
+                                  neuton_u16_t        num,
+                                  const neuton_f32_t* p_min,
+                                  const neuton_f32_t* p_max,
+                                  neuton_u16_t        channels_num);
+
+/**
+ * @brief Clips interleaved multichannel INT8 values to the per-channel limits (min[ch], max[ch])
+ *
+ * @param[in, out] p_input       Pointer to the input vector of interleaved channels samples
+ * @param[in]      num           Number of samples in the input vector, should be a multiple of channels_num
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ */
+void neuton_dsp_clip_channels_i8(neuton_i8_t*       p_input,
+                                 neuton_u16_t       num,
+                                 const neuton_i8_t* p_min,
+                                 const neuton_i8_t* p_max,
+                                 neuton_u16_t       channels_num);
+
+/**
+ * @brief Clips interleaved multichannel INT16 values to the per-channel limits (min[ch], max[ch])
+ *
+ * @note Two samples of the frame are clipped at once with the dual halfword max/min,
+ *       the input vector and the limits need only the INT16 alignment
+ *
+ * @param[in, out] p_input       Pointer to the input vector of interleaved channels samples
+ * @param[in]      num           Number of samples in the input vector, should be a multiple of channels_num
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ */
+void neuton_dsp_clip_channels_i16(neuton_i16_t*       p_input,
+                                  neuton_u16_t        num,
+                                  const neuton_i16_t* p_min,
+                                  const neuton_i16_t* p_max,
+                                  neuton_u16_t        channels_num);
+
+/**
+ * @brief Clips the block of the interleaved multichannel floating-point stream in place to the per-channel limits,
+ *        the block could start and end in the middle of the channels frame
+ *
+ * @param[in, out] p_input       Pointer to the block of interleaved channels samples
+ * @param[in]      num           Number of samples in the block
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ * @param[in]      channel       Channel of the first sample in the block
+ *
+ * @return Channel of the first sample in the next block
+ */
+neuton_u16_t neuton_dsp_clip_channels_stream_f32(neuton_f32_t*       p_input,
+                                                 neuton_u16_t        num,
+                                                 const neuton_f32_t* p_min,
+                                                 const neuton_f32_t* p_max,
+                                                 neuton_u16_t        channels_num,
+                                                 neuton_u16_t        channel);
+
+/**
+ * @brief Clips the block of the interleaved multichannel INT8 stream in place to the per-channel limits,
+ *        the block could start and end in the middle of the channels frame
+ *
+ * @param[in, out] p_input       Pointer to the block of interleaved channels samples
+ * @param[in]      num           Number of samples in the block
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ * @param[in]      channel       Channel of the first sample in the block
+ *
+ * @return Channel of the first sample in the next block
+ */
+neuton_u16_t neuton_dsp_clip_channels_stream_i8(neuton_i8_t*       p_input,
+                                                neuton_u16_t       num,
+                                                const neuton_i8_t* p_min,
+                                                const neuton_i8_t* p_max,
+                                                neuton_u16_t       channels_num,
+                                                neuton_u16_t       channel);
+
+/**
+ * @brief Clips the block of the interleaved multichannel INT16 stream in place to the per-channel limits,
+ *        the block could start and end in the middle of the channels frame
+ *
+ * @param[in, out] p_input       Pointer to the block of interleaved channels samples
+ * @param[in]      num           Number of samples in the block
+ * @param[in]      p_min         Pointer to the minimum limits of channels_num channels
+ * @param[in]      p_max         Pointer to the maximum limits of channels_num channels
+ * @param[in]      channels_num  Number of the interleaved channels
+ * @param[in]      channel       Channel of the first sample in the block
+ *
+ * @return Channel of the first sample in the next block
+ */
+neuton_u16_t neuton_dsp_clip_channels_stream_i16(neuton_i16_t*       p_input,
+                                                 neuton_u16_t        num,
+                                                 const neuton_i16_t* p_min,
+                                                 const neuton_i16_t* p_max,
+                                                 neuton_u16_t        channels_num,
+                                                 neuton_u16_t        channel);
+
 /** @def neuton_dsp_clip
  *
  * @brief Macro for clipping variable to the limit (min, max). 
@@ -0,0 +1,155 @@
+/**
+ *
+ * @defgroup neuton_dsp_support_q_stats Quantization with Saturation Statistics
+ * @{
+ * @ingroup neuton_dsp_support
+ *
+ * @brief Quantization of the interleaved multichannel floating-point stream with per-channel scale factors,
+ *        which counts the saturated elements of each channel, e.g. to detect a wrong sensor range setting
+ *        in production. Optionally the scale factor of the channel is decreased after the block (one call),
+ *        in which the channel has too many saturated elements.
+ *
+ */
+#ifndef _NEUTON_DSP_SUPPORT_QUANTIZATION_STATS_H_
+#define _NEUTON_DSP_SUPPORT_QUANTIZATION_STATS_H_
+
+#include <neuton/neuton_types.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Factor of the channel scale adaptation, applied after the block with saturated elements
+ */
+#ifndef NEUTON_DSP_QUANTIZE_ADAPT_FACTOR
+#define NEUTON_DSP_QUANTIZE_ADAPT_FACTOR    (0.5f)
+#endif
+
+/**
+ * @brief Quantization saturation statistics context
+ */
+typedef struct neuton_dsp_quantize_stats_s
+{
+    neuton_f32_t* p_scales;        /**< Scale factor of each channel, the input value is multiplied by it before quantization */
+    neuton_u32_t* p_saturated_num; /**< Number of saturated elements of each channel since the last reset */
+    neuton_u32_t  frames_num;      /**< Number of quantized elements of each channel since the last reset */
+    neuton_u16_t  channels_num;    /**< Number of the interleaved channels */
+
+    /** Number of saturated elements of the channel in one block, at which the channel scale is
+        multiplied by NEUTON_DSP_QUANTIZE_ADAPT_FACTOR, 0 disables the adaptation */
+    neuton_u16_t  adapt_threshold;
+    neuton_u16_t  adaptations_num; /**< Number of the channel scale adaptations since the last reset */
+} neuton_dsp_quantize_stats_t;
+
+/**
+ * @brief Initialize the quantization statistics context, set all channel scales to the initial scale
+ *
+ * @param[out] p_stats          Pointer to the statistics context
+ * @param[in]  p_scales         Pointer to the channel scale factors buffer of channels_num items
+ * @param[in]  p_saturated_num  Pointer to the channel saturated counters buffer of channels_num items
+ * @param[in]  channels_num     Number of the interleaved channels
+ * @param[in]  scale            Initial scale factor, e.g. NEUTON_INT16_QFACTOR for the [-1, 1] input range
+ * @param[in]  adapt_threshold  Saturated elements number of the channel in one block to adapt its scale,
+ *                              0 disables the adaptation
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_quantize_stats_init(neuton_dsp_quantize_stats_t* p_stats,
+                                               neuton_f32_t*                p_scales,
+                                               neuton_u32_t*                p_saturated_num,
+                                               neuton_u16_t                 channels_num,
+                                               neuton_f32_t                 scale,
+                                               neuton_u16_t                 adapt_threshold);
+
+/**
+ * @brief Reset the saturation counters, the channel scale factors are kept
+ *
+ * @param[in, out] p_stats      Pointer to the statistics context
+ */
+void neuton_dsp_quantize_stats_reset(neuton_dsp_quantize_stats_t* p_stats);
+
+/**
+ * @brief Get the ratio of the saturated elements of the channel since the last reset
+ *
+ * @param[in] p_stats           Pointer to the statistics context
+ * @param[in] channel           Channel index
+ *
+ * @return Saturated elements ratio in range [0, 1], 0 if nothing is quantized yet
+ */
+neuton_f32_t neuton_dsp_quantize_stats_saturation_ratio(const neuton_dsp_quantize_stats_t* p_stats,
+                                                        neuton_u16_t                       channel);
+
+/**
+ * @brief Quantize the interleaved floating-point vector to INT8 vector and count the saturated elements
+ *
+ * @par Scaling and Overflow Behavior:
+ *      The function uses saturating arithmetic, the element is counted as saturated
+ *      if its scaled value is out of the INT8 range [0x80 0x7F].
+ *      NaN is quantized to 0 and is counted as saturated.
+ *
+ * @note Only the whole frames of channels_num samples are quantized, the trailing num % channels_num samples
+ *       of the output are not written and are not counted in frames_num.
+ *
+ * @param[in]      p_input      Points to the floating-point input vector
+ * @param[out]     p_out        Points to the INT8 output vector
+ * @param[in]      num          Number of samples in input and output vector, should be a multiple of channels_num
+ * @param[in, out] p_stats      Pointer to the statistics context
+ */
+void neuton_dsp_quantize_stats_f32_to_i8(const neuton_f32_t*          p_input,
+                                         neuton_i8_t*                 p_out,
+                                         neuton_u16_t                 num,
+                                         neuton_dsp_quantize_stats_t* p_stats);
+
+/**
+ * @brief Quantize the interleaved floating-point vector to INT16 vector and count the saturated elements
+ *
+ * @par Scaling and Overflow Behavior:
+ *      The function uses saturating arithmetic, the element is counted as saturated
+ *      if its scaled value is out of the INT16 range [0x8000 0x7FFF].
+ *      NaN is quantized to 0 and is counted as saturated.
+ *
+ * @note Only the whole frames of channels_num samples are quantized, the trailing num % channels_num samples
+ *       of the output are not written and are not counted in frames_num.
+ *
+ * @param[in]      p_input      Points to the floating-point input vector
+ * @param[out]     p_out        Points to the INT16 output vector
+ * @param[in]      num          Number of samples in input and output vector, should be a multiple of channels_num
+ * @param[in, out] p_stats      Pointer to the statistics context
+ */
+void neuton_dsp_quantize_stats_f32_to_i16(const neuton_f32_t*          p_input,
+                                          neuton_i16_t*                p_out,
+                                          neuton_u16_t                 num,
+                                          neuton_dsp_quantize_stats_t* p_stats);
+
+/**
+ * @brief Quantize the interleaved floating-point vector to INT32 vector and count the saturated elements
+ *
+ * @par Scaling and Overflow Behavior:
+ *      The function uses saturating arithmetic, the element is counted as saturated
+ *      if its scaled value is out of the INT32 range [0x80000000 0x7FFFFFFF].
+ *      NaN is quantized to 0 and is counted as saturated.
+ *
+ * @note Only the whole frames of channels_num samples are quantized, the trailing num % channels_num samples
+ *       of the output are not written and are not counted in frames_num.
+ *
+ * @param[in]      p_input      Points to the floating-point input vector
+ * @param[out]     p_out        Points to the INT32 output vector
+ * @param[in]      num          Number of samples in input and output vector, should be a multiple of channels_num
+ * @param[in, out] p_stats      Pointer to the statistics context
+ */
+void neuton_dsp_quantize_stats_f32_to_i32(const neuton_f32_t*          p_input,
+                                          neuton_i32_t*                p_out,
+                                          neuton_u16_t                 num,
+                                          neuton_dsp_quantize_stats_t* p_stats);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_SUPPORT_QUANTIZATION_STATS_H_ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,276 @@
+/**
+ *
+ * @defgroup neuton_dsp_support_running_median Running Median and MAD
+ * @{
+ * @ingroup neuton_dsp_support
+ *
+ * @brief Sliding window Median and Median Absolute Deviation with O(log w) update per sample,
+ *        the window is kept in two indexed heaps (max-heap of the lower half and min-heap of the upper half)
+ *        sharing a single array with the Median in the middle, so the oldest sample is replaced in place.
+ *        All memory is taken from the caller provided pool, see @ref NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE
+ *        and @ref NEUTON_DSP_RUNNING_MAD_POOL_SIZE.
+ *
+ */
+#ifndef _NEUTON_DSP_SUPPORT_RUNNING_MEDIAN_H_
+#define _NEUTON_DSP_SUPPORT_RUNNING_MEDIAN_H_
+
+#include <neuton/neuton_types.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Memory pool size in bytes required for the running median of 'window' samples of 'type'
+ */
+#define NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(window, type) \
+    ((size_t)(window) * (sizeof(type) + sizeof(neuton_i16_t) + sizeof(neuton_u16_t)))
+
+/**
+ * @brief Memory pool size in bytes required for the running MAD of 'window' samples of 'type'
+ */
+#define NEUTON_DSP_RUNNING_MAD_POOL_SIZE(window, type) \
+    (2 * NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(window, type))
+
+/**
+ * @brief Running median context
+ */
+typedef struct neuton_dsp_running_median_ctx_s
+{
+    /** Ring buffer of window samples, accessed according to the function type */
+    union
+    {
+        neuton_i16_t* i16;
+        neuton_f32_t* f32;
+        void*         generic;
+    } p_data;
+
+    /** Heap position of each ring buffer sample, relative to the Median position */
+    neuton_i16_t* p_pos;
+
+    /** Ring buffer indexes of heap nodes, points to the Median node in the middle of heap array */
+    neuton_u16_t* p_heap;
+
+    /** Window size in samples */
+    neuton_u16_t window;
+
+    /** Ring buffer index of the oldest sample */
+    neuton_u16_t index;
+
+    /** Number of samples in the window, less than window size until the window is filled */
+    neuton_u16_t count;
+} neuton_dsp_running_median_ctx_t;
+
+/**
+ * @brief Running Median Absolute Deviation context, MAD is tracked as the running median
+ *        of absolute deviations of each sample from the running median at the moment the sample arrived
+ */
+typedef struct neuton_dsp_running_mad_ctx_s
+{
+    /** Running median of samples */
+    neuton_dsp_running_median_ctx_t median;
+
+    /** Running median of absolute deviations */
+    neuton_dsp_running_median_ctx_t deviation;
+} neuton_dsp_running_mad_ctx_t;
+
+/**
+ * @brief Initialize floating-point running median context
+ *
+ * @param[out]  p_ctx       Pointer to the running median context
+ * @param[in]   window      Window size in samples, should not exceed 32767
+ * @param[in]   p_pool      Pointer to the memory pool, should be aligned to 4 bytes
+ * @param[in]   pool_size   Memory pool size in bytes,
+ *                          at least NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(window, neuton_f32_t)
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_running_median_init_f32(neuton_dsp_running_median_ctx_t* p_ctx,
+                                                   neuton_u16_t window,
+                                                   void* p_pool, size_t pool_size);
+
+/**
+ * @brief Initialize INT16 running median context
+ *
+ * @param[out]  p_ctx       Pointer to the running median context
+ * @param[in]   window      Window size in samples, should not exceed 32767
+ * @param[in]   p_pool      Pointer to the memory pool, should be aligned to 2 bytes
+ * @param[in]   pool_size   Memory pool size in bytes,
+ *                          at least NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(window, neuton_i16_t)
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_running_median_init_i16(neuton_dsp_running_median_ctx_t* p_ctx,
+                                                   neuton_u16_t window,
+                                                   void* p_pool, size_t pool_size);
+
+/**
+ * @brief Reset running median context to the empty window, memory pool is kept
+ *
+ * @param[in, out]  p_ctx   Pointer to the initialized running median context
+ */
+void neuton_dsp_running_median_reset(neuton_dsp_running_median_ctx_t* p_ctx);
+
+/**
+ * @brief Push a new sample to the floating-point running median window,
+ *        replacing the oldest sample when the window is filled
+ *
+ * @param[in, out]  p_ctx   Pointer to the initialized running median context
+ * @param[in]       x       New sample
+ *
+ * @return neuton_f32_t  Median of the samples in the window
+ */
+neuton_f32_t neuton_dsp_running_median_update_f32(neuton_dsp_running_median_ctx_t* p_ctx, neuton_f32_t x);
+
+/**
+ * @brief Push a new sample to the INT16 running median window,
+ *        replacing the oldest sample when the window is filled
+ *
+ * @param[in, out]  p_ctx   Pointer to the initialized running median context
+ * @param[in]       x       New sample
+ *
+ * @return neuton_i16_t  Median of the samples in the window,
+ *                       for even number of samples mean of two middle samples rounded down
+ */
+neuton_i16_t neuton_dsp_running_median_update_i16(neuton_dsp_running_median_ctx_t* p_ctx, neuton_i16_t x);
+
+/**
+ * @brief Initialize floating-point running MAD context
+ *
+ * @param[out]  p_ctx       Pointer to the running MAD context
+ * @param[in]   window      Window size in samples, should not exceed 32767
+ * @param[in]   p_pool      Pointer to the memory pool, should be aligned to 4 bytes
+ * @param[in]   pool_size   Memory pool size in bytes,
+ *                          at least NEUTON_DSP_RUNNING_MAD_POOL_SIZE(window, neuton_f32_t)
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_running_mad_init_f32(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                                neuton_u16_t window,
+                                                void* p_pool, size_t pool_size);
+
+/**
+ * @brief Initialize INT16 running MAD context
+ *
+ * @param[out]  p_ctx       Pointer to the running MAD context
+ * @param[in]   window      Window size in samples, should not exceed 32767
+ * @param[in]   p_pool      Pointer to the memory pool, should be aligned to 2 bytes
+ * @param[in]   pool_size   Memory pool size in bytes,
+ *                          at least NEUTON_DSP_RUNNING_MAD_POOL_SIZE(window, neuton_i16_t)
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_running_mad_init_i16(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                                neuton_u16_t window,
+                                                void* p_pool, size_t pool_size);
+
+/**
+ * @brief Reset running MAD context to the empty window, memory pool is kept
+ *
+ * @param[in, out]  p_ctx   Pointer to the initialized running MAD context
+ */
+void neuton_dsp_running_mad_reset(neuton_dsp_running_mad_ctx_t* p_ctx);
+
+/**
+ * @brief Push a new sample to the floating-point running MAD window
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running MAD context
+ * @param[in]       x           New sample
+ * @param[out]      p_median    Pointer to store Median of the samples in the window, could be NULL
+ *
+ * @return neuton_f32_t  Median Absolute Deviation of the samples in the window
+ */
+neuton_f32_t neuton_dsp_running_mad_update_f32(neuton_dsp_running_mad_ctx_t* p_ctx, neuton_f32_t x,
+                                               neuton_f32_t* p_median);
+
+/**
+ * @brief Push a new sample to the INT16 running MAD window
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running MAD context
+ * @param[in]       x           New sample
+ * @param[out]      p_median    Pointer to store Median of the samples in the window, could be NULL
+ *
+ * @return neuton_i16_t  Median Absolute Deviation of the samples in the window,
+ *                       deviations are saturated to INT16 range
+ */
+neuton_i16_t neuton_dsp_running_mad_update_i16(neuton_dsp_running_mad_ctx_t* p_ctx, neuton_i16_t x,
+                                               neuton_i16_t* p_median);
+
+/**
+ * @brief Streaming median filter of a floating-point vector in place ​​using values ​​in increments of 'stride',
+ *        each sample is replaced by the Median of the window ending at it.
+ *        Window state is kept in the context between calls, so the function could be applied
+ *        to each axis of incoming interleaved samples before feeding them to the model.
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running median context
+ * @param[in, out]  p_inout     Pointer to the input / output vector
+ * @param[in]       num         Number of samples with 'stride' in the vector
+ * @param[in]       stride      Vector element offset stride
+ */
+void neuton_dsp_median_filter_f32_s(neuton_dsp_running_median_ctx_t* p_ctx,
+                                    neuton_f32_t* p_inout, neuton_u16_t num, size_t stride);
+
+/**
+ * @brief Streaming median filter of a INT16 vector in place ​​using values ​​in increments of 'stride',
+ *        each sample is replaced by the Median of the window ending at it.
+ *        Window state is kept in the context between calls, so the function could be applied
+ *        to each axis of incoming interleaved samples before feeding them to the model.
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running median context
+ * @param[in, out]  p_inout     Pointer to the input / output vector
+ * @param[in]       num         Number of samples with 'stride' in the vector
+ * @param[in]       stride      Vector element offset stride
+ */
+void neuton_dsp_median_filter_i16_s(neuton_dsp_running_median_ctx_t* p_ctx,
+                                    neuton_i16_t* p_inout, neuton_u16_t num, size_t stride);
+
+/**
+ * @brief Streaming Hampel spike removal filter of a floating-point vector in place
+ *        ​​using values ​​in increments of 'stride', a sample is replaced by the window Median
+ *        when its absolute deviation from the Median exceeds 'threshold' * MAD.
+ *        Window state is kept in the context between calls, so the function could be applied
+ *        to each axis of incoming interleaved samples before feeding them to the model.
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running MAD context
+ * @param[in, out]  p_inout     Pointer to the input / output vector
+ * @param[in]       num         Number of samples with 'stride' in the vector
+ * @param[in]       stride      Vector element offset stride
+ * @param[in]       threshold   Outlier threshold in MAD units, e.g 3 standard deviations
+ *                              of normal distribution is 3 * 1.4826 = 4.448
+ *
+ * @return neuton_u16_t  Number of replaced samples
+ */
+neuton_u16_t neuton_dsp_hampel_filter_f32_s(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                            neuton_f32_t* p_inout, neuton_u16_t num, size_t stride,
+                                            neuton_f32_t threshold);
+
+/**
+ * @brief Streaming Hampel spike removal filter of a INT16 vector in place
+ *        ​​using values ​​in increments of 'stride', a sample is replaced by the window Median
+ *        when its absolute deviation from the Median exceeds 'threshold' * MAD.
+ *        Window state is kept in the context between calls, so the function could be applied
+ *        to each axis of incoming interleaved samples before feeding them to the model.
+ *
+ * @param[in, out]  p_ctx       Pointer to the initialized running MAD context
+ * @param[in, out]  p_inout     Pointer to the input / output vector
+ * @param[in]       num         Number of samples with 'stride' in the vector
+ * @param[in]       stride      Vector element offset stride
+ * @param[in]       threshold   Outlier threshold in MAD units multiplied by NEUTON_PERCENTAGE_TO_INT_FACTOR,
+ *                              e.g 3 standard deviations of normal distribution is 3 * 1.4826 * 1000 = 4448
+ *
+ * @return neuton_u16_t  Number of replaced samples
+ */
+neuton_u16_t neuton_dsp_hampel_filter_i16_s(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                            neuton_i16_t* p_inout, neuton_u16_t num, size_t stride,
+                                            neuton_u16_t threshold);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_SUPPORT_RUNNING_MEDIAN_H_ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,143 @@
+/**
+ *
+ * @defgroup neuton_dsp_scale_plan Min-Max Scaling Plan
+ * @{
+ * @ingroup neuton_dsp_support
+ *
+ * @brief Min-Max scaling with precomputed reciprocals of the scaling ranges.
+ *
+ *        The plan is built once from the min/max arrays, e.g. INPUT_FEATURES_SCALE_MIN/MAX or
+ *        EXTRACTED_FEATURES_SCALE_MIN/MAX of the model, and then it is applied to every window
+ *        with the multiplication by the range reciprocal instead of the division by the range.
+ *        Scaled values are bit-exact to the division ( y = ((x - min) * qfactor) / (max - min) )
+ *        in 32-bit unsigned arithmetic, that is used by the neural network features scaling,
+ *        including the degenerate ranges: all values are scaled to 0 if min == max, and the inverted
+ *        range (max < min) wraps around as in the division, so the plan is built for any min/max.
+ *
+ */
+#ifndef _NEUTON_DSP_SUPPORT_SCALE_PLAN_H_
+#define _NEUTON_DSP_SUPPORT_SCALE_PLAN_H_
+
+#include <neuton/neuton_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Scaling of one element, saturation bounds and reciprocal of the range
+ */
+typedef struct neuton_dsp_scale_plan_item_s
+{
+    neuton_i32_t min;        /**< Lower saturation bound and scaling offset */
+    neuton_i32_t max;        /**< Upper saturation bound */
+    neuton_u32_t multiplier; /**< Fixed-point reciprocal of the range, 2^32 * (2^shift - range) / range + 1 */
+    neuton_u8_t  shift;      /**< Reciprocal shift, ceil(log2(range)) */
+} neuton_dsp_scale_plan_item_t;
+
+/**
+ * @brief Min-Max scaling plan
+ */
+typedef struct neuton_dsp_scale_plan_s
+{
+    neuton_dsp_scale_plan_item_t* p_items; /**< Pointer to the scaling items buffer */
+
+    /** Number of the scaling items, if it is 1, the same scaling is applied to all elements */
+    neuton_u16_t items_num;
+} neuton_dsp_scale_plan_t;
+
+/**
+ * @brief Build Min-Max scaling plan from INT32 min/max arrays
+ *
+ * @param[out] p_plan       Pointer to the scaling plan
+ * @param[in]  p_items      Pointer to the scaling items buffer of num items
+ * @param[in]  p_min        Pointer to the minimum scaling factors
+ * @param[in]  p_max        Pointer to the maximum scaling factors
+ * @param[in]  num          Number of scaling factors
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_scale_plan_init_i32(neuton_dsp_scale_plan_t*      p_plan,
+                                               neuton_dsp_scale_plan_item_t* p_items,
+                                               const neuton_i32_t*           p_min,
+                                               const neuton_i32_t*           p_max,
+                                               neuton_u16_t                  num);
+
+/**
+ * @brief Build Min-Max scaling plan from INT16 min/max arrays
+ *
+ * @param[out] p_plan       Pointer to the scaling plan
+ * @param[in]  p_items      Pointer to the scaling items buffer of num items
+ * @param[in]  p_min        Pointer to the minimum scaling factors
+ * @param[in]  p_max        Pointer to the maximum scaling factors
+ * @param[in]  num          Number of scaling factors
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_scale_plan_init_i16(neuton_dsp_scale_plan_t*      p_plan,
+                                               neuton_dsp_scale_plan_item_t* p_items,
+                                               const neuton_i16_t*           p_min,
+                                               const neuton_i16_t*           p_max,
+                                               neuton_u16_t                  num);
+
+/**
+ * @brief Min-Max scaling of the INT32 vector to the 16-bit quantized vector ( y = ((x - min) * 65535) / (max - min) )
+ *
+ * @param[in]  p_plan       Pointer to the scaling plan, items_num should be 1 or num
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[in]  num          Number of samples in input vector
+ * @param[out] p_output     Pointer to the output scaled vector, could be the same as p_input
+ */
+void neuton_dsp_scale_plan_apply_i32_q16(const neuton_dsp_scale_plan_t* p_plan,
+                                         const neuton_i32_t*            p_input,
+                                         neuton_u16_t                   num,
+                                         neuton_u16_t*                  p_output);
+
+/**
+ * @brief Min-Max scaling of the INT32 vector to the 8-bit quantized vector ( y = ((x - min) * 255) / (max - min) )
+ *
+ * @param[in]  p_plan       Pointer to the scaling plan, items_num should be 1 or num
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[in]  num          Number of samples in input vector
+ * @param[out] p_output     Pointer to the output scaled vector, could be the same as p_input
+ */
+void neuton_dsp_scale_plan_apply_i32_q8(const neuton_dsp_scale_plan_t* p_plan,
+                                        const neuton_i32_t*            p_input,
+                                        neuton_u16_t                   num,
+                                        neuton_u8_t*                   p_output);
+
+/**
+ * @brief Min-Max scaling of the INT16 vector to the 16-bit quantized vector ( y = ((x - min) * 65535) / (max - min) )
+ *
+ * @param[in]  p_plan       Pointer to the scaling plan, items_num should be 1 or num
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[in]  num          Number of samples in input vector
+ * @param[out] p_output     Pointer to the output scaled vector, could be the same as p_input
+ */
+void neuton_dsp_scale_plan_apply_i16_q16(const neuton_dsp_scale_plan_t* p_plan,
+                                         const neuton_i16_t*            p_input,
+                                         neuton_u16_t                   num,
+                                         neuton_u16_t*                  p_output);
+
+/**
+ * @brief Min-Max scaling of the INT16 vector to the 8-bit quantized vector ( y = ((x - min) * 255) / (max - min) )
+ *
+ * @param[in]  p_plan       Pointer to the scaling plan, items_num should be 1 or num
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[in]  num          Number of samples in input vector
+ * @param[out] p_output     Pointer to the output scaled vector, could be the same as p_input
+ */
+void neuton_dsp_scale_plan_apply_i16_q8(const neuton_dsp_scale_plan_t* p_plan,
+                                        const neuton_i16_t*            p_input,
+                                        neuton_u16_t                   num,
+                                        neuton_u8_t*                   p_output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_SUPPORT_SCALE_PLAN_H_ */
+
+/**
+ * @}
+ */
@@ -4,7 +4,12 @@
  * @{
  * @ingroup neuton_dsp_support
  *
- * @brief
+ * @brief Window functions for the spectral analysis.
+ *
+ *        Window coefficients are kept in the window table, that could be a constant table generated
+ *        at compile time or a buffer filled once at setup with neuton_dsp_window_init_f32() or
+ *        neuton_dsp_window_init_q15(). All windows are symmetric, so the table holds only
+ *        the first half of the coefficients, see @ref NEUTON_DSP_WINDOW_COEFFS_NUM.
  *
  */
 #ifndef _NEUTON_DSP_SUPPORT_WINDOWING_H_
@@ -25,6 +30,111 @@ extern "C"
  */
 void neuton_dsp_window_hanning_f32(neuton_f32_t* p_window, neuton_u16_t window_size);
 
+/**
+ * @brief Number of the window table coefficients for the window of 'size' samples
+ */
+#define NEUTON_DSP_WINDOW_COEFFS_NUM(size)  (((size) + 1U) / 2U)
+
+/**
+ * @brief Window function type
+ */
+typedef enum neuton_dsp_window_type_e
+{
+    NEUTON_DSP_WINDOW_HANN = 0,    /**< Hann window, 0.5 - 0.5 * cos(x) */
+    NEUTON_DSP_WINDOW_HAMMING,     /**< Hamming window, 0.54 - 0.46 * cos(x) */
+    NEUTON_DSP_WINDOW_BLACKMAN,    /**< Blackman window, 0.42 - 0.5 * cos(x) + 0.08 * cos(2x) */
+    NEUTON_DSP_WINDOW_FLATTOP,     /**< Flat-top window, 5-term cosine sum for amplitude accuracy */
+    NEUTON_DSP_WINDOW_TUKEY,       /**< Tukey (tapered cosine) window, parameter is the tapered fraction in [0, 1] */
+} neuton_dsp_window_type_t;
+
+/**
+ * @brief Floating-point window table
+ */
+typedef struct neuton_dsp_window_f32_s
+{
+    const neuton_f32_t* p_coeffs; /**< First NEUTON_DSP_WINDOW_COEFFS_NUM(size) window coefficients */
+    neuton_u16_t        size;     /**< Window size in samples */
+} neuton_dsp_window_f32_t;
+
+/**
+ * @brief Fixed-point Q15 window table
+ */
+typedef struct neuton_dsp_window_q15_s
+{
+    const neuton_i16_t* p_coeffs; /**< First NEUTON_DSP_WINDOW_COEFFS_NUM(size) window coefficients in Q15 format */
+    neuton_u16_t        size;     /**< Window size in samples */
+} neuton_dsp_window_q15_t;
+
+/**
+ * @brief Initialize floating-point window table
+ *
+ * @param[out] p_window     Pointer to the window table
+ * @param[in]  p_coeffs     Pointer to the coefficients buffer of NEUTON_DSP_WINDOW_COEFFS_NUM(size) items
+ * @param[in]  size         Window size in samples
+ * @param[in]  type         Window function type @ref neuton_dsp_window_type_t
+ * @param[in]  param        Window function parameter, the tapered fraction for the Tukey window, otherwise ignored
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_window_init_f32(neuton_dsp_window_f32_t* p_window,
+                                           neuton_f32_t*            p_coeffs,
+                                           neuton_u16_t             size,
+                                           neuton_dsp_window_type_t type,
+                                           neuton_f32_t             param);
+
+/**
+ * @brief Initialize fixed-point Q15 window table, coefficients of 1.0 are saturated to 0x7FFF
+ *
+ * @param[out] p_window     Pointer to the window table
+ * @param[in]  p_coeffs     Pointer to the coefficients buffer of NEUTON_DSP_WINDOW_COEFFS_NUM(size) items
+ * @param[in]  size         Window size in samples
+ * @param[in]  type         Window function type @ref neuton_dsp_window_type_t
+ * @param[in]  param        Window function parameter, the tapered fraction for the Tukey window, otherwise ignored
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_window_init_q15(neuton_dsp_window_q15_t* p_window,
+                                           neuton_i16_t*            p_coeffs,
+                                           neuton_u16_t             size,
+                                           neuton_dsp_window_type_t type,
+                                           neuton_f32_t             param);
+
+/**
+ * @brief Apply floating-point window to the input vector of the window size
+ *
+ * @param[in]  p_window     Pointer to the window table
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[out] p_output     Pointer to the output vector, could be the same as p_input
+ */
+void neuton_dsp_window_apply_f32(const neuton_dsp_window_f32_t* p_window,
+                                 const neuton_f32_t*            p_input,
+                                 neuton_f32_t*                  p_output);
+
+/**
+ * @brief Apply fixed-point Q15 window to the INT16 input vector of the window size, the result is rounded
+ *
+ * @param[in]  p_window     Pointer to the window table
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[out] p_output     Pointer to the output vector, could be the same as p_input
+ */
+void neuton_dsp_window_apply_q15(const neuton_dsp_window_q15_t* p_window,
+                                 const neuton_i16_t*            p_input,
+                                 neuton_i16_t*                  p_output);
+
+/**
+ * @brief Apply fixed-point Q15 window to the INT16 input vector and find the maximum absolute value of the result
+ *        in the same pass, e.g. for the block floating point FFT input normalization
+ *
+ * @param[in]  p_window     Pointer to the window table
+ * @param[in]  p_input      Pointer to the input vector
+ * @param[out] p_output     Pointer to the output vector, could be the same as p_input
+ *
+ * @return Maximum absolute value of the windowed vector
+ */
+neuton_u32_t neuton_dsp_window_apply_max_abs_q15(const neuton_dsp_window_q15_t* p_window,
+                                                 const neuton_i16_t*            p_input,
+                                                 neuton_i16_t*                  p_output);
+
 #ifdef   __cplusplus
 }
 #endif
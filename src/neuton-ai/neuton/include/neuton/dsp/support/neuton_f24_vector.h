@@ -0,0 +1,109 @@
+/**
+ *
+ * @defgroup neuton_dsp_f24_vector Float 24 vector
+ * @{
+ * @ingroup neuton_dsp_support
+ *
+ * @brief Array-level Float24 kernels over structure-of-arrays mantissa/exponent buffers,
+ *        sums are accumulated in a block floating point 64-bit accumulator without per-element function calls.
+ *        The per-element normalization and accumulation are inlined into the kernel loops, so the call is paid
+ *        once per array, the loops themselves are not inlined to keep a single copy of them in flash.
+ *        Sums keep the precision relative to the largest term exponent, normalize the vectors first
+ *        with @ref neuton_f24_vec_normalize when the mantissas are not left aligned
+ *
+ */
+#ifndef _NEUTON_DSP_SUPPORT_FLOAT24_VECTOR_H_
+#define _NEUTON_DSP_SUPPORT_FLOAT24_VECTOR_H_
+
+#include <neuton/neuton_types.h>
+#include <neuton/dsp/support/neuton_f24.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Container for Float24 vector in structure-of-arrays representation
+ *
+ */
+typedef struct neuton_f24_vec_s
+{
+    /** Mantissas buffer */
+    neuton_u16_t* p_man;
+
+    /** Exponents with sign buffer, the same encoding as in @ref neuton_f24_t */
+    neuton_u8_t* p_exps;
+} neuton_f24_vec_t;
+
+/**
+ * @brief Convert INT16 vector to normalized Float24 vector
+ *
+ * @param[in]   p_input     Pointer to the input vector
+ * @param[in]   num         Number of samples in the input vector
+ * @param[out]  p_output    Pointer to the output Float24 vector, mantissas are left aligned to keep the maximum precision
+ */
+void neuton_f24_vec_from_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                             const neuton_f24_vec_t* p_output);
+
+/**
+ * @brief Normalize Float24 vector in place, mantissas are left aligned with CLZ
+ *        to keep the maximum precision in the following operations
+ *
+ * @param[in, out]  p_vec   Pointer to the Float24 vector
+ * @param[in]       num     Number of samples in the vector
+ */
+void neuton_f24_vec_normalize(const neuton_f24_vec_t* p_vec, neuton_u16_t num);
+
+/**
+ * @brief Scale Float24 vector (x[i] * scale) -> y[i]
+ *
+ * @param[in]   p_input     Pointer to the input Float24 vector
+ * @param[in]   num         Number of samples in the vector
+ * @param[in]   scale       Scale factor
+ * @param[out]  p_output    Pointer to the output Float24 vector, can be the same as p_input
+ */
+void neuton_f24_vec_scale(const neuton_f24_vec_t* p_input, neuton_u16_t num,
+                          neuton_f24_t scale, const neuton_f24_vec_t* p_output);
+
+/**
+ * @brief Sum of Float24 vector elements
+ *
+ * @param[in]   p_input     Pointer to the input Float24 vector
+ * @param[in]   num         Number of samples in the vector
+ *
+ * @return neuton_f24_t Sum of elements
+ */
+neuton_f24_t neuton_f24_vec_sum(const neuton_f24_vec_t* p_input, neuton_u16_t num);
+
+/**
+ * @brief Sum of squares of Float24 vector elements
+ *
+ * @param[in]   p_input     Pointer to the input Float24 vector
+ * @param[in]   num         Number of samples in the vector
+ *
+ * @return neuton_f24_t Sum of squares
+ */
+neuton_f24_t neuton_f24_vec_sum_sq(const neuton_f24_vec_t* p_input, neuton_u16_t num);
+
+/**
+ * @brief Dot product of two Float24 vectors
+ *
+ * @param[in]   p_x         Pointer to the first Float24 vector
+ * @param[in]   p_y         Pointer to the second Float24 vector
+ * @param[in]   num         Number of samples in the vectors
+ *
+ * @return neuton_f24_t Dot product
+ */
+neuton_f24_t neuton_f24_vec_dot(const neuton_f24_vec_t* p_x, const neuton_f24_vec_t* p_y,
+                                neuton_u16_t num);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_SUPPORT_FLOAT24_VECTOR_H_ */
+
+/**
+ * @}
+ */
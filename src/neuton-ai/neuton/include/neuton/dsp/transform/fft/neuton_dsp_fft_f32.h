@@ -11,6 +11,7 @@
 #define _NEUTON_DSP_TRANSFORM_FFT_F32_H_
 
 #include <neuton/neuton_types.h>
+#include <neuton/dsp/support/neuton_dsp_windowing.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -90,6 +91,23 @@ void neuton_dsp_rfft_rdx_f32(const neuton_dsp_rfft_f32_t*     p_rfft,
                              neuton_f32_t*                    p_output,
                              neuton_dsp_cfft_radix_func_f32_t radix_func);
 
+/**
+ * @brief   The floating-point real FFT of the windowed input.
+ *          The window is applied while the input is placed to the FFT buffer,
+ *          so the input is kept and no extra buffer pass is needed.
+ *
+ * @param[in]   p_rfft      Pointer to instance of real FFT structure @ref neuton_dsp_rfft_f32_t
+ * @param[in]   p_window    Pointer to the window table of p_rfft->len size @ref neuton_dsp_window_f32_t
+ * @param[in]   p_input     Pointer to buffer with p_rfft->len input samples, could be the same as p_output
+ * @param[out]  p_output    Pointer to the FFT buffer, the results are written in the same fashion as
+ *                          by @ref neuton_dsp_rfft_f32
+ * @return Operation status @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_rfft_windowed_f32(neuton_dsp_rfft_f32_t*         p_rfft,
+                                             const neuton_dsp_window_f32_t* p_window,
+                                             const neuton_f32_t*            p_input,
+                                             neuton_f32_t*                  p_output);
+
 /**
  * @brief Initialize complex FFT instance structure
  *
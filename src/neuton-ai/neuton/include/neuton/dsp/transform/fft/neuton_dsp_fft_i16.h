@@ -11,6 +11,7 @@
 #define _NEUTON_DSP_TRANSFORM_FFT_I16_H_
 
 #include <neuton/neuton_types.h>
+#include <neuton/dsp/support/neuton_dsp_windowing.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -161,6 +162,82 @@ void neuton_dsp_cfft_radix4_i16(const neuton_dsp_cfft_i16_t* p_cfft, neuton_i16_
  */
 void neuton_dsp_cfft_radix4by2_i16(const neuton_dsp_cfft_i16_t* p_cfft, neuton_i16_t* p_input);
 
+/**
+ * @brief   The fixed-point 16-bit block floating point complex FFT function.
+ *          Radix-2 in-place algorithm, the whole buffer shares a single exponent. Before each stage
+ *          the input is down-shifted only as much as is needed to guarantee the stage can not overflow,
+ *          and small signals are normalized up to the full 16-bit range before the first stage,
+ *          so precision is kept compared to the unconditional per-stage scaling of @ref neuton_dsp_cfft_i16.
+ *          Output is always bit reversed back to natural order, no scratch buffer is required.
+ *
+ * @param[in]       p_cfft      Pointer to instance of complex FFT structure @ref neuton_dsp_cfft_i16_t,
+ *                              only len and p_twiddle are used
+ * @param[in, out]  p_inout     Pointer to buffer with input samples, the FFT computes in-place and
+ *                              will modify input buffer with FFT results. The results will be written to input array in the
+ *                              interleaved fashion: <pre>{real[0], imag[0], real[1], imag[1], ...} </pre>
+ *                              The buffer is only required to be halfword aligned
+ * @param[out]      p_exponent  Block exponent of the result, the spectrum is equal to p_inout[i] * 2^(*p_exponent)
+ *
+ * @return Operation status @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_cfft_bfp_i16(const neuton_dsp_cfft_i16_t* p_cfft,
+                                        neuton_i16_t*                p_inout,
+                                        neuton_i8_t*                 p_exponent);
+
+/**
+ * @brief   The fixed-point 16-bit block floating point real FFT function.
+ *          Computes p_rfft->len points real FFT in-place of the input buffer using
+ *          @ref neuton_dsp_cfft_bfp_i16 of p_rfft->len / 2 points and block floating point real split stage.
+ *
+ * @param[in]       p_rfft      Pointer to instance of real FFT structure @ref neuton_dsp_rfft_i16_t
+ * @param[in, out]  p_inout     Pointer to buffer with p_rfft->len real input samples, will be overwritten with
+ *                              p_rfft->len / 2 complex bins in the interleaved fashion:
+ *                              <pre>{real[0], real[N/2], real[1], imag[1], ..., real[N/2-1], imag[N/2-1]} </pre>
+ *                              imaginary parts of the DC and Nyquist bins are zero, so the Nyquist real part is packed in place of imag[0]
+ * @param[out]      p_exponent  Block exponent of the result, the spectrum is equal to p_inout[i] * 2^(*p_exponent)
+ *
+ * @return Operation status @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_rfft_bfp_i16(const neuton_dsp_rfft_i16_t* p_rfft,
+                                        neuton_i16_t*                p_inout,
+                                        neuton_i8_t*                 p_exponent);
+
+/**
+ * @brief   The fixed-point 16-bit real FFT of the windowed input.
+ *          The window is applied while the input is placed to the FFT buffer,
+ *          so the input is kept and no extra buffer pass is needed.
+ *
+ * @param[in]   p_rfft      Pointer to instance of real FFT structure @ref neuton_dsp_rfft_i16_t
+ * @param[in]   p_window    Pointer to the Q15 window table of p_rfft->len size @ref neuton_dsp_window_q15_t
+ * @param[in]   p_input     Pointer to buffer with p_rfft->len input samples, could be the same as p_output
+ * @param[out]  p_output    Pointer to the FFT buffer, the results are written in the same fashion as
+ *                          by @ref neuton_dsp_rfft_i16
+ * @return Operation status @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_rfft_windowed_i16(const neuton_dsp_rfft_i16_t*   p_rfft,
+                                             const neuton_dsp_window_q15_t* p_window,
+                                             const neuton_i16_t*            p_input,
+                                             neuton_i16_t*                  p_output);
+
+/**
+ * @brief   The fixed-point 16-bit block floating point real FFT of the windowed input.
+ *          The window is applied while the input is placed to the FFT buffer together with
+ *          the search of the maximum for the input normalization, so it takes no extra buffer pass.
+ *
+ * @param[in]   p_rfft      Pointer to instance of real FFT structure @ref neuton_dsp_rfft_i16_t
+ * @param[in]   p_window    Pointer to the Q15 window table of p_rfft->len size @ref neuton_dsp_window_q15_t
+ * @param[in]   p_input     Pointer to buffer with p_rfft->len input samples, could be the same as p_output
+ * @param[out]  p_output    Pointer to the FFT buffer, the results are written in the same fashion as
+ *                          by @ref neuton_dsp_rfft_bfp_i16
+ * @param[out]  p_exponent  Block exponent of the result, the spectrum is equal to p_output[i] * 2^(*p_exponent)
+ * @return Operation status @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_rfft_bfp_windowed_i16(const neuton_dsp_rfft_i16_t*   p_rfft,
+                                                 const neuton_dsp_window_q15_t* p_window,
+                                                 const neuton_i16_t*            p_input,
+                                                 neuton_i16_t*                  p_output,
+                                                 neuton_i8_t*                   p_exponent);
+
 /**
  * @brief Generate fixed-point 16 bit real twiddle factors buffer:
  * 
@@ -0,0 +1,157 @@
+/**
+ *
+ * @defgroup neuton_dsp_transform_mel_filterbank Mel Filterbank
+ * @{
+ * @ingroup neuton_dsp_transform
+ *
+ * @brief Sparse triangular mel filterbank for the power spectrum of @ref neuton_dsp_rfht_f32 or
+ *        @ref neuton_dsp_rfht_i16.
+ *
+ *        Each mel band keeps only its nonzero range of the FHT bins and the weights of these bins,
+ *        the weights of all bands are stored one after another in the weights table. Each bin belongs
+ *        to at most two neighbouring bands, so the weights table has at most
+ *        @ref NEUTON_DSP_MEL_FILTERBANK_WEIGHTS_NUM items and the filterbank is applied with
+ *        a single sparse accumulation instead of the mel scale computation for each bin of each frame.
+ *
+ *        The filterbank could be built once at setup with neuton_dsp_mel_filterbank_init_f32() or
+ *        neuton_dsp_mel_filterbank_init_q15(), or could reference the constant bands and weights tables
+ *        generated at build time for the fixed window size, sample rate and number of bands,
+ *        e.g. dumped from the filterbank initialized on the host.
+ *
+ *        The bands are the same as in @ref neuton_dsp_melspectr_make_f32, the floating-point
+ *        band energies are accumulated in the same order and are equal to its values before log10.
+ *
+ */
+#ifndef _NEUTON_DSP_TRANSFORM_MEL_FILTERBANK_H_
+#define _NEUTON_DSP_TRANSFORM_MEL_FILTERBANK_H_
+
+#include <neuton/neuton_types.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/** Maximum number of the filterbank weights for the FHT window of 'window_size' samples */
+#define NEUTON_DSP_MEL_FILTERBANK_WEIGHTS_NUM(window_size)  (window_size)
+
+/**
+ * Right shift of the Q15 filterbank band energies, the energy has
+ * (power fraction bits + 15 - NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT) fraction bits
+ */
+#define NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT     7
+
+/**
+ * @brief Nonzero range of the mel band
+ */
+typedef struct neuton_dsp_mel_band_s
+{
+    neuton_u16_t start_bin;      /**< First FHT bin of the band */
+    neuton_u16_t bins_num;       /**< Number of the band bins, 0 if no bins fall into the band */
+    neuton_u16_t weights_offset; /**< Offset of the band bins weights in the weights table */
+} neuton_dsp_mel_band_t;
+
+/**
+ * @brief Floating-point mel filterbank
+ */
+typedef struct neuton_dsp_mel_filterbank_f32_s
+{
+    const neuton_dsp_mel_band_t* p_bands;     /**< Ranges of bands_num mel bands */
+    const neuton_f32_t*          p_weights;   /**< Bins weights of all bands */
+    neuton_u16_t                 bands_num;   /**< Number of the mel bands */
+    neuton_u16_t                 window_size; /**< FHT window size in samples */
+} neuton_dsp_mel_filterbank_f32_t;
+
+/**
+ * @brief Fixed-point Q15 mel filterbank
+ */
+typedef struct neuton_dsp_mel_filterbank_q15_s
+{
+    const neuton_dsp_mel_band_t* p_bands;     /**< Ranges of bands_num mel bands */
+    const neuton_i16_t*          p_weights;   /**< Bins weights of all bands in Q15 format */
+    neuton_u16_t                 bands_num;   /**< Number of the mel bands */
+    neuton_u16_t                 window_size; /**< FHT window size in samples */
+} neuton_dsp_mel_filterbank_q15_t;
+
+/**
+ * @brief Initialize floating-point mel filterbank
+ *
+ * @param[out] p_filterbank   Pointer to the mel filterbank
+ * @param[out] p_bands        Pointer to the bands buffer of freq_bands items
+ * @param[out] p_weights      Pointer to the weights buffer of NEUTON_DSP_MEL_FILTERBANK_WEIGHTS_NUM(window_size) items
+ * @param[in]  window_size    FHT window size in samples
+ * @param[in]  sample_rate    Sample rate of the signal
+ * @param[in]  freq_bands     Count of mel frequency bands
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_mel_filterbank_init_f32(neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                                   neuton_dsp_mel_band_t*           p_bands,
+                                                   neuton_f32_t*                    p_weights,
+                                                   neuton_u16_t                     window_size,
+                                                   neuton_u16_t                     sample_rate,
+                                                   neuton_u16_t                     freq_bands);
+
+/**
+ * @brief Initialize fixed-point Q15 mel filterbank
+ *
+ * @param[out] p_filterbank   Pointer to the mel filterbank
+ * @param[out] p_bands        Pointer to the bands buffer of freq_bands items
+ * @param[out] p_weights      Pointer to the weights buffer of NEUTON_DSP_MEL_FILTERBANK_WEIGHTS_NUM(window_size) items
+ * @param[in]  window_size    FHT window size in samples
+ * @param[in]  sample_rate    Sample rate of the signal
+ * @param[in]  freq_bands     Count of mel frequency bands
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_mel_filterbank_init_q15(neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                   neuton_dsp_mel_band_t*           p_bands,
+                                                   neuton_i16_t*                    p_weights,
+                                                   neuton_u16_t                     window_size,
+                                                   neuton_u16_t                     sample_rate,
+                                                   neuton_u16_t                     freq_bands);
+
+/**
+ * @brief Apply floating-point mel filterbank to the power spectrum
+ *
+ * @param[in]  p_filterbank   Pointer to the mel filterbank
+ * @param[in]  p_power        Power spectrum of window_size / 2 FHT bins
+ * @param[out] p_output       Energies of bands_num mel bands
+ */
+void neuton_dsp_mel_filterbank_apply_f32(const neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                         const neuton_f32_t*                    p_power,
+                                         neuton_f32_t*                          p_output);
+
+/**
+ * @brief Apply fixed-point Q15 mel filterbank to the power spectrum
+ *
+ * @param[in]  p_filterbank   Pointer to the mel filterbank
+ * @param[in]  p_power        Non-negative power spectrum of window_size / 2 FHT bins
+ * @param[out] p_output       Energies of bands_num mel bands, see @ref NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT
+ */
+void neuton_dsp_mel_filterbank_apply_q15(const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                         const neuton_i16_t*                    p_power,
+                                         neuton_u32_t*                          p_output);
+
+/**
+ * @brief Energy of the single mel band of the fixed-point Q15 mel filterbank
+ *
+ * @param[in]  p_filterbank   Pointer to the mel filterbank
+ * @param[in]  band           Mel band index
+ * @param[in]  p_power        Non-negative power spectrum of window_size / 2 FHT bins
+ *
+ * @return Energy of the mel band, see @ref NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT
+ */
+neuton_u32_t neuton_dsp_mel_filterbank_band_q15(const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                neuton_u16_t                           band,
+                                                const neuton_i16_t*                    p_power);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_TRANSFORM_MEL_FILTERBANK_H_ */
+
+/**
+ * @}
+ */
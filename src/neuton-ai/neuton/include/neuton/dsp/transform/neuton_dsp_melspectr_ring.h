@@ -0,0 +1,187 @@
+/**
+ *
+ * @defgroup neuton_dsp_transform_melspec_ring Ring-buffered Mel-Spectrogram
+ * @{
+ * @ingroup neuton_dsp_transform
+ *
+ * @brief Mel-spectrogram with the circular time axis for the streaming input.
+ *
+ *        Each pushed frame is transformed with @ref neuton_dsp_rfht_f32 or @ref neuton_dsp_rfht_i16 and
+ *        its mel column replaces the oldest column of the ring, so only the newest frame is computed
+ *        per hop and the other columns are neither recomputed nor moved.
+ *        The mel bands are accumulated with the sparse mel filterbank built once at setup,
+ *        see @ref neuton_dsp_transform_mel_filterbank.
+ *        The spectrogram is accessed in the time order as one or two contiguous spans of columns
+ *        @ref neuton_dsp_melspectr_span_t, or is copied into the linear buffer in the same layout as
+ *        @ref neuton_dsp_melspectr_ctx_f32_t p_melspectrum.
+ *
+ *        Floating-point columns are equal to the columns of @ref neuton_dsp_melspectr_make_f32.
+ *        INT16 columns are the same log10 mel energies in the fixed-point format with
+ *        @ref NEUTON_DSP_MELSPECTR_LOG_FRACT_BITS fraction bits, computed with integer arithmetic only.
+ *
+ */
+#ifndef _NEUTON_DSP_TRANSFORM_MELSPECTROGRAM_RING_H_
+#define _NEUTON_DSP_TRANSFORM_MELSPECTROGRAM_RING_H_
+
+#include <neuton/dsp/neuton_dsp_types.h>
+#include "neuton_dsp_rfht.h"
+#include "neuton_dsp_mel_filterbank.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/** Fraction bits of the INT16 mel-spectrogram log10 values, the zero energy is NEUTON_INT16_MIN */
+#define NEUTON_DSP_MELSPECTR_LOG_FRACT_BITS     10
+
+/**
+ * @brief Ring-buffered mel-spectrogram context
+ */
+typedef struct neuton_dsp_melspectr_ring_s
+{
+    /** Ring of time_bands columns of freq_bands mel values */
+    union
+    {
+        neuton_f32_t* f32;
+        neuton_i16_t* i16;
+        void*         generic;
+    } p_ring;
+
+    /** Mel filterbank of freq_bands bands for the FHT window */
+    union
+    {
+        const neuton_dsp_mel_filterbank_f32_t* f32;
+        const neuton_dsp_mel_filterbank_q15_t* q15;
+    } p_filterbank;
+
+    /** FHT instance, its window is set to the pushed frame */
+    neuton_dsp_rfht_instance_t fht;
+
+    /** Count of mel frequency bands in column */
+    neuton_u16_t freq_bands;
+
+    /** Count of columns in spectrogram */
+    neuton_u16_t time_bands;
+
+    /** Position of the next column in the ring */
+    neuton_u16_t head;
+
+    /** Number of the valid columns, the spectrogram is ready when it is equal to time_bands */
+    neuton_u16_t filled;
+} neuton_dsp_melspectr_ring_t;
+
+/**
+ * @brief Mel-spectrogram columns in the time order, the oldest columns are in the first span
+ */
+typedef struct neuton_dsp_melspectr_span_s
+{
+    const void*  p_first;    /**< First span of columns */
+    const void*  p_second;   /**< Second span of columns, wrapped to the ring start */
+    neuton_u16_t first_num;  /**< Number of columns in the first span */
+    neuton_u16_t second_num; /**< Number of columns in the second span, 0 if the spectrogram is not wrapped */
+} neuton_dsp_melspectr_span_t;
+
+/**
+ * @brief Initialize floating-point ring-buffered mel-spectrogram
+ *
+ * @param[out] p_ctx          Pointer to the mel-spectrogram context
+ * @param[in]  p_fht          Pointer to the initialized FHT instance, its window pointer is not used
+ * @param[in]  p_filterbank   Pointer to the initialized mel filterbank of the FHT window size, it defines freq_bands
+ * @param[in]  p_ring         Pointer to the ring buffer of freq_bands * time_bands values
+ * @param[in]  time_bands     Count of columns in spectrogram
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_melspectr_ring_init_f32(neuton_dsp_melspectr_ring_t*           p_ctx,
+                                                   const neuton_dsp_rfht_instance_t*      p_fht,
+                                                   const neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                                   neuton_f32_t*                          p_ring,
+                                                   neuton_u16_t                           time_bands);
+
+/**
+ * @brief Initialize INT16 ring-buffered mel-spectrogram
+ *
+ * @param[out] p_ctx          Pointer to the mel-spectrogram context
+ * @param[in]  p_fht          Pointer to the initialized FHT instance, its window pointer is not used
+ * @param[in]  p_filterbank   Pointer to the initialized mel filterbank of the FHT window size, it defines freq_bands
+ * @param[in]  p_ring         Pointer to the ring buffer of freq_bands * time_bands values
+ * @param[in]  time_bands     Count of columns in spectrogram
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_dsp_melspectr_ring_init_i16(neuton_dsp_melspectr_ring_t*           p_ctx,
+                                                   const neuton_dsp_rfht_instance_t*      p_fht,
+                                                   const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                   neuton_i16_t*                          p_ring,
+                                                   neuton_u16_t                           time_bands);
+
+/**
+ * @brief Push the newest floating-point frame, its mel column replaces the oldest column
+ *
+ * @param[in, out] p_ctx      Pointer to the mel-spectrogram context
+ * @param[in, out] p_frame    Frame of window_size samples, FHT is performed in place
+ *
+ * @return NEUTON_STATUS_SUCCESS if all time_bands columns are valid, NEUTON_STATUS_INPROGRESS otherwise
+ */
+neuton_status_t neuton_dsp_melspectr_ring_push_f32(neuton_dsp_melspectr_ring_t* p_ctx, neuton_f32_t* p_frame);
+
+/**
+ * @brief Push the newest INT16 frame, its mel column replaces the oldest column
+ *
+ * @param[in, out] p_ctx      Pointer to the mel-spectrogram context
+ * @param[in, out] p_frame    Frame of window_size samples, FHT is performed in place
+ *
+ * @return NEUTON_STATUS_SUCCESS if all time_bands columns are valid, NEUTON_STATUS_INPROGRESS otherwise
+ */
+neuton_status_t neuton_dsp_melspectr_ring_push_i16(neuton_dsp_melspectr_ring_t* p_ctx, neuton_i16_t* p_frame);
+
+/**
+ * @brief Drop the oldest columns, so that the spectrogram is ready again after shift new columns
+ *
+ * @param[in, out] p_ctx      Pointer to the mel-spectrogram context
+ * @param[in]      shift      Number of columns to drop, all columns are dropped if it is not less than time_bands
+ */
+void neuton_dsp_melspectr_ring_shift(neuton_dsp_melspectr_ring_t* p_ctx, neuton_u16_t shift);
+
+/**
+ * @brief Get the valid floating-point columns as two spans in the time order
+ *
+ * @param[in]  p_ctx          Pointer to the mel-spectrogram context
+ * @param[out] p_span         Columns spans
+ */
+void neuton_dsp_melspectr_ring_view_f32(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_dsp_melspectr_span_t* p_span);
+
+/**
+ * @brief Get the valid INT16 columns as two spans in the time order
+ *
+ * @param[in]  p_ctx          Pointer to the mel-spectrogram context
+ * @param[out] p_span         Columns spans
+ */
+void neuton_dsp_melspectr_ring_view_i16(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_dsp_melspectr_span_t* p_span);
+
+/**
+ * @brief Copy the valid floating-point columns in the time order to the linear buffer
+ *
+ * @param[in]  p_ctx          Pointer to the mel-spectrogram context
+ * @param[out] p_output       Pointer to the buffer of freq_bands * time_bands values
+ */
+void neuton_dsp_melspectr_ring_copy_f32(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_f32_t* p_output);
+
+/**
+ * @brief Copy the valid INT16 columns in the time order to the linear buffer
+ *
+ * @param[in]  p_ctx          Pointer to the mel-spectrogram context
+ * @param[out] p_output       Pointer to the buffer of freq_bands * time_bands values
+ */
+void neuton_dsp_melspectr_ring_copy_i16(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_i16_t* p_output);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_DSP_TRANSFORM_MELSPECTROGRAM_RING_H_ */
+
+/**
+ * @}
+ */
@@ -55,6 +55,34 @@ neuton_status_t neuton_nn_feed_inputs(neuton_nn_t* p_nn,
  */
 neuton_status_t neuton_nn_run_inference(neuton_nn_t* p_nn);
 
+/**
+ * @brief Run model inference over a batch of already processed model input vectors,
+ *        e.g. extracted features of windows queued after a burst read or an offline replay
+ *
+ * @details Each neuron is evaluated for all vectors of the batch before the next one, so neuron weights
+ *          are read once per NEUTON_NN_BATCH_CHUNK_SIZE vectors instead of once per vector.
+ *          Results are equal to neuton_nn_run_inference() for the same model input vectors.
+ *          Supported for 16-bit quantized models in the separate arrays layout and in all packed layouts:
+ *          16-bit weights, 8-bit weights and fused features scaling.
+ *
+ * @param[in, out] p_nn     Pointer to neural network context @ref neuton_nn_t
+ * @param[in] p_inputs      Array [batch_num][inputs_num] of model input vectors, as they are stored
+ *                          in p_nn->p_dsp->features.extracted_memory (or in the input window for models
+ *                          that use raw input features) after features processing, models with fused
+ *                          features scaling take the unscaled 32-bit features
+ * @param[in] batch_num     Number of model input vectors in the batch
+ * @param[out] p_neurons    Array [batch_num][neurons_num] of neurons values, @ref neuton_nn_model_neurons_num()
+ * @param[out] p_outputs    Array [batch_num][outputs_num] of model outputs, @ref neuton_nn_model_outputs_num(),
+ *                          output values have the same type as p_nn->model.output.memory
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_run_inference_batch(neuton_nn_t* p_nn,
+                                              const void*  p_inputs,
+                                              neuton_u16_t batch_num,
+                                              void*        p_neurons,
+                                              void*        p_outputs);
+
 /***********************************************************************************************************************
 Utility variables and functions
 ***********************************************************************************************************************/
@@ -0,0 +1,94 @@
+/**
+ *
+ * @defgroup neuton_nn_cascade Cascaded Inference
+ * @{
+ * @ingroup neuton
+ *
+ * @brief Two-stage classification: a small gate model with a few cheap features is evaluated
+ *        for every input window, and the main model only for the windows passed by the gate,
+ *        e.g. the gate decides idle vs gesture and the main model classifies the gesture.
+ *
+ *        Both models are fed by the same input window that is collected by the main model,
+ *        so the gate model should be trained on the same input features, window size, shift and scaling,
+ *        use only time-domain features and have classification outputs dequantized to floating point.
+ *
+ */
+#ifndef _NEUTON_NN_CASCADE_H_
+#define _NEUTON_NN_CASCADE_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Cascade of the gate and the main models context
+ */
+typedef struct neuton_nn_cascade_s
+{
+    neuton_nn_t* p_gate;          /**< Gate model, evaluated for every input window */
+    neuton_nn_t* p_main;          /**< Main model, evaluated for the windows passed by the gate model */
+    neuton_f32_t pass_threshold;  /**< Minimum gate model probability of the pass class to run the main model */
+    neuton_u16_t pass_class;      /**< Gate model class that passes the window to the main model */
+    neuton_u16_t reject_class;    /**< Main model class that is predicted for the windows rejected by the gate */
+
+    /**
+     * @brief Statistics of the cascade inference
+     */
+    struct
+    {
+        neuton_u32_t windows_num;   /**< Number of input windows evaluated by the gate model */
+        neuton_u32_t main_runs_num; /**< Number of input windows evaluated by the main model */
+    } stats;
+} neuton_nn_cascade_t;
+
+/**
+ * @brief Set up both models of the cascade, should be called first and once instead of neuton_nn_setup()
+ *
+ * @details The gate model input window is switched to the main model input window,
+ *          so its own window memory is not used.
+ *
+ * @param[in, out] p_cascade    Pointer to the cascade context @ref neuton_nn_cascade_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_cascade_setup(neuton_nn_cascade_t* p_cascade);
+
+/**
+ * @brief Feed raw input data to the common input window of the cascade models,
+ *        the same as neuton_nn_feed_inputs() for the main model
+ *
+ * @param[in, out] p_cascade    Pointer to the cascade context @ref neuton_nn_cascade_t
+ * @param[in] p_input_values    Array of the input data samples
+ * @param[in] num_values        Number of the input samples in array, should be a multiple of @ref neuton_nn_uniq_inputs_num()
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_cascade_feed_inputs(neuton_nn_cascade_t* p_cascade,
+                                              void*                p_input_values,
+                                              neuton_u16_t         num_values);
+
+/**
+ * @brief Run the gate model inference and the main model inference if the window is passed by the gate
+ *
+ * @details If the operation is succeeded (NEUTON_STATUS_SUCCESS), the inference result is in
+ *          p_cascade->p_main->decoded_output.classif for both cases. For the rejected window
+ *          the reject_class is predicted with the gate model probability of rejection,
+ *          and probabilities of the other classes are zero.
+ *
+ * @param[in, out] p_cascade    Pointer to the cascade context @ref neuton_nn_cascade_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_cascade_run_inference(neuton_nn_cascade_t* p_cascade);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_CASCADE_H_ */
+
+/**
+ * @}
+ */
@@ -2,6 +2,9 @@
 #define _NEUTON_NN_DSP_PIPELINE_TYPES_H_
 
 #include <neuton/neuton_types.h>
+#include <neuton/dsp/support/neuton_dsp_scale_plan.h>
+#include <neuton/dsp/statistic/neuton_dsp_segment_stats.h>
+#include <neuton/dsp/statistic/neuton_dsp_fused_moments.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -373,12 +376,58 @@ typedef struct neuton_nn_dsp_feature_extraction_s
     const neuton_nn_features_pipeline_ctx_t* p_freqdomain_pipeline;
 } neuton_nn_dsp_feature_extraction_t;
 
+/** Maximum number of segments (subwindows) of the axis window with cached aggregates */
+#ifndef NEUTON_NN_SEGMENT_STATS_MAX
+#define NEUTON_NN_SEGMENT_STATS_MAX    (16U)
+#endif
+
+/**
+ * @brief Segment aggregates of the input window, shared by the segment aggregates features
+ *        of the time-domain pipeline during the segmented features processing
+ */
+typedef struct neuton_nn_segment_stats_cache_s
+{
+    const neuton_i16_t* p_window;     /**< Input window, NULL if the aggregates are not cached */
+    neuton_u16_t        window_size;  /**< Number of samples in the axis window */
+    neuton_u16_t        windows_num;  /**< Number of the axis windows */
+    neuton_u16_t        segments_num; /**< Number of segments (subwindows) of the axis window */
+    neuton_u16_t        cached_axis;  /**< Axis of the cached segments aggregates */
+
+    /** Aggregates of the current pipeline call, shared between the pipeline functions */
+    neuton_dsp_segment_stats_i16_t shared;
+
+    /** Aggregates of the cached axis window segments */
+    neuton_dsp_segment_stats_i16_t segments[NEUTON_NN_SEGMENT_STATS_MAX];
+} neuton_nn_segment_stats_cache_t;
+
+/**
+ * @brief Fused moments of the time-domain pipeline call, shared by the fused moments features
+ *        (neuton_nn_feature_utility_fused_moments_i16() and others) during the features processing
+ */
+typedef struct neuton_nn_fused_moments_cache_s
+{
+    neuton_dsp_fused_moments_i16_t i16; /**< Moments of the INT16 pipeline call */
+    neuton_dsp_fused_moments_f32_t f32; /**< Moments of the floating-point pipeline call */
+} neuton_nn_fused_moments_cache_t;
+
 /**
  * @brief DSP pipeline context structure
  */
 typedef struct neuton_nn_dsp_pipeline_s
 {
     neuton_nn_dsp_feature_extraction_t features; /**< DSP feature extraction context */
+
+    /** Extracted features scaling plan, built from features.meta on the first features scaling,
+     *  could be NULL, kept after the fields of the precompiled features processing */
+    neuton_dsp_scale_plan_t* p_scale_plan;
+
+    /** Segment aggregates of the segmented features processing, could be NULL,
+     *  then the segment aggregates features are calculated for each pipeline call */
+    neuton_nn_segment_stats_cache_t* p_segment_stats;
+
+    /** Fused moments of the features processing, could be NULL,
+     *  then the fused moments features calculate the moments for each pipeline function */
+    neuton_nn_fused_moments_cache_t* p_fused_moments;
 } neuton_nn_dsp_pipeline_t;
 
 #ifdef __cplusplus
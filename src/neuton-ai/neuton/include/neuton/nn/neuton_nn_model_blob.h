@@ -0,0 +1,170 @@
+/**
+ *
+ * @defgroup neuton_nn_model_blob Serialized Model
+ * @{
+ * @ingroup neuton
+ *
+ * @brief Serialized model format and loader, to update the model from a flash partition without reflashing firmware.
+ *
+ *        The blob is a header with the format version, solution ID, model shape and section offsets,
+ *        followed by the model sections (packed neuron records, output neuron indices, features extraction masks,
+ *        features scaling). All values are little-endian and sections are aligned to 8 bytes,
+ *        so the loader points the model context directly to the blob sections without copying,
+ *        e.g. to a memory-mapped (execute-in-place) flash partition or a memory-mapped file on host.
+ *
+ *        The loaded model replaces the parameters of the compiled model context, that keeps
+ *        the neurons, outputs and features buffers, so the blob should have the same shape:
+ *        neurons, outputs and extracted features number, task and features extraction masks number.
+ *        The model generator could pad a smaller model with unlinked neurons to the compiled neurons number.
+ *
+ */
+#ifndef _NEUTON_NN_MODEL_BLOB_H_
+#define _NEUTON_NN_MODEL_BLOB_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Serialized model magic number, "NNMB" in the blob bytes
+ */
+#define NEUTON_NN_BLOB_MAGIC   0x424D4E4EUL
+
+/**
+ * @brief Serialized model format version
+ */
+#define NEUTON_NN_BLOB_VERSION 1
+
+/**
+ * @brief Alignment of the serialized model sections in bytes
+ */
+#define NEUTON_NN_BLOB_ALIGN   8
+
+/**
+ * @brief Serialized model sections
+ */
+typedef enum neuton_nn_blob_section_id_e
+{
+    NEUTON_NN_BLOB_SECTION_RECORDS = 0,       /**< Packed neuron records, 16-bit words */
+    NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES,    /**< Output neuron indices, 16-bit words */
+    NEUTON_NN_BLOB_SECTION_FEATURES_MASKS,    /**< Features extraction masks, 64-bit words */
+    NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN, /**< Extracted features scaling minimums, 32-bit words */
+    NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MAX, /**< Extracted features scaling maximums, 32-bit words */
+    NEUTON_NN_BLOB_SECTION_SOLUTION_ID,       /**< Solution ID, null-terminated string */
+
+    NEUTON_NN_BLOB_SECTION_cnt, /**< Number of serialized model sections */
+} neuton_nn_blob_section_id_t;
+
+/**
+ * @brief Packed neuron records layout of the serialized model
+ */
+typedef enum neuton_nn_blob_layout_e
+{
+    NEUTON_NN_BLOB_LAYOUT_PACKED_Q16 = 0, /**< @ref neuton_nn_model_params_packed_q16_t */
+    NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W,     /**< @ref neuton_nn_model_params_packed_q8w_t */
+    NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED,   /**< @ref neuton_nn_model_params_packed_fused_t */
+} neuton_nn_blob_layout_t;
+
+/**
+ * @brief Serialized model section location
+ */
+typedef struct neuton_nn_blob_section_s
+{
+    neuton_u32_t offset; /**< Offset of the section from the blob start in bytes */
+    neuton_u32_t size;   /**< Size of the section in bytes */
+} neuton_nn_blob_section_t;
+
+/**
+ * @brief Serialized model header
+ */
+typedef struct neuton_nn_blob_header_s
+{
+    neuton_u32_t magic;        /**< NEUTON_NN_BLOB_MAGIC */
+    neuton_u32_t crc32;        /**< CRC-32 (IEEE 802.3) of the blob bytes after this field up to total_size */
+    neuton_u16_t version;      /**< NEUTON_NN_BLOB_VERSION */
+    neuton_u16_t header_size;  /**< Size of the header in bytes */
+    neuton_u32_t total_size;   /**< Size of the blob in bytes, including the header */
+    neuton_u32_t sequence;     /**< Sequence number of the blob, the newest of A/B slots has the greater one */
+    neuton_u16_t layout;       /**< Packed neuron records layout @ref neuton_nn_blob_layout_t */
+    neuton_u16_t task;         /**< Model task @ref neuton_nn_model_task_t */
+    neuton_u16_t neurons_num;  /**< Number of model neurons */
+    neuton_u16_t outputs_num;  /**< Number of model outputs */
+    neuton_u16_t features_num; /**< Number of extracted features */
+    neuton_u16_t masks_num;    /**< Number of features extraction masks */
+
+    neuton_nn_blob_section_t sections[NEUTON_NN_BLOB_SECTION_cnt]; /**< Sections of the blob */
+} neuton_nn_blob_header_t;
+
+/**
+ * @brief Validate the serialized model: header, CRC, sections and neuron records bounds
+ *
+ * @param[in] p_nn          Pointer to the compiled model context @ref neuton_nn_t, the blob shape should match it
+ * @param[in] p_blob        Pointer to the serialized model, aligned to NEUTON_NN_BLOB_ALIGN bytes
+ * @param[in] blob_size     Size of the memory available at p_blob in bytes, e.g. flash partition size
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_blob_validate(const neuton_nn_t* p_nn, const void* p_blob, neuton_u32_t blob_size);
+
+/**
+ * @brief Validate the serialized model and load it to the model context without copying
+ *
+ * @details Model context points to the blob sections after loading, so the blob memory should stay mapped
+ *          and unchanged while the model is used. The model context is not changed if the blob is not valid.
+ *
+ * @param[in, out] p_nn     Pointer to the compiled model context @ref neuton_nn_t, set up by neuton_nn_setup()
+ * @param[in] p_blob        Pointer to the serialized model, aligned to NEUTON_NN_BLOB_ALIGN bytes
+ * @param[in] blob_size     Size of the memory available at p_blob in bytes, e.g. flash partition size
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_blob_load(neuton_nn_t* p_nn, const void* p_blob, neuton_u32_t blob_size);
+
+/**
+ * @brief Load the newest valid serialized model of A/B slots, the other slot is the fallback
+ *
+ * @details The slot with the greater sequence number is loaded first, if it is not valid (e.g. update was interrupted)
+ *          the other slot is loaded. If both slots are not valid, the compiled model is kept.
+ *
+ * @param[in, out] p_nn     Pointer to the compiled model context @ref neuton_nn_t, set up by neuton_nn_setup()
+ * @param[in] p_slot_a      Pointer to the slot A memory
+ * @param[in] p_slot_b      Pointer to the slot B memory
+ * @param[in] slot_size     Size of each slot memory in bytes
+ * @param[out] p_loaded     Pointer to the loaded slot index (0 - A, 1 - B), could be NULL
+ *
+ * @return Neuton operation status code @ref neuton_status_t of the last load attempt
+ */
+neuton_status_t neuton_nn_blob_load_ab(neuton_nn_t*  p_nn,
+                                       const void*   p_slot_a,
+                                       const void*   p_slot_b,
+                                       neuton_u32_t  slot_size,
+                                       neuton_u8_t*  p_loaded);
+
+/**
+ * @brief Serialize the model with packed neuron records, e.g. on host by the model generator
+ *
+ * @param[in] p_nn          Pointer to the model context @ref neuton_nn_t
+ * @param[in] sequence      Sequence number of the blob
+ * @param[out] p_buffer     Pointer to the blob buffer, aligned to NEUTON_NN_BLOB_ALIGN bytes
+ * @param[in] buffer_size   Size of the blob buffer in bytes
+ * @param[out] p_blob_size  Pointer to the size of the serialized model in bytes
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_blob_write(const neuton_nn_t* p_nn,
+                                     neuton_u32_t       sequence,
+                                     void*              p_buffer,
+                                     neuton_u32_t       buffer_size,
+                                     neuton_u32_t*      p_blob_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_MODEL_BLOB_H_ */
+
+/**
+ * @}
+ */
@@ -68,6 +68,119 @@ typedef struct neuton_nn_model_params_q8_s
     neuton_u8_t*       p_neurons;     /**< Pointer to neurons buffer */
 } neuton_nn_model_params_q8_t;
 
+/**
+ * @brief Activation function flag in the first header word of the packed neuron record
+ */
+#define NEUTON_NN_PACKED_ACT_RELU_FLAG  (1U << 15)
+
+/**
+ * @brief Mask of links number in the first header word of the packed neuron record
+ */
+#define NEUTON_NN_PACKED_LINKS_NUM_MASK (NEUTON_NN_PACKED_ACT_RELU_FLAG - 1U)
+
+/**
+ * @brief Number of header words in the packed neuron record
+ */
+#define NEUTON_NN_PACKED_HEADER_WORDS   3
+
+/**
+ * @brief Number of 16-bit words of all packed neuron records of the model
+ */
+#define NEUTON_NN_PACKED_Q16_RECORDS_NUM(neurons_num, weights_num) \
+    ((neurons_num) * NEUTON_NN_PACKED_HEADER_WORDS + 2 * (weights_num))
+
+/**
+ * @brief Model parameters for 16-bit quantized precision in packed record-per-neuron layout,
+ *        each neuron is stored as a sequential record of 16-bit words:
+ *        <pre>
+ *        { internal_links_num | NEUTON_NN_PACKED_ACT_RELU_FLAG, external_links_num, activation_weight,
+ *          { link_index, weight } x internal_links_num,
+ *          { link_index, weight } x external_links_num }
+ *        </pre>
+ *        where internal links refer to the previous neurons and external links refer to the model inputs,
+ *        external link index that is out of the inputs range is the bias input.
+ *        Layout of the pointers is compatible with @ref neuton_nn_model_params_q16_t
+ */
+typedef struct neuton_nn_model_params_packed_q16_s
+{
+    const neuton_u16_t* p_records;     /**< Pointer to packed neuron records */
+    neuton_u32_t        records_num;   /**< Number of 16-bit words in packed neuron records */
+    neuton_u16_t*       p_neurons;     /**< Pointer to neurons buffer */
+} neuton_nn_model_params_packed_q16_t;
+
+/**
+ * @brief Number of header words in the packed neuron record with 8-bit weights
+ */
+#define NEUTON_NN_PACKED_Q8W_HEADER_WORDS 5
+
+/**
+ * @brief Number of 16-bit words of 8-bit weights of the packed neuron record,
+ *        weights are padded to 32-bit words for dual 16-bit MAC instructions
+ */
+#define NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(links_num) ((((links_num) + 3) / 4) * 2)
+
+/**
+ * @brief Maximum number of 16-bit words of all packed neuron records with 8-bit weights of the model
+ */
+#define NEUTON_NN_PACKED_Q8W_RECORDS_NUM(neurons_num, weights_num) \
+    ((neurons_num) * (NEUTON_NN_PACKED_Q8W_HEADER_WORDS + 2) + (weights_num) + ((weights_num) + 1) / 2)
+
+/**
+ * @brief Model parameters with 8-bit per-neuron scaled weights and 16-bit quantized neurons
+ *        in packed record-per-neuron layout, each neuron is stored as a sequential record of 16-bit words:
+ *        <pre>
+ *        { internal_links_num | NEUTON_NN_PACKED_ACT_RELU_FLAG, external_links_num, activation_weight,
+ *          scale_mult, scale_shift,
+ *          link_index x (internal_links_num + external_links_num),
+ *          NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(internal_links_num + external_links_num) words of 8-bit weights }
+ *        </pre>
+ *        The 16-bit quantized weighted sum of the neuron is restored from the 8-bit weights sum as
+ *        <pre> summ = (sum(weight * (value >> 1)) * scale_mult) >> scale_shift </pre>
+ *        Neurons, activation weights and activation functions are the same as in @ref neuton_nn_model_params_q16_t,
+ *        so layout of the pointers is compatible with it.
+ */
+typedef struct neuton_nn_model_params_packed_q8w_s
+{
+    const neuton_u16_t* p_records;     /**< Pointer to packed neuron records */
+    neuton_u32_t        records_num;   /**< Number of 16-bit words in packed neuron records */
+    neuton_u16_t*       p_neurons;     /**< Pointer to neurons buffer */
+} neuton_nn_model_params_packed_q8w_t;
+
+/**
+ * @brief Number of header words in the packed neuron record with fused features scaling
+ */
+#define NEUTON_NN_PACKED_FUSED_HEADER_WORDS 8
+
+/**
+ * @brief Maximum number of 16-bit words of all packed neuron records with fused features scaling of the model
+ */
+#define NEUTON_NN_PACKED_FUSED_RECORDS_NUM(neurons_num, weights_num) \
+    ((neurons_num) * NEUTON_NN_PACKED_FUSED_HEADER_WORDS + 3 * (weights_num))
+
+/**
+ * @brief Model parameters for 16-bit quantized precision in packed record-per-neuron layout
+ *        with the extracted features min/max scaling fused into the neurons external links,
+ *        so the model reads unscaled 32-bit extracted features.
+ *        Each neuron is stored as a sequential record of 16-bit words:
+ *        <pre>
+ *        { internal_links_num | NEUTON_NN_PACKED_ACT_RELU_FLAG, external_links_num, activation_weight,
+ *          fused_shift, fused_bias (64-bit, 4 words from the least significant one),
+ *          { link_index, weight } x internal_links_num,
+ *          { link_index, fused_weight (32-bit, 2 words from the least significant one) } x external_links_num }
+ *        </pre>
+ *        The bias input links are folded into the fused bias, so all external links refer to the extracted features.
+ *        The 16-bit quantized weighted sum of the external links is restored as
+ *        <pre> summ = (fused_bias + sum(fused_weight * feature)) >> fused_shift </pre>
+ *        Neurons, activation weights and activation functions are the same as in @ref neuton_nn_model_params_q16_t,
+ *        so layout of the pointers is compatible with it.
+ */
+typedef struct neuton_nn_model_params_packed_fused_s
+{
+    const neuton_u16_t* p_records;     /**< Pointer to packed neuron records */
+    neuton_u32_t        records_num;   /**< Number of 16-bit words in packed neuron records */
+    neuton_u16_t*       p_neurons;     /**< Pointer to neurons buffer */
+} neuton_nn_model_params_packed_fused_t;
+
 /**
  * @brief Union of model parameters for all supported types
  */
@@ -76,6 +189,10 @@ typedef union neuton_nn_model_params_u
     neuton_nn_model_params_q8_t  q8;  /**< 8-bit quantized parameters */
     neuton_nn_model_params_q16_t q16; /**< 16-bit quantized parameters */
     neuton_nn_model_params_f32_t f32; /**< 32-bit floating point parameters */
+
+    neuton_nn_model_params_packed_q16_t   packed_q16;   /**< 16-bit quantized parameters in packed layout */
+    neuton_nn_model_params_packed_q8w_t   packed_q8w;   /**< 8-bit weights parameters in packed layout */
+    neuton_nn_model_params_packed_fused_t packed_fused; /**< 16-bit quantized parameters with fused features scaling */
 } neuton_nn_model_params_t;
 
 /**
@@ -0,0 +1,137 @@
+/**
+ *
+ * @defgroup neuton_nn_multirate Multi-rate Input
+ * @{
+ * @ingroup neuton
+ *
+ * @brief Model input collected from several axis groups with different sampling rates,
+ *        e.g. accelerometer at 100 Hz, gyroscope at 400 Hz and a slow pressure sensor at 25 Hz.
+ *
+ *        Each group has its own input window with own window size and shift (hop), and its own DSP pipeline.
+ *        The hop of all groups should take the same time, that is the common inference tick,
+ *        e.g. hop of 25 samples at 100 Hz and hop of 100 samples at 400 Hz are both 250 ms.
+ *
+ *        Group features are extracted as soon as the group window is collected, directly into the group part
+ *        of the model extracted features vector, so the DSP load is spread over the tick.
+ *        When windows of all groups are collected for the tick, the features vector is complete
+ *        and the model inference could be run.
+ *
+ *        The model features vector is the concatenation of the groups features in the groups order.
+ *        Only 16-bit integer sliding window groups with time-domain features and 16-bit quantized or
+ *        fused scaling (@ref neuton_nn_model_params_packed_fused_t) features processing are supported.
+ *
+ */
+#ifndef _NEUTON_NN_MULTIRATE_H_
+#define _NEUTON_NN_MULTIRATE_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of axis groups of the multi-rate input
+ */
+#ifndef NEUTON_NN_MULTIRATE_GROUPS_MAX
+#define NEUTON_NN_MULTIRATE_GROUPS_MAX 4
+#endif
+
+/**
+ * @brief Axis group of the multi-rate input
+ */
+typedef struct neuton_nn_multirate_group_s
+{
+    neuton_nn_input_t*        p_input;         /**< Group input window context, INT16 sliding window of the group axes */
+    neuton_nn_dsp_pipeline_t* p_dsp;           /**< Group DSP pipeline, time-domain features of the group axes */
+    neuton_u16_t              rate_hz;         /**< Group sampling rate in Hz */
+    neuton_u16_t              features_offset; /**< Position of the group features in the model features vector,
+                                                    set by neuton_nn_multirate_setup() */
+} neuton_nn_multirate_group_t;
+
+/**
+ * @brief Multi-rate input context
+ */
+typedef struct neuton_nn_multirate_s
+{
+    neuton_nn_t* p_nn; /**< Model context, its own input context is not used for the features extraction */
+
+    neuton_nn_multirate_group_t groups[NEUTON_NN_MULTIRATE_GROUPS_MAX]; /**< Added axis groups */
+    neuton_u16_t                groups_num;                            /**< Number of added axis groups */
+
+    neuton_u32_t tick_us;       /**< Common inference tick period in microseconds, set by neuton_nn_multirate_setup() */
+    neuton_u32_t ready_mask;    /**< Bit mask of the groups, which features are extracted for the current tick */
+    neuton_u16_t overruns_num;  /**< Number of group windows collected twice before the tick was complete,
+                                     the newest group features are used */
+} neuton_nn_multirate_t;
+
+/**
+ * @brief Add axis group to the multi-rate input, should be called before neuton_nn_multirate_setup()
+ *
+ * @param[in, out] p_multirate      Pointer to the multi-rate input context @ref neuton_nn_multirate_t
+ * @param[in] p_input               Pointer to the group input window context
+ * @param[in] p_dsp                 Pointer to the group DSP pipeline
+ * @param[in] rate_hz               Group sampling rate in Hz
+ * @param[out] p_index              Pointer to the added group index, could be NULL
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_multirate_add_group(neuton_nn_multirate_t*    p_multirate,
+                                              neuton_nn_input_t*        p_input,
+                                              neuton_nn_dsp_pipeline_t* p_dsp,
+                                              neuton_u16_t              rate_hz,
+                                              neuton_u16_t*             p_index);
+
+/**
+ * @brief Set up the model and all added groups, should be called once instead of neuton_nn_setup()
+ *
+ * @details Groups hops should take the same time and the groups features should fill
+ *          the model features vector exactly.
+ *
+ * @param[in, out] p_multirate    Pointer to the multi-rate input context @ref neuton_nn_multirate_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_multirate_setup(neuton_nn_multirate_t* p_multirate);
+
+/**
+ * @brief Feed raw input data of the axis group, group features are extracted when its window is collected
+ *
+ * @details All input samples are consumed, samples after the collected window go to the next group window.
+ *
+ * @param[in, out] p_multirate    Pointer to the multi-rate input context @ref neuton_nn_multirate_t
+ * @param[in] group_index         Index of the axis group
+ * @param[in] p_input_values      Array of the group input data samples
+ * @param[in] num_values          Number of the input samples in array, should be a multiple of group axes number
+ *
+ * @return Neuton operation status code @ref neuton_status_t,
+ *         NEUTON_STATUS_SUCCESS if windows of all groups are collected and inference could be run,
+ *         NEUTON_STATUS_INPROGRESS otherwise
+ */
+neuton_status_t neuton_nn_multirate_feed_inputs(neuton_nn_multirate_t* p_multirate,
+                                                neuton_u16_t           group_index,
+                                                void*                  p_input_values,
+                                                neuton_u16_t           num_values);
+
+/**
+ * @brief Run inference of the model on the features of all groups and start the next tick
+ *
+ * @details If the operation is succeeded (NEUTON_STATUS_SUCCESS), the inference result is in
+ *          p_nn->decoded_output, the same as after neuton_nn_run_inference().
+ *
+ * @param[in, out] p_multirate    Pointer to the multi-rate input context @ref neuton_nn_multirate_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t,
+ *         NEUTON_STATUS_INPROGRESS if windows of some groups are not collected yet
+ */
+neuton_status_t neuton_nn_multirate_run_inference(neuton_nn_multirate_t* p_multirate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_MULTIRATE_H_ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,154 @@
+/**
+ *
+ * @defgroup neuton_nn_runtime Multi-model Runtime
+ * @{
+ * @ingroup neuton
+ *
+ * @brief Several models evaluated on the same input data, e.g. separate models for application modes
+ *        and an anomaly detection model, with one input window and one extracted features cache.
+ *
+ *        The input window is collected by the first registered model and shared with the others.
+ *        Features of all models are extracted once per window to the shared features cache by the shared
+ *        DSP pipeline, and each model takes its own features from the cache, so running several models
+ *        doesn't repeat the DSP and switching between the models costs nothing.
+ *
+ *        The shared DSP pipeline is emitted by the generator with the union (bitwise OR) of the models
+ *        features extraction masks and the time-domain pipeline functions of all models in the features order.
+ *        Only 16-bit integer input models with time-domain features and 16-bit quantized or
+ *        fused scaling (@ref neuton_nn_model_params_packed_fused_t) features processing are supported.
+ *
+ */
+#ifndef _NEUTON_NN_RUNTIME_H_
+#define _NEUTON_NN_RUNTIME_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of models registered in the runtime
+ */
+#ifndef NEUTON_NN_RUNTIME_MODELS_MAX
+#define NEUTON_NN_RUNTIME_MODELS_MAX 4
+#endif
+
+/**
+ * @brief Registered model of the runtime
+ */
+typedef struct neuton_nn_runtime_model_s
+{
+    neuton_nn_t*  p_nn;           /**< Model context */
+    neuton_u16_t* p_features_map; /**< Positions of the model extracted features in the shared features cache,
+                                       buffer of p_nn->p_dsp->features.overall_num items */
+    bool          enabled;        /**< Model is evaluated by neuton_nn_runtime_run_inference() */
+} neuton_nn_runtime_model_t;
+
+/**
+ * @brief Multi-model runtime context
+ */
+typedef struct neuton_nn_runtime_s
+{
+    neuton_nn_dsp_pipeline_t* p_shared_dsp; /**< Shared DSP pipeline, that extracts features of all models
+                                                 to the 32-bit features cache in its extracted memory */
+
+    neuton_nn_runtime_model_t models[NEUTON_NN_RUNTIME_MODELS_MAX]; /**< Registered models */
+    neuton_u16_t              models_num;                          /**< Number of registered models */
+} neuton_nn_runtime_t;
+
+/**
+ * @brief RAM usage of the registered model in the runtime
+ */
+typedef struct neuton_nn_runtime_memory_s
+{
+    neuton_u32_t model_bytes;  /**< Neurons, outputs, extracted features and features map of the model */
+    neuton_u32_t shared_bytes; /**< Input window and features cache shared by all models */
+    neuton_u32_t saved_bytes;  /**< Own input window of the model, that is not used in the runtime */
+} neuton_nn_runtime_memory_t;
+
+/**
+ * @brief Register the model in the runtime, should be called before neuton_nn_runtime_setup()
+ *
+ * @param[in, out] p_runtime        Pointer to the runtime context @ref neuton_nn_runtime_t
+ * @param[in] p_nn                  Pointer to the model context, the first registered model collects the input window
+ * @param[in] p_features_map        Buffer of p_nn->p_dsp->features.overall_num items for the features map
+ * @param[out] p_index              Pointer to the registered model index, could be NULL
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_register(neuton_nn_runtime_t* p_runtime,
+                                           neuton_nn_t*         p_nn,
+                                           neuton_u16_t*        p_features_map,
+                                           neuton_u16_t*        p_index);
+
+/**
+ * @brief Set up all registered models, should be called once instead of neuton_nn_setup()
+ *
+ * @details All models are enabled after setup.
+ *
+ * @param[in, out] p_runtime    Pointer to the runtime context @ref neuton_nn_runtime_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_setup(neuton_nn_runtime_t* p_runtime);
+
+/**
+ * @brief Enable or disable evaluation of the registered model, e.g. on application mode switch
+ *
+ * @param[in, out] p_runtime    Pointer to the runtime context @ref neuton_nn_runtime_t
+ * @param[in] index             Registered model index
+ * @param[in] enabled           Model is evaluated by neuton_nn_runtime_run_inference()
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_enable(neuton_nn_runtime_t* p_runtime, neuton_u16_t index, bool enabled);
+
+/**
+ * @brief Feed raw input data to the shared input window,
+ *        the same as neuton_nn_feed_inputs() for the first registered model
+ *
+ * @param[in, out] p_runtime    Pointer to the runtime context @ref neuton_nn_runtime_t
+ * @param[in] p_input_values    Array of the input data samples
+ * @param[in] num_values        Number of the input samples in array, should be a multiple of @ref neuton_nn_uniq_inputs_num()
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_feed_inputs(neuton_nn_runtime_t* p_runtime,
+                                              void*                p_input_values,
+                                              neuton_u16_t         num_values);
+
+/**
+ * @brief Extract features of the shared input window once and run inference of all enabled models
+ *
+ * @details If the operation is succeeded (NEUTON_STATUS_SUCCESS), the inference result of each enabled model
+ *          is in its p_nn->decoded_output, the same as after neuton_nn_run_inference().
+ *
+ * @param[in, out] p_runtime    Pointer to the runtime context @ref neuton_nn_runtime_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_run_inference(neuton_nn_runtime_t* p_runtime);
+
+/**
+ * @brief Get RAM usage of the registered model in the runtime
+ *
+ * @param[in] p_runtime         Pointer to the runtime context @ref neuton_nn_runtime_t
+ * @param[in] index             Registered model index
+ * @param[out] p_memory         Pointer to the model memory usage @ref neuton_nn_runtime_memory_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_runtime_memory(const neuton_nn_runtime_t* p_runtime,
+                                         neuton_u16_t               index,
+                                         neuton_nn_runtime_memory_t* p_memory);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_RUNTIME_H_ */
+
+/**
+ * @}
+ */
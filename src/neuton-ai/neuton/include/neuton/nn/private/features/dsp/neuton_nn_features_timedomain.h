@@ -67,6 +67,11 @@ NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(crest_i16);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(autocorr_i16);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(hjorth_i16);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(lrp_i16);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(utility_fused_moments_i16);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(fused_hjorth_i16);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(utility_segment_stats_i16);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(segment_min_max_range_i16);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(segment_zcr_i16);
 // float32 features declarations
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(min_max_range_f32);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(min_f32);
@@ -97,6 +102,17 @@ NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(crest_f32);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(autocorr_f32);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(hjorth_f32);
 NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(lrp_f32);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(utility_fused_moments_f32);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(fused_skew_kur_f32);
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(fused_hjorth_f32);
+
+/**
+ * @brief Bind the fused moments of the processed DSP pipeline @ref neuton_nn_dsp_pipeline_t.p_fused_moments
+ *        to the fused moments features for the duration of the features processing interface call.
+ *
+ * @param[in] p_cache        Pointer to the fused moments of the pipeline, NULL unbinds the previous ones
+ */
+void neuton_nn_features_fused_moments_bind(neuton_nn_fused_moments_cache_t* p_cache);
 
 #ifdef __cplusplus
 }
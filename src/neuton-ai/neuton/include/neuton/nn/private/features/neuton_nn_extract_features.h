@@ -0,0 +1,30 @@
+#ifndef _NEUTON_NN_PRIVATE_EXTRACT_FEATURES_H_
+#define _NEUTON_NN_PRIVATE_EXTRACT_FEATURES_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Extract DSP features of all input window axes (and subwindows) without scaling.
+ *
+ * Features are extracted by the time-domain and frequency-domain pipelines mask by mask
+ * to the DSP features buffer p_dsp->features.extracted_memory, that is used by
+ * the DSP features processing interfaces before the scaling @ref neuton_nn_process_features_dsp_i16_q16.
+ *
+ * @param[in, out] p_input        Pointer to the input processing context @ref neuton_nn_input_t
+ * @param[in, out] p_dsp          Pointer to the DSP pipeline context @ref neuton_nn_dsp_pipeline_t
+ *
+ * @return Number of extracted features
+ */
+neuton_sz_t extract_features_i8(neuton_nn_input_t* p_input, neuton_nn_dsp_pipeline_t* p_dsp);
+neuton_sz_t extract_features_i16(neuton_nn_input_t* p_input, neuton_nn_dsp_pipeline_t* p_dsp);
+neuton_sz_t extract_features_f32(neuton_nn_input_t* p_input, neuton_nn_dsp_pipeline_t* p_dsp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_EXTRACT_FEATURES_H_ */
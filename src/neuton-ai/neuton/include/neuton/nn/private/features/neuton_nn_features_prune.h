@@ -0,0 +1,109 @@
+#ifndef _NEUTON_NN_PRIVATE_FEATURES_PRUNE_H_
+#define _NEUTON_NN_PRIVATE_FEATURES_PRUNE_H_
+
+#include <neuton/common/neuton_platform.h>
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Index map value of the extracted feature that is not read by the model
+ */
+#define NEUTON_NN_FEATURE_PRUNED NEUTON_UINT16_MAX
+
+/**
+ * @brief Find model inputs that are reachable from the model outputs through the neuron links.
+ *
+ * Neurons are walked backwards from the output neurons, so inputs that are linked only to
+ * the neurons that don't contribute to any output are not marked as used.
+ * External link index that is out of the inputs range is the bias input and is ignored.
+ *
+ * The function has no target dependencies, so it could be used on host by the model generator
+ * or on device for a model loaded to RAM.
+ *
+ * @param[in]  p_model          Pointer to the model context with separate model arrays layout
+ * @param[in]  inputs_num       Number of model inputs
+ * @param[out] p_used_inputs    Bitmask of used model inputs, (inputs_num + 7) / 8 bytes
+ * @param[out] p_used_neurons   Bitmask of neurons reachable from outputs, (neurons_num + 7) / 8 bytes
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_model_used_inputs(const neuton_nn_model_t* p_model,
+                                            neuton_u16_t             inputs_num,
+                                            neuton_u8_t*             p_used_inputs,
+                                            neuton_u8_t*             p_used_neurons);
+
+/**
+ * @brief Clear extraction mask bits of the features that are not used by the model
+ *        and build the map of the extracted features to the compacted features buffer.
+ *
+ * Features are extracted mask by mask, each pipeline function writes its features only for the set mask bits,
+ * in order of the mask bits, so clearing the bit skips the feature computation and shifts
+ * all following features in the extracted features buffer.
+ * Pipeline functions that have no set bits left in all pruned masks could be dropped from the pipeline.
+ *
+ * Only time-domain features masks are supported, since number of frequency-domain features
+ * of the mask bit depends on the extraction arguments.
+ *
+ * @param[in]  p_masks          Extraction masks, one per input feature (and subwindow)
+ * @param[in]  masks_num        Number of extraction masks
+ * @param[in]  p_used_features  Bitmask of used extracted features, @ref neuton_nn_model_used_inputs()
+ * @param[in]  features_num     Number of extracted features, should match the masks
+ * @param[out] p_pruned_masks   Pruned extraction masks, masks_num items, could be the same as p_masks
+ * @param[out] p_index_map      Compacted index of each extracted feature or NEUTON_NN_FEATURE_PRUNED,
+ *                              features_num items
+ * @param[out] p_pruned_num     Number of extracted features after pruning
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_features_prune(const neuton_nn_features_mask_t* p_masks,
+                                         neuton_u16_t                     masks_num,
+                                         const neuton_u8_t*               p_used_features,
+                                         neuton_u16_t                     features_num,
+                                         neuton_nn_features_mask_t*       p_pruned_masks,
+                                         neuton_u16_t*                    p_index_map,
+                                         neuton_u16_t*                    p_pruned_num);
+
+/**
+ * @brief Compact per-feature array (e.g. features scaling min/max) by the features index map,
+ *        items of the pruned features are dropped.
+ *
+ * @param[in]  p_src            Per-feature array, features_num items
+ * @param[out] p_dst            Compacted array, could be the same as p_src
+ * @param[in]  item_size        Size of array item in bytes
+ * @param[in]  p_index_map      Features index map, @ref neuton_nn_features_prune()
+ * @param[in]  features_num     Number of extracted features before pruning
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_features_compact(const void*         p_src,
+                                           void*               p_dst,
+                                           neuton_sz_t         item_size,
+                                           const neuton_u16_t* p_index_map,
+                                           neuton_u16_t        features_num);
+
+/**
+ * @brief Remap external links of the model to the compacted model inputs,
+ *        the bias input is remapped to the new inputs range end.
+ *
+ * @param[in]  p_model          Pointer to the model context with separate model arrays layout
+ * @param[in]  p_index_map      Model inputs index map, @ref neuton_nn_features_prune()
+ * @param[in]  inputs_num       Number of model inputs before pruning
+ * @param[in]  pruned_num       Number of model inputs after pruning
+ * @param[out] p_links          Remapped neuron links, weights_num items, could be the same as model links
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_model_remap_inputs(const neuton_nn_model_t* p_model,
+                                             const neuton_u16_t*      p_index_map,
+                                             neuton_u16_t             inputs_num,
+                                             neuton_u16_t             pruned_num,
+                                             neuton_u16_t*            p_links);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_FEATURES_PRUNE_H_ */
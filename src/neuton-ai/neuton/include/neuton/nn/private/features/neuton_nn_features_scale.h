@@ -0,0 +1,55 @@
+#ifndef _NEUTON_NN_PRIVATE_FEATURES_SCALE_H_
+#define _NEUTON_NN_PRIVATE_FEATURES_SCALE_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Scale the 32-bit extracted features in place to the 16-bit quantized features
+ *        by the extracted features min/max, the same as neuton_nn_process_features_dsp_i16_q16() does.
+ *
+ * The scaling plan of the DSP pipeline (@ref neuton_dsp_scale_plan_t) is built from the features min/max
+ * on the first call and is used for the next calls, so the features are scaled without divisions.
+ * If the DSP pipeline has no scaling plan, the features are scaled by division.
+ *
+ * @param[in, out] p_dsp    Pointer to the DSP pipeline context with extracted features @ref neuton_nn_dsp_pipeline_t
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_features_scale_q16(neuton_nn_dsp_pipeline_t* p_dsp);
+
+/**
+ * @brief Invalidate the scaling plan of the DSP pipeline, should be called when the features min/max are changed,
+ *        the plan is rebuilt on the next features scaling.
+ *
+ * @param[in, out] p_dsp    Pointer to the DSP pipeline context @ref neuton_nn_dsp_pipeline_t
+ */
+void neuton_nn_features_scale_reset(neuton_nn_dsp_pipeline_t* p_dsp);
+
+/**
+ * @brief Check that the features processing interface extracts INT16 DSP features
+ *        and scales them to the 16-bit quantized features.
+ *
+ * @param[in] process_features  Features processing interface
+ *
+ * @return true for neuton_nn_process_features_dsp_i16_q16() and its planned and segmented variants
+ */
+bool neuton_nn_features_is_dsp_i16_q16(neuton_nn_iface_process_features_t process_features);
+
+/**
+ * @brief Check that the features processing interface extracts INT16 DSP features without scaling.
+ *
+ * @param[in] process_features  Features processing interface
+ *
+ * @return true for neuton_nn_process_features_dsp_i16_unscaled() and its segmented variant
+ */
+bool neuton_nn_features_is_dsp_i16_unscaled(neuton_nn_iface_process_features_t process_features);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_FEATURES_SCALE_H_ */
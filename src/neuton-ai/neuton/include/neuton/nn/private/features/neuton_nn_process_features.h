@@ -93,6 +93,47 @@ NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_f32_q8);
 NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_f32_q16);
 NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_f32_f32);
 
+/**
+ * @brief Extract DSP features from input data without scaling.
+ *
+ * The extracted features are left in the 32-bit DSP features buffer for models with
+ * min/max scaling fused into the neurons weights @ref neuton_nn_model_params_packed_fused_t,
+ * so the per-feature scaling pass is skipped.
+ *
+ * @param[in, out] p_input        Pointer to the input processing context @ref neuton_nn_input_t
+ * @param[in, out] p_dsp          Pointer to the DSP pipeline context @ref neuton_nn_dsp_pipeline_t
+ * @return Status code indicating success or error.
+ */
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_unscaled);
+
+/**
+ * @brief Extract DSP features from input data and scale them with the scaling plan.
+ *
+ * Same as neuton_nn_process_features_dsp_i16_q16(), but the extracted features are scaled
+ * with the precomputed reciprocals of the DSP pipeline scaling plan (@ref neuton_nn_dsp_pipeline_t.p_scale_plan)
+ * instead of the division by the features range, scaled features and the returned status are the same.
+ *
+ * @param[in, out] p_input        Pointer to the input processing context @ref neuton_nn_input_t
+ * @param[in, out] p_dsp          Pointer to the DSP pipeline context @ref neuton_nn_dsp_pipeline_t
+ * @return Status code indicating success or error.
+ */
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_q16_planned);
+
+/**
+ * @brief Extract DSP features from input data with the shared segment aggregates.
+ *
+ * Same as neuton_nn_process_features_dsp_i16_q16_planned() and neuton_nn_process_features_dsp_i16_unscaled(),
+ * but the input window layout is bound to the segment aggregates features
+ * (neuton_nn_feature_utility_segment_stats_i16() and others), so the aggregates are calculated
+ * once per subwindow of each axis, and the full window and subwindows features are merged from them.
+ *
+ * @param[in, out] p_input        Pointer to the input processing context @ref neuton_nn_input_t
+ * @param[in, out] p_dsp          Pointer to the DSP pipeline context @ref neuton_nn_dsp_pipeline_t
+ * @return Status code indicating success or error.
+ */
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_q16_segmented);
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_unscaled_segmented);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,99 @@
+#ifndef _NEUTON_NN_PRIVATE_ACTIVATIONS_H_
+#define _NEUTON_NN_PRIVATE_ACTIVATIONS_H_
+
+#include <neuton/neuton_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 16-bit quantized sigmoid activation function evaluation used by the inference of packed models:
+ *        1 - interpolated lookup table, 0 - arithmetic evaluation
+ */
+#ifndef NEUTON_NN_ACTIVATION_LUT_ENABLE
+#define NEUTON_NN_ACTIVATION_LUT_ENABLE 1
+#endif
+
+/**
+ * @brief Sigmoid activation function for 8-bit quantized neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_u8_t  Activated neuron value
+ */
+neuton_u8_t neuton_nn_sigmoid_q8(neuton_u8_t coeff, neuton_i32_t summ);
+
+/**
+ * @brief ReLU activation function for 8-bit quantized neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_u8_t  Activated neuron value
+ */
+neuton_u8_t neuton_nn_relu_q8(neuton_u8_t coeff, neuton_i32_t summ);
+
+/**
+ * @brief Sigmoid activation function for 16-bit quantized neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_u16_t  Activated neuron value
+ */
+neuton_u16_t neuton_nn_sigmoid_q16(neuton_u16_t coeff, neuton_i64_t summ);
+
+/**
+ * @brief ReLU activation function for 16-bit quantized neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_u16_t  Activated neuron value
+ */
+neuton_u16_t neuton_nn_relu_q16(neuton_u16_t coeff, neuton_i64_t summ);
+
+/**
+ * @brief Sigmoid activation function for 32-bit floating point neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_f32_t  Activated neuron value
+ */
+neuton_f32_t neuton_nn_sigmoid_f32(neuton_f32_t coeff, neuton_f32_t summ);
+
+/**
+ * @brief ReLU activation function for 32-bit floating point neuron.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_f32_t  Activated neuron value
+ */
+neuton_f32_t neuton_nn_relu_f32(neuton_f32_t coeff, neuton_f32_t summ);
+
+/**
+ * @brief Sigmoid activation function for 16-bit quantized neuron evaluated by the interpolated lookup table.
+ *        Results are equal to @ref neuton_nn_sigmoid_q16.
+ *
+ * @param[in] coeff   Neuron activation function weight
+ * @param[in] summ    Accumulated sum of weighted neuron inputs
+ *
+ * @return neuton_u16_t  Activated neuron value
+ */
+neuton_u16_t neuton_nn_sigmoid_lut_q16(neuton_u16_t coeff, neuton_i64_t summ);
+
+#if NEUTON_NN_ACTIVATION_LUT_ENABLE == 1
+#define NEUTON_NN_SIGMOID_Q16 neuton_nn_sigmoid_lut_q16
+#else
+#define NEUTON_NN_SIGMOID_Q16 neuton_nn_sigmoid_q16
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_ACTIVATIONS_H_ */
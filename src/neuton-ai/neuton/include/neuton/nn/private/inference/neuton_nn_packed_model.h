@@ -0,0 +1,80 @@
+#ifndef _NEUTON_NN_PRIVATE_PACKED_MODEL_H_
+#define _NEUTON_NN_PRIVATE_PACKED_MODEL_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Convert 16-bit quantized model from separate model arrays layout
+ *        to the packed record-per-neuron layout @ref neuton_nn_model_params_packed_q16_t.
+ *
+ * The function has no target dependencies, so it could be used on host by the model generator
+ * to emit packed records, or on device to pack a model loaded to RAM.
+ *
+ * @param[in]  p_model      Pointer to the model context with @ref neuton_nn_model_params_q16_t parameters
+ * @param[out] p_records    Pointer to the packed records buffer
+ * @param[in]  records_num  Number of 16-bit words in the records buffer,
+ *                          at least NEUTON_NN_PACKED_Q16_RECORDS_NUM(neurons_num, weights_num)
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_model_pack_q16(const neuton_nn_model_t* p_model,
+                                         neuton_u16_t* p_records, neuton_u32_t records_num);
+
+/**
+ * @brief Requantize 16-bit quantized model from separate model arrays layout
+ *        to the packed record-per-neuron layout with 8-bit weights @ref neuton_nn_model_params_packed_q8w_t.
+ *
+ * Weights of each neuron are scaled to the full 8-bit range by its maximum absolute weight,
+ * the scale is stored in the neuron record, so the weighted sum is restored in the 16-bit quantized range
+ * and the same activation functions and outputs propagation could be used.
+ *
+ * @param[in]  p_model        Pointer to the model context with @ref neuton_nn_model_params_q16_t parameters
+ * @param[out] p_records      Pointer to the packed records buffer
+ * @param[in]  records_num    Number of 16-bit words in the records buffer,
+ *                            at least NEUTON_NN_PACKED_Q8W_RECORDS_NUM(neurons_num, weights_num)
+ * @param[out] p_records_used Pointer to the number of 16-bit words written to the records buffer, could be NULL
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_model_requantize_q8w(const neuton_nn_model_t* p_model,
+                                               neuton_u16_t* p_records, neuton_u32_t records_num,
+                                               neuton_u32_t* p_records_used);
+
+/**
+ * @brief Fuse min/max scaling of the extracted features into the 16-bit quantized model
+ *        and convert it to the packed record-per-neuron layout @ref neuton_nn_model_params_packed_fused_t.
+ *
+ * The affine scaling of each feature to the 16-bit quantized range is folded into the weights
+ * of the neuron links that read the feature and into the neuron bias, so the features processing
+ * could skip the scaling pass. The inference clips the features to the scaling range of the DSP pipeline meta
+ * before the fused weights are applied, so p_features_min and p_features_max should be the same ranges.
+ * Neuron outputs are equal to the scaled model ones within the quantization error for any feature values.
+ *
+ * @param[in]  p_model        Pointer to the model context with @ref neuton_nn_model_params_q16_t parameters,
+ *                            that uses only extracted features as input
+ * @param[in]  p_features_min Extracted features scaling minimums, features_num items
+ * @param[in]  p_features_max Extracted features scaling maximums, features_num items
+ * @param[in]  features_num   Number of extracted features
+ * @param[out] p_records      Pointer to the packed records buffer
+ * @param[in]  records_num    Number of 16-bit words in the records buffer,
+ *                            at least NEUTON_NN_PACKED_FUSED_RECORDS_NUM(neurons_num, weights_num)
+ * @param[out] p_records_used Pointer to the number of 16-bit words written to the records buffer, could be NULL
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_model_fuse_scaling_q16(const neuton_nn_model_t* p_model,
+                                                 const neuton_i32_t* p_features_min,
+                                                 const neuton_i32_t* p_features_max,
+                                                 neuton_u16_t features_num,
+                                                 neuton_u16_t* p_records, neuton_u32_t records_num,
+                                                 neuton_u32_t* p_records_used);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_PACKED_MODEL_H_ */
@@ -7,6 +7,14 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of model input vectors that are evaluated together by the batch inference,
+ *        every neuron keeps the weighted sums of the chunk on the stack
+ */
+#ifndef NEUTON_NN_BATCH_CHUNK_SIZE
+#define NEUTON_NN_BATCH_CHUNK_SIZE 16
+#endif
+
 /**
  * @brief Run neural network inference for 8-bit quantized model.
  *
@@ -40,6 +48,40 @@ void neuton_nn_run_model_inference_q16(neuton_nn_t* p_nn);
  */
 void neuton_nn_run_model_inference_f32(neuton_nn_t* p_nn);
 
+/**
+ * @brief Run neural network inference for 16-bit quantized model in packed record-per-neuron layout.
+ *
+ * This function performs the same forward pass as neuton_nn_run_model_inference_q16(), but reads
+ * links, weights and activation parameters of each neuron from a single sequential record
+ * @ref neuton_nn_model_params_packed_q16_t instead of separate model arrays.
+ *
+ * @param[in,out] p_nn Pointer to the neural network context structure (@ref neuton_nn_t).
+ */
+void neuton_nn_run_model_inference_packed_q16(neuton_nn_t* p_nn);
+
+/**
+ * @brief Run neural network inference for model with 8-bit weights in packed record-per-neuron layout.
+ *
+ * This function performs the forward pass of neuton_nn_run_model_inference_packed_q16() with
+ * 8-bit per-neuron scaled weights @ref neuton_nn_model_params_packed_q8w_t. Pairs of weights and
+ * neuron values are multiplied and accumulated by dual 16-bit MAC instructions when they are available.
+ *
+ * @param[in,out] p_nn Pointer to the neural network context structure (@ref neuton_nn_t).
+ */
+void neuton_nn_run_model_inference_packed_q8w(neuton_nn_t* p_nn);
+
+/**
+ * @brief Run neural network inference for 16-bit quantized model with fused features scaling in packed layout.
+ *
+ * This function performs the forward pass of neuton_nn_run_model_inference_packed_q16() on the unscaled
+ * 32-bit extracted features, min/max scaling of the features is fused into the external links weights
+ * and biases of the neurons @ref neuton_nn_model_params_packed_fused_t.
+ * Should be used with neuton_nn_process_features_dsp_i16_unscaled() features processing.
+ *
+ * @param[in,out] p_nn Pointer to the neural network context structure (@ref neuton_nn_t).
+ */
+void neuton_nn_run_model_inference_packed_fused(neuton_nn_t* p_nn);
+
 #ifdef __cplusplus
 }
 #endif
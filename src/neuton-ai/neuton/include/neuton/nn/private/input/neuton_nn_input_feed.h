@@ -85,6 +85,22 @@ NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_masked_i16);
 NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_f32);
 NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_masked_f32);
 
+/**
+ * @brief Feed INT16 input data using sliding windowing with deinterleaving kernels.
+ *
+ * Same as neuton_nn_input_feed_sliding_window_i16() and neuton_nn_input_feed_sliding_window_masked_i16(),
+ * but 3 and 6 axes samples are deinterleaved by pairs with halfword packing @ref neuton_osl_window_feed_fast_i16.
+ * Input with the usage mask is fed by the mask with neuton_nn_input_feed_sliding_window_fast_i16(),
+ * and by the indices list resolved from the usage mask at setup @ref neuton_nn_input_setup_sliding_window_gather
+ * with neuton_nn_input_feed_sliding_window_gather_i16().
+ *
+ * @param[in,out] p_input_ctx   Pointer to the input context structure (@ref neuton_nn_input_t).
+ * @param[in]     p_input_values Pointer to the input values buffer.
+ * @param[in]     num_values     Number of input values to feed.
+ */
+NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_fast_i16);
+NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_gather_i16);
+
 #ifdef __cplusplus
 }
 #endif
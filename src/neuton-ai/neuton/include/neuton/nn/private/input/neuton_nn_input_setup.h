@@ -41,6 +41,18 @@ neuton_status_t neuton_nn_input_setup_discrete_window(neuton_nn_input_t* p_input
  */
 neuton_status_t neuton_nn_input_setup_sliding_window(neuton_nn_input_t* p_input_ctx);
 
+/**
+ * @brief Setup input context for sliding windowing with the gather feeding.
+ *
+ * Same as neuton_nn_input_setup_sliding_window(), and the input features usage mask is resolved
+ * into the list of used features indices for neuton_nn_input_feed_sliding_window_gather_i16().
+ *
+ * @param[in,out] p_input_ctx Pointer to the input context structure (@ref neuton_nn_input_t).
+ * 
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_nn_input_setup_sliding_window_gather(neuton_nn_input_t* p_input_ctx);
+
 #ifdef __cplusplus
 }
 #endif
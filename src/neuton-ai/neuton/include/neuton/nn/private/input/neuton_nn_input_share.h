@@ -0,0 +1,27 @@
+#ifndef _NEUTON_NN_PRIVATE_INPUT_SHARE_H_
+#define _NEUTON_NN_PRIVATE_INPUT_SHARE_H_
+
+#include <neuton/nn/neuton_nn_input_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Check that two models collect the same input window, so one input window could be shared by them.
+ *
+ * Input data type, unique features and their usage mask, window size, shift, subwindows
+ * and input scaling should be the same.
+ *
+ * @param[in] p_a Pointer to the first model input context (@ref neuton_nn_input_t).
+ * @param[in] p_b Pointer to the second model input context (@ref neuton_nn_input_t).
+ *
+ * @return true if the input window could be shared
+ */
+bool neuton_nn_input_is_shareable(const neuton_nn_input_t* p_a, const neuton_nn_input_t* p_b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_NN_PRIVATE_INPUT_SHARE_H_ */
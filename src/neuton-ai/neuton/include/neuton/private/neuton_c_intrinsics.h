@@ -93,6 +93,134 @@ __NEUTON_STATIC_FORCEINLINE neuton_u32_t __ROR(neuton_u32_t op1, neuton_u32_t op
     return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
 }
 
+/**
+ * @brief   Dual sign-extend byte
+ * @details Extracts bytes 0 and 2 of a value and sign-extends them to 16-bit halfwords.
+ * @param [in]    op1  Value with two 8-bit signed values in bytes 0 and 2
+ * @return             Two 16-bit signed values
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t __NEUTON_SXTB16(neuton_u32_t op1)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+    neuton_u32_t result;
+    __asm ("sxtb16 %0, %1" : "=r" (result) : "r" (op1));
+    return result;
+#else
+    const neuton_u16_t lo = (neuton_u16_t)(neuton_i16_t)(neuton_i8_t)(op1 & 0xFFU);
+    const neuton_u16_t hi = (neuton_u16_t)(neuton_i16_t)(neuton_i8_t)((op1 >> 16) & 0xFFU);
+    return (neuton_u32_t)lo | ((neuton_u32_t)hi << 16);
+#endif
+}
+
+/**
+ * @brief   Dual 16-bit signed multiply with 64-bit accumulate
+ * @details Multiplies the bottom and the top halfwords of two values and adds both products to the accumulator.
+ * @param [in]    op1  First two 16-bit signed values
+ * @param [in]    op2  Second two 16-bit signed values
+ * @param [in]    acc  64-bit accumulator
+ * @return             acc + op1[15:0] * op2[15:0] + op1[31:16] * op2[31:16]
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_i64_t __NEUTON_SMLALD(neuton_u32_t op1, neuton_u32_t op2, neuton_i64_t acc)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+    union { neuton_u32_t w32[2]; neuton_i64_t w64; } llr;
+    llr.w64 = acc;
+    __asm ("smlald %0, %1, %2, %3" : "=r" (llr.w32[0]), "=r" (llr.w32[1])
+                                   : "r" (op1), "r" (op2), "0" (llr.w32[0]), "1" (llr.w32[1]));
+    return llr.w64;
+#else
+    return acc + (neuton_i32_t)(neuton_i16_t)op1 * (neuton_i16_t)op2 +
+           (neuton_i32_t)(neuton_i16_t)(op1 >> 16) * (neuton_i16_t)(op2 >> 16);
+#endif
+}
+
+/**
+ * @brief   Pack halfword bottom-top
+ * @details Combines the bottom halfword of the first value with the top halfword of the shifted second value.
+ * @param [in]    op1  Value for the bottom halfword
+ * @param [in]    op2  Value for the top halfword
+ * @param [in]    sh   Constant left shift of op2 (0..31)
+ * @return             op1[15:0] | (op2 << sh)[31:16]
+ */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+#define __NEUTON_PKHBT(op1, op2, sh)                                                     \
+    __extension__({                                                                      \
+        neuton_u32_t __res, __op1 = (op1), __op2 = (op2);                                \
+        __asm ("pkhbt %0, %1, %2, lsl %3" : "=r" (__res) : "r" (__op1), "r" (__op2), "I" (sh)); \
+        __res;                                                                           \
+    })
+#else
+#define __NEUTON_PKHBT(op1, op2, sh) \
+    ((((neuton_u32_t)(op1)) & 0x0000FFFFUL) | ((((neuton_u32_t)(op2)) << (sh)) & 0xFFFF0000UL))
+#endif
+
+/**
+ * @brief   Pack halfword top-bottom
+ * @details Combines the top halfword of the first value with the bottom halfword of the arithmetically shifted second value.
+ * @param [in]    op1  Value for the top halfword
+ * @param [in]    op2  Value for the bottom halfword
+ * @param [in]    sh   Constant right shift of op2 (0..31)
+ * @return             op1[31:16] | (op2 >> sh)[15:0]
+ */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+#define __NEUTON_PKHTB(op1, op2, sh)                                                              \
+    __extension__({                                                                               \
+        neuton_u32_t __res, __op1 = (op1), __op2 = (op2);                                         \
+        if ((sh) == 0)                                                                            \
+            __asm ("pkhtb %0, %1, %2" : "=r" (__res) : "r" (__op1), "r" (__op2));                 \
+        else                                                                                      \
+            __asm ("pkhtb %0, %1, %2, asr %3" : "=r" (__res) : "r" (__op1), "r" (__op2), "I" (sh)); \
+        __res;                                                                                    \
+    })
+#else
+#define __NEUTON_PKHTB(op1, op2, sh) \
+    ((((neuton_u32_t)(op1)) & 0xFFFF0000UL) | (((neuton_u32_t)(((neuton_i32_t)(op2)) >> (sh))) & 0x0000FFFFUL))
+#endif
+
+/**
+ * @brief   Dual 16-bit signed maximum
+ * @details Selects the greater of the bottom and of the top halfwords of two values without branches.
+ * @param [in]    op1  First two 16-bit signed values
+ * @param [in]    op2  Second two 16-bit signed values
+ * @return             max(op1[15:0], op2[15:0]) | max(op1[31:16], op2[31:16]) << 16
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t __NEUTON_SMAX16(neuton_u32_t op1, neuton_u32_t op2)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+    neuton_u32_t result;
+    __asm ("ssub16 %0, %1, %2\n\t"
+           "sel %0, %1, %2" : "=&r" (result) : "r" (op1), "r" (op2) : "cc");
+    return result;
+#else
+    const neuton_i16_t lo = ((neuton_i16_t)op1 > (neuton_i16_t)op2) ? (neuton_i16_t)op1 : (neuton_i16_t)op2;
+    const neuton_i16_t hi = ((neuton_i16_t)(op1 >> 16) > (neuton_i16_t)(op2 >> 16)) ? (neuton_i16_t)(op1 >> 16)
+                                                                                   : (neuton_i16_t)(op2 >> 16);
+    return (neuton_u32_t)(neuton_u16_t)lo | ((neuton_u32_t)(neuton_u16_t)hi << 16);
+#endif
+}
+
+/**
+ * @brief   Dual 16-bit signed minimum
+ * @details Selects the lesser of the bottom and of the top halfwords of two values without branches.
+ * @param [in]    op1  First two 16-bit signed values
+ * @param [in]    op2  Second two 16-bit signed values
+ * @return             min(op1[15:0], op2[15:0]) | min(op1[31:16], op2[31:16]) << 16
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t __NEUTON_SMIN16(neuton_u32_t op1, neuton_u32_t op2)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__GNUC__)
+    neuton_u32_t result;
+    __asm ("ssub16 %0, %1, %2\n\t"
+           "sel %0, %2, %1" : "=&r" (result) : "r" (op1), "r" (op2) : "cc");
+    return result;
+#else
+    const neuton_i16_t lo = ((neuton_i16_t)op1 < (neuton_i16_t)op2) ? (neuton_i16_t)op1 : (neuton_i16_t)op2;
+    const neuton_i16_t hi = ((neuton_i16_t)(op1 >> 16) < (neuton_i16_t)(op2 >> 16)) ? (neuton_i16_t)(op1 >> 16)
+                                                                                   : (neuton_i16_t)(op2 >> 16);
+    return (neuton_u32_t)(neuton_u16_t)lo | ((neuton_u32_t)(neuton_u16_t)hi << 16);
+#endif
+}
+
 /**
   * @brief Clips INT64 to INT32 values.
   */
@@ -0,0 +1,145 @@
+#ifndef _NEUTON_F24_INLINE_H_
+#define _NEUTON_F24_INLINE_H_
+
+#include <neuton/dsp/support/neuton_f24.h>
+
+#include "neuton_c_intrinsics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NEUTON_F24_EXP_NEGATIVE 0x80
+#define NEUTON_F24_EXP_MASK     0x3F
+#define NEUTON_F24_EXP_MAX      ((neuton_i32_t)NEUTON_F24_EXP_MASK)
+#define NEUTON_F24_EXP_MIN      (-(neuton_i32_t)NEUTON_F24_EXP_MASK)
+
+/** Guard bits of the block floating point accumulator below the largest term exponent */
+#define NEUTON_F24_ACC_GUARD_BITS 14
+
+/** Initial exponent of the block floating point accumulator, less than any product exponent */
+#define NEUTON_F24_ACC_EXP_INIT (2 * NEUTON_F24_EXP_MIN - NEUTON_F24_ACC_GUARD_BITS)
+
+/**
+ * @brief Unpack exponent from the Float24 exponent with sign byte
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_i32_t neuton_f24_exps_to_exp_(neuton_u8_t exps)
+{
+    const neuton_i32_t exp = (neuton_i32_t)(exps & NEUTON_F24_EXP_MASK);
+    return (exps & NEUTON_F24_EXP_NEGATIVE) ? -exp : exp;
+}
+
+/**
+ * @brief Pack exponent and sign to the Float24 exponent with sign byte, exponent should be in range
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_u8_t neuton_f24_exp_to_exps_(neuton_i32_t exp, neuton_u8_t sign)
+{
+    return (exp < 0) ? (neuton_u8_t)(NEUTON_F24_EXP_NEGATIVE | sign | (neuton_u8_t)(-exp))
+                     : (neuton_u8_t)(sign | (neuton_u8_t)exp);
+}
+
+/**
+ * @brief Normalize 32-bit magnitude with exponent to Float24 16-bit mantissa using CLZ,
+ *        saturates on exponent overflow and flushes to zero on exponent underflow
+ *
+ * @param[in] man   Magnitude
+ * @param[in] exp   Exponent of the magnitude
+ * @param[in] sign  Sign byte: NEUTON_F24_SIGNED or NEUTON_F24_UNSIGNED
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_f24_t neuton_f24_from_u32_(neuton_u32_t man, neuton_i32_t exp,
+                                                               neuton_u8_t sign)
+{
+    neuton_f24_t res;
+
+    if (man > NEUTON_UINT16_MAX)
+    {
+        const neuton_i32_t shift = 16 - (neuton_i32_t)__NEUTON_CLZ(man);
+        man >>= shift;
+        exp += shift;
+    }
+
+    if (exp > NEUTON_F24_EXP_MAX)
+    {
+        man = NEUTON_UINT16_MAX;
+        exp = NEUTON_F24_EXP_MAX;
+    }
+    else if (exp < NEUTON_F24_EXP_MIN)
+    {
+        const neuton_i32_t shift = NEUTON_F24_EXP_MIN - exp;
+        man = (shift < 16) ? (man >> shift) : 0;
+        exp = NEUTON_F24_EXP_MIN;
+    }
+
+    res.man  = (neuton_u16_t)man;
+    res.exps = neuton_f24_exp_to_exps_(exp, (man != 0) ? sign : NEUTON_F24_UNSIGNED);
+    return res;
+}
+
+/**
+ * @brief Left align Float24 mantissa to the 16th bit to keep the maximum precision in the following operations
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_f24_t neuton_f24_normalize_(neuton_u16_t man, neuton_u8_t exps)
+{
+    neuton_f24_t res = { .man = man, .exps = exps };
+
+    if (man != 0)
+    {
+        const neuton_i32_t exp   = neuton_f24_exps_to_exp_(exps);
+        neuton_i32_t       shift = (neuton_i32_t)__NEUTON_CLZ(man) - 16;
+
+        shift    = ((exp - shift) < NEUTON_F24_EXP_MIN) ? (exp - NEUTON_F24_EXP_MIN) : shift;
+        res.man  = (neuton_u16_t)(man << shift);
+        res.exps = neuton_f24_exp_to_exps_(exp - shift, exps & NEUTON_F24_SIGNED);
+    }
+    return res;
+}
+
+/**
+ * @brief Add the signed term (man * 2^exp) to the block floating point accumulator (acc * 2^acc_exp),
+ *        the accumulator exponent is kept NEUTON_F24_ACC_GUARD_BITS below the largest term exponent,
+ *        so the smaller terms are truncated only below the guard bits. The accumulator can not overflow
+ *        when the term is not wider than 32 bits and less than 2^16 terms are accumulated
+ */
+__NEUTON_STATIC_FORCEINLINE void neuton_f24_acc_add_(neuton_i64_t* p_acc, neuton_i32_t* p_acc_exp,
+                                                     neuton_i64_t term, neuton_i32_t exp)
+{
+    const neuton_i32_t realign = exp - NEUTON_F24_ACC_GUARD_BITS - *p_acc_exp;
+
+    if (realign > 0)
+    {
+        *p_acc = (realign < 63) ? (*p_acc >> realign) : 0;
+        *p_acc_exp += realign;
+    }
+
+    /* Term position in the accumulator, it is up to NEUTON_F24_ACC_GUARD_BITS to the left */
+    const neuton_i32_t shift = exp - *p_acc_exp;
+
+    if (shift >= 0)
+        *p_acc += term * ((neuton_i64_t)1 << shift);
+    else if (shift > -63)
+        *p_acc += term >> -shift;
+}
+
+/**
+ * @brief Convert the block floating point accumulator (acc * 2^acc_exp) to Float24
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_f24_t neuton_f24_from_acc_(neuton_i64_t acc, neuton_i32_t acc_exp)
+{
+    const neuton_u8_t sign = (acc < 0) ? NEUTON_F24_SIGNED : NEUTON_F24_UNSIGNED;
+    neuton_u64_t      mag  = (neuton_u64_t)((acc < 0) ? -acc : acc);
+
+    if ((mag >> 32) != 0)
+    {
+        const neuton_i32_t shift = 32 - (neuton_i32_t)__NEUTON_CLZ((neuton_u32_t)(mag >> 32));
+        mag >>= shift;
+        acc_exp += shift;
+    }
+
+    return neuton_f24_from_u32_((neuton_u32_t)mag, acc_exp, sign);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NEUTON_F24_INLINE_H_ */
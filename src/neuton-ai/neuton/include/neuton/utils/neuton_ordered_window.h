@@ -151,6 +151,53 @@ neuton_u16_t neuton_ordered_window_feed_bymask_i8(neuton_ordered_window_ctx_t* p
 neuton_u16_t neuton_ordered_window_feed_bymask_i16(neuton_ordered_window_ctx_t* p_ctx,
                                                      const neuton_i16_t* p_input, neuton_u16_t num,
                                                      const neuton_u8_t* p_usage_mask);
+
+/**
+ * @brief Feeds INT16 samples to the INT16 ordered by columns window, same as @ref neuton_ordered_window_feed_i16,
+ *        but 3 and 6 unique features are deinterleaved by pairs of samples with 32-bit loads and halfword packing,
+ *        other number of unique features is fed by @ref neuton_ordered_window_feed_i16
+ *
+ * @param[in, out]  p_ctx       Pointer to the window context, should be initialized first @ref neuton_ordered_window_init
+ * @param[in]       p_input     Pointer to the feature sample buffer
+ * @param[in]       num         Number of samples in the input buffer, num = buffer_size / p_ctx->uniq_features_num
+ *
+ * @return neuton_u16_t Number of remaining samples to collect window
+ */
+neuton_u16_t neuton_ordered_window_feed_fast_i16(neuton_ordered_window_ctx_t* p_ctx,
+                                                 const neuton_i16_t* p_input, neuton_u16_t num);
+
+/**
+ * @brief Resolve the input features usage mask into the list of used unique features indices,
+ *        so the mask is not tested for every fed sample
+ *
+ * @param[in]       p_usage_mask        Input features usage mask, each bit represents each unique feature
+ * @param[in]       uniq_features_num   Number of unique features in feature sample
+ * @param[out]      p_indices           Pointer to the indices list
+ * @param[in]       max_indices_num     Capacity of the indices list
+ * @param[out]      p_indices_num       Number of used unique features
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_ordered_window_gather_init(const neuton_u8_t* p_usage_mask,
+                                                  const neuton_u16_t uniq_features_num,
+                                                  neuton_u8_t* p_indices, const neuton_u16_t max_indices_num,
+                                                  neuton_u16_t* p_indices_num);
+
+/**
+ * @brief Feeds INT16 samples to the INT16 ordered by columns window, same as @ref neuton_ordered_window_feed_bymask_i16,
+ *        but used unique features are taken by the indices list @ref neuton_ordered_window_gather_init
+ *
+ * @param[in, out]  p_ctx           Pointer to the window context, should be initialized first @ref neuton_ordered_window_init
+ * @param[in]       p_input         Pointer to the feature sample buffer
+ * @param[in]       num             Number of samples in the input buffer, num = buffer_size / p_ctx->uniq_features_num
+ * @param[in]       p_indices       Used unique features indices
+ * @param[in]       indices_num     Number of used unique features
+ *
+ * @return neuton_u16_t Number of remaining samples to collect window
+ */
+neuton_u16_t neuton_ordered_window_feed_gather_i16(neuton_ordered_window_ctx_t* p_ctx,
+                                                   const neuton_i16_t* p_input, neuton_u16_t num,
+                                                   const neuton_u8_t* p_indices, const neuton_u16_t indices_num);
 #ifdef   __cplusplus
 }
 #endif
@@ -18,6 +18,11 @@ extern "C"
 {
 #endif
 
+/** Maximum number of used unique features in the gather indices list of the window context */
+#ifndef NEUTON_OSL_WINDOW_GATHER_MAX
+#define NEUTON_OSL_WINDOW_GATHER_MAX   (16U)
+#endif
+
 typedef struct neuton_osl_window_ctx_s
 {
     /** Ordered window context */
@@ -30,6 +35,15 @@ typedef struct neuton_osl_window_ctx_s
 
     /** Flag if window should be shifted by window_shift on the next window feed */
     bool is_shift_pending;
+
+    /* Fields below are only used by neuton_osl_window_feed_gather_xx(),
+     * so they are kept after the fields of the precompiled window functions */
+
+    /** Number of used unique features in gather_indices, 0 if the list is not resolved */
+    neuton_u8_t gather_num;
+
+    /** Used unique features indices, resolved from the usage mask @ref neuton_ordered_window_gather_init */
+    neuton_u8_t gather_indices[NEUTON_OSL_WINDOW_GATHER_MAX];
 } neuton_osl_window_ctx_t;
 
 /**
@@ -136,6 +150,43 @@ neuton_u16_t neuton_osl_window_feed_bymask_i8(neuton_osl_window_ctx_t* p_ctx,
 neuton_u16_t neuton_osl_window_feed_bymask_i16(neuton_osl_window_ctx_t* p_ctx,
                                                 const neuton_i16_t* p_input, neuton_u16_t num,
                                                 const neuton_u8_t* p_usage_mask);
+
+/**
+ * @brief Feeds INT16 samples to the INT16 ordered by colums sliding window, same as @ref neuton_osl_window_feed_i16,
+ *        but samples are deinterleaved by @ref neuton_ordered_window_feed_fast_i16
+ *
+ * @param[in, out]  p_ctx       Pointer to the window context, should be initialized first @ref neuton_osl_window_init
+ * @param[in]       p_input     Pointer to the feature sample buffer
+ * @param[in]       num         Number of samples in the input buffer, num = buffer_size / p_ctx->uniq_features_num
+ *
+ * @return neuton_u16_t Number of remaining samples to collect window
+ */
+neuton_u16_t neuton_osl_window_feed_fast_i16(neuton_osl_window_ctx_t* p_ctx,
+                                             const neuton_i16_t* p_input, neuton_u16_t num);
+
+/**
+ * @brief Resolve the input features usage mask into the gather indices list of the window context
+ *
+ * @param[in, out]  p_ctx           Pointer to the window context, should be initialized first @ref neuton_osl_window_init
+ * @param[in]       p_usage_mask    Input features usage mask
+ *
+ * @return Neuton operation status code @ref neuton_status_t
+ */
+neuton_status_t neuton_osl_window_gather_init(neuton_osl_window_ctx_t* p_ctx, const neuton_u8_t* p_usage_mask);
+
+/**
+ * @brief Feeds INT16 samples to the INT16 ordered by colums sliding window, same as @ref neuton_osl_window_feed_bymask_i16,
+ *        but used unique features are taken by the gather indices list @ref neuton_osl_window_gather_init
+ *
+ * @param[in, out]  p_ctx       Pointer to the window context, should be initialized first @ref neuton_osl_window_init
+ *                              and @ref neuton_osl_window_gather_init
+ * @param[in]       p_input     Pointer to the feature sample buffer
+ * @param[in]       num         Number of samples in the input buffer, num = buffer_size / p_ctx->uniq_features_num
+ *
+ * @return neuton_u16_t Number of remaining samples to collect window
+ */
+neuton_u16_t neuton_osl_window_feed_gather_i16(neuton_osl_window_ctx_t* p_ctx,
+                                               const neuton_i16_t* p_input, neuton_u16_t num);
 #ifdef   __cplusplus
 }
 #endif
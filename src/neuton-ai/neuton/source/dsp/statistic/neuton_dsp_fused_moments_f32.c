@@ -0,0 +1,142 @@
+#include <neuton/dsp/statistic/neuton_dsp_fused_moments.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Welford online mean and sum of squared deviations */
+typedef struct welford_f32_s
+{
+    neuton_f32_t mean;
+    neuton_f32_t m2;
+    neuton_u16_t num;
+} welford_f32_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void welford_update_(welford_f32_t* p_w, neuton_f32_t x)
+{
+    p_w->num++;
+
+    const neuton_f32_t delta = x - p_w->mean;
+    p_w->mean += delta / (neuton_f32_t)p_w->num;
+    p_w->m2 += delta * (x - p_w->mean);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_f32_s(const neuton_f32_t* p_input, neuton_u16_t num, size_t stride,
+                                    neuton_dsp_fused_moments_f32_t* p_fm)
+{
+    memset(p_fm, 0, sizeof(*p_fm));
+
+    if (num == 0)
+        return;
+
+    welford_f32_t d1 = { 0 };
+    welford_f32_t d2 = { 0 };
+
+    neuton_f32_t mean = 0, m2 = 0, m3 = 0, m4 = 0;
+    neuton_f32_t prev = p_input[0];
+    neuton_f32_t prev_d1 = 0;
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_f32_t x  = p_input[i * stride];
+        const neuton_f32_t n1 = (neuton_f32_t)i;
+        const neuton_f32_t n  = (neuton_f32_t)(i + 1);
+
+        /* Pebay one-pass update of the central moments up to the 4th order */
+        const neuton_f32_t delta    = x - mean;
+        const neuton_f32_t delta_n  = delta / n;
+        const neuton_f32_t delta_n2 = delta_n * delta_n;
+        const neuton_f32_t term1    = delta * delta_n * n1;
+
+        mean += delta_n;
+        m4 += term1 * delta_n2 * (n * n - 3.0f * n + 3.0f) + 6.0f * delta_n2 * m2 - 4.0f * delta_n * m3;
+        m3 += term1 * delta_n * (n - 2.0f) - 3.0f * delta_n * m2;
+        m2 += term1;
+
+        /* First and second differences */
+        if (i > 0)
+        {
+            const neuton_f32_t diff = x - prev;
+
+            if (i > 1)
+                welford_update_(&d2, diff - prev_d1);
+
+            welford_update_(&d1, diff);
+            prev_d1 = diff;
+        }
+        prev = x;
+    }
+
+    p_fm->num  = num;
+    p_fm->mean = mean;
+    p_fm->m2   = m2;
+    p_fm->m3   = m3;
+    p_fm->m4   = m4;
+
+    p_fm->deriv_var.first  = (d1.num > 0) ? (d1.m2 / (neuton_f32_t)d1.num) : 0;
+    p_fm->deriv_var.second = (d2.num > 0) ? (d2.m2 / (neuton_f32_t)d2.num) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_f32(const neuton_f32_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_fused_moments_f32_t* p_fm)
+{
+    neuton_dsp_fused_moments_f32_s(p_input, num, 1, p_fm);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_to_ctx_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                         neuton_dsp_stat_ctx_f32_t*            p_ctx)
+{
+    const neuton_f32_t num = (neuton_f32_t)p_fm->num;
+
+    p_ctx->value.sum = p_fm->mean * num;
+    p_ctx->value.tss = p_fm->m2 + p_fm->mean * p_fm->mean * num;
+    p_ctx->value.var = (p_fm->num > 0) ? (p_fm->m2 / num) : 0;
+    p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_SUM_TSS_VAR_FLAGS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_get_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                      neuton_dsp_moments_f32_t*             p_m)
+{
+    const neuton_f32_t num = (neuton_f32_t)p_fm->num;
+
+    p_m->moment.var  = 0;
+    p_m->moment.skew = 0;
+    p_m->moment.kur  = 0;
+
+    if ((p_fm->num == 0) || (p_fm->m2 <= 0))
+        return;
+
+    p_m->moment.var  = p_fm->m2 / num;
+    p_m->moment.skew = sqrtf(num) * p_fm->m3 / (p_fm->m2 * sqrtf(p_fm->m2));
+    p_m->moment.kur  = num * p_fm->m4 / (p_fm->m2 * p_fm->m2) - 3.0f;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_hjorth_f32(const neuton_dsp_fused_moments_f32_t* p_fm,
+                                 neuton_dsp_hjorth_params_f32_t*       p_params)
+{
+    const neuton_f32_t var = (p_fm->num > 0) ? (p_fm->m2 / (neuton_f32_t)p_fm->num) : 0;
+
+    p_params->activity   = var;
+    p_params->mobility   = 0;
+    p_params->complexity = 0;
+
+    if ((var <= 0) || (p_fm->deriv_var.first <= 0))
+        return;
+
+    p_params->mobility   = sqrtf(p_fm->deriv_var.first / var);
+    p_params->complexity = sqrtf(p_fm->deriv_var.second / p_fm->deriv_var.first) / p_params->mobility;
+}
@@ -0,0 +1,186 @@
+#include <neuton/dsp/statistic/neuton_dsp_fused_moments.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define NEUTON_PERCENTAGE_TO_INT_FACTOR_SQ \
+    ((neuton_u64_t)NEUTON_PERCENTAGE_TO_INT_FACTOR * NEUTON_PERCENTAGE_TO_INT_FACTOR)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u32_t isqrt_u64_(neuton_u64_t x)
+{
+    neuton_u64_t res = 0;
+    neuton_u64_t bit = (neuton_u64_t)1 << 62;
+
+    while (bit > x)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (x >= res + bit)
+        {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (neuton_u32_t)res;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t var_from_sums_(neuton_i64_t sum, neuton_u64_t sum2,
+                                                        neuton_u32_t num)
+{
+    if (num == 0)
+        return 0;
+
+    const neuton_u64_t abs_sum = (neuton_u64_t)((sum < 0) ? -sum : sum);
+    return (neuton_u32_t)((sum2 - (abs_sum * abs_sum) / num) / num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_i16_s(const neuton_i16_t* p_input, neuton_u16_t num, size_t stride,
+                                    neuton_dsp_fused_moments_i16_t* p_fm)
+{
+    memset(p_fm, 0, sizeof(*p_fm));
+
+    if (num == 0)
+        return;
+
+    const neuton_i32_t pivot = p_input[0];
+
+    neuton_i64_t sum = 0, sum3 = 0;
+    neuton_u64_t sum2 = 0, sum4_hi = 0, sum4_lo = 0;
+    neuton_u64_t d1_sum2 = 0, d2_sum2 = 0;
+
+    neuton_i32_t prev = pivot, prev_d1 = 0, first_d1 = 0;
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_i32_t x  = p_input[i * stride];
+        const neuton_i32_t y  = x - pivot;
+        const neuton_u32_t y2 = (neuton_u32_t)((neuton_i64_t)y * y);
+        const neuton_u64_t y4 = (neuton_u64_t)y2 * y2;
+
+        sum += y;
+        sum2 += y2;
+        sum3 += (neuton_i64_t)y2 * y;
+        sum4_hi += (neuton_u32_t)(y4 >> 32);
+        sum4_lo += (neuton_u32_t)y4;
+
+        /* First and second differences */
+        const neuton_i32_t d1 = x - prev;
+
+        if (i > 1)
+        {
+            const neuton_i32_t d2 = d1 - prev_d1;
+            d2_sum2 += (neuton_u64_t)((neuton_i64_t)d2 * d2);
+        }
+        else if (i == 1)
+        {
+            first_d1 = d1;
+        }
+
+        d1_sum2 += (neuton_u32_t)((neuton_i64_t)d1 * d1);
+        prev_d1 = d1;
+        prev    = x;
+    }
+
+    p_fm->num     = num;
+    p_fm->pivot   = (neuton_i16_t)pivot;
+    p_fm->sum     = sum;
+    p_fm->sum2    = sum2;
+    p_fm->sum3    = sum3;
+    p_fm->sum4_hi = sum4_hi;
+    p_fm->sum4_lo = sum4_lo;
+
+    /* Sums of differences are telescopic, no need to accumulate them */
+    if (num > 1)
+        p_fm->deriv_var.first = var_from_sums_(prev - pivot, d1_sum2, num - 1U);
+
+    if (num > 2)
+        p_fm->deriv_var.second = var_from_sums_(prev_d1 - first_d1, d2_sum2, num - 2U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_fused_moments_i16_t* p_fm)
+{
+    neuton_dsp_fused_moments_i16_s(p_input, num, 1, p_fm);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_to_ctx_i16(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                         neuton_dsp_stat_ctx_i16_t*            p_ctx)
+{
+    const neuton_i64_t pivot = p_fm->pivot;
+
+    p_ctx->value.sum = (neuton_i32_t)(p_fm->sum + pivot * p_fm->num);
+    p_ctx->value.tss = (neuton_u64_t)((neuton_i64_t)p_fm->sum2 + 2 * pivot * p_fm->sum +
+                                      pivot * pivot * p_fm->num);
+    p_ctx->value.var = var_from_sums_(p_fm->sum, p_fm->sum2, p_fm->num);
+    p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_SUM_TSS_VAR_FLAGS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_moments_i16_to_f32(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                         neuton_dsp_fused_moments_f32_t*       p_output)
+{
+    memset(p_output, 0, sizeof(*p_output));
+
+    if (p_fm->num == 0)
+        return;
+
+    const neuton_f32_t n  = (neuton_f32_t)p_fm->num;
+    const neuton_f32_t s1 = (neuton_f32_t)p_fm->sum;
+    const neuton_f32_t s2 = (neuton_f32_t)p_fm->sum2;
+    const neuton_f32_t s3 = (neuton_f32_t)p_fm->sum3;
+    const neuton_f32_t s4 = (neuton_f32_t)p_fm->sum4_hi * 4294967296.0f + (neuton_f32_t)p_fm->sum4_lo;
+    const neuton_f32_t mu = s1 / n;
+
+    p_output->num  = p_fm->num;
+    p_output->mean = mu + (neuton_f32_t)p_fm->pivot;
+    p_output->m2   = s2 - mu * s1;
+    p_output->m3   = s3 - 3.0f * mu * s2 + 2.0f * n * mu * mu * mu;
+    p_output->m4   = s4 - 4.0f * mu * s3 + 6.0f * mu * mu * s2 - 3.0f * n * mu * mu * mu * mu;
+
+    p_output->deriv_var.first  = (neuton_f32_t)p_fm->deriv_var.first;
+    p_output->deriv_var.second = (neuton_f32_t)p_fm->deriv_var.second;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_fused_hjorth_i16(const neuton_dsp_fused_moments_i16_t* p_fm,
+                                 neuton_dsp_hjorth_params_i16_t*       p_params)
+{
+    const neuton_u32_t var = var_from_sums_(p_fm->sum, p_fm->sum2, p_fm->num);
+    const neuton_u32_t d1  = p_fm->deriv_var.first;
+    const neuton_u32_t d2  = p_fm->deriv_var.second;
+
+    p_params->activity   = (neuton_i32_t)var;
+    p_params->mobility   = 0;
+    p_params->complexity = 0;
+
+    if ((var == 0) || (d1 == 0))
+        return;
+
+    const neuton_u32_t mobility    = isqrt_u64_(d1 * NEUTON_PERCENTAGE_TO_INT_FACTOR_SQ / var);
+    const neuton_u32_t d1_mobility = isqrt_u64_(d2 * NEUTON_PERCENTAGE_TO_INT_FACTOR_SQ / d1);
+
+    p_params->mobility   = (neuton_i32_t)mobility;
+    p_params->complexity = (mobility > 0)
+                               ? (neuton_i32_t)(d1_mobility * NEUTON_PERCENTAGE_TO_INT_FACTOR / mobility)
+                               : 0;
+}
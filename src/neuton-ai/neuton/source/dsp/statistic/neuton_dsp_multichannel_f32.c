@@ -0,0 +1,138 @@
+#include <neuton/dsp/statistic/neuton_dsp_multichannel.h>
+#include <neuton/dsp/neuton_dsp_fast_math.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_f32_t crossing_rate_(neuton_f32_t count, neuton_u16_t num)
+{
+    return (num > 1) ? (count / (neuton_f32_t)(num - 1)) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t sign_f32_(neuton_f32_t x)
+{
+    return signbit(x) ? 1U : 0U;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_stat_ctx_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                                neuton_dsp_stat_ctx_f32_t* p_ctx)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+    {
+        p_ctx[ch].value.abssum = 0;
+        p_ctx[ch].value.sum    = 0;
+        p_ctx[ch].value.tss    = 0;
+    }
+
+    for (neuton_u16_t i = 0; i < num; i++, p_input += channels)
+    {
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            const neuton_f32_t x = p_input[ch];
+
+            p_ctx[ch].value.abssum += fabsf(x);
+            p_ctx[ch].value.sum += x;
+            p_ctx[ch].value.tss += x * x;
+        }
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_ctx[ch].flags.all |= NEUTON_DSP_STAT_CTX_SUM_TSS_FLAGS | NEUTON_DSP_STAT_CTX_ABSSUM_FLAG;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_mean_f32(const neuton_dsp_stat_ctx_f32_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                            neuton_f32_t* p_mean)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_mean[ch] = (num > 0) ? (p_ctx[ch].value.sum / (neuton_f32_t)num) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_rms_f32(const neuton_dsp_stat_ctx_f32_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_f32_t* p_rms)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_rms[ch] = (num > 0) ? neuton_dsp_sqrt_f32(p_ctx[ch].value.tss / (neuton_f32_t)num) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_min_max_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                               neuton_f32_t* p_min, neuton_f32_t* p_max)
+{
+    if (num == 0)
+        return;
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_min[ch] = p_max[ch] = p_input[ch];
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            const neuton_f32_t x = p_input[ch];
+
+            if (x < p_min[ch])
+                p_min[ch] = x;
+            if (x > p_max[ch])
+                p_max[ch] = x;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_zcr_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_f32_t* p_zcr)
+{
+    /* Crossings are counted directly in the output array and converted to the rate at the end */
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_zcr[ch] = 0;
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        const neuton_f32_t* p_prev = p_input;
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+            p_zcr[ch] += (neuton_f32_t)(sign_f32_(p_input[ch]) ^ sign_f32_(p_prev[ch]));
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_zcr[ch] = crossing_rate_(p_zcr[ch], num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_tcr_f32(const neuton_f32_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           const neuton_f32_t* p_threshold, neuton_f32_t* p_tcr)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_tcr[ch] = 0;
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        const neuton_f32_t* p_prev = p_input;
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            p_tcr[ch] += (neuton_f32_t)(sign_f32_(p_input[ch] - p_threshold[ch]) ^
+                                        sign_f32_(p_prev[ch] - p_threshold[ch]));
+        }
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_tcr[ch] = crossing_rate_(p_tcr[ch], num);
+}
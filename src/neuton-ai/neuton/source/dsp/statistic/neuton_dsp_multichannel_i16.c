@@ -0,0 +1,135 @@
+#include <neuton/dsp/statistic/neuton_dsp_multichannel.h>
+#include <neuton/dsp/neuton_dsp_fast_math.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_i16_t crossing_rate_(neuton_u32_t count, neuton_u16_t num)
+{
+    return (num > 1) ? (neuton_i16_t)(count * NEUTON_PERCENTAGE_TO_INT_FACTOR / (num - 1U)) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_stat_ctx_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                                neuton_dsp_stat_ctx_i16_t* p_ctx)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+    {
+        p_ctx[ch].value.abssum = 0;
+        p_ctx[ch].value.sum    = 0;
+        p_ctx[ch].value.tss    = 0;
+    }
+
+    for (neuton_u16_t i = 0; i < num; i++, p_input += channels)
+    {
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            const neuton_i32_t x = p_input[ch];
+
+            p_ctx[ch].value.abssum += (neuton_u32_t)((x < 0) ? -x : x);
+            p_ctx[ch].value.sum += x;
+            p_ctx[ch].value.tss += (neuton_u32_t)(x * x);
+        }
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_ctx[ch].flags.all |= NEUTON_DSP_STAT_CTX_SUM_TSS_FLAGS | NEUTON_DSP_STAT_CTX_ABSSUM_FLAG;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_mean_i16(const neuton_dsp_stat_ctx_i16_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                            neuton_i16_t* p_mean)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_mean[ch] = (num > 0) ? (neuton_i16_t)(p_ctx[ch].value.sum / (neuton_i32_t)num) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_rms_i16(const neuton_dsp_stat_ctx_i16_t* p_ctx, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_i32_t* p_rms)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+    {
+        p_rms[ch] = (num > 0)
+                        ? (neuton_i32_t)neuton_dsp_sqrt_u32((neuton_u32_t)(p_ctx[ch].value.tss / num))
+                        : 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_min_max_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                               neuton_i16_t* p_min, neuton_i16_t* p_max)
+{
+    if (num == 0)
+        return;
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_min[ch] = p_max[ch] = p_input[ch];
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            const neuton_i16_t x = p_input[ch];
+
+            if (x < p_min[ch])
+                p_min[ch] = x;
+            if (x > p_max[ch])
+                p_max[ch] = x;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_zcr_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           neuton_i16_t* p_zcr)
+{
+    /* Crossings are counted directly in the output array and converted to the rate at the end */
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_zcr[ch] = 0;
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        const neuton_u16_t* p_prev = (const neuton_u16_t*)p_input;
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+            p_zcr[ch] += (((neuton_u16_t)p_input[ch] ^ p_prev[ch]) >> 15);
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_zcr[ch] = crossing_rate_((neuton_u16_t)p_zcr[ch], num);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mc_tcr_i16(const neuton_i16_t* p_input, neuton_u16_t num, neuton_u16_t channels,
+                           const neuton_i16_t* p_threshold, neuton_i16_t* p_tcr)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_tcr[ch] = 0;
+
+    for (neuton_u16_t i = 1; i < num; i++)
+    {
+        const neuton_i16_t* p_prev = p_input;
+        p_input += channels;
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            const neuton_u32_t prev = (neuton_u32_t)(p_prev[ch] - p_threshold[ch]);
+            const neuton_u32_t curr = (neuton_u32_t)(p_input[ch] - p_threshold[ch]);
+
+            p_tcr[ch] += (((prev ^ curr) >> 15) & 1U);
+        }
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        p_tcr[ch] = crossing_rate_((neuton_u16_t)p_tcr[ch], num);
+}
@@ -0,0 +1,126 @@
+#include <neuton/dsp/statistic/neuton_dsp_segment_stats.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Sign bit of the sample, crossing is the change of it between the adjacent samples */
+#define SIGN_I16(x)    ((neuton_u16_t)(x) >> 15)
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_segment_stats_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                  neuton_dsp_segment_stats_i16_t* p_stats)
+{
+    memset(p_stats, 0, sizeof(*p_stats));
+
+    if (num == 0)
+        return;
+
+    neuton_i16_t min = p_input[0];
+    neuton_i16_t max = p_input[0];
+    neuton_i32_t sum = 0;
+    neuton_u64_t tss = 0;
+    neuton_u16_t crossings = 0;
+    neuton_u16_t prev_sign = SIGN_I16(p_input[0]);
+
+    /* Sum of INT16 samples fits INT32 for the UINT16 number of samples */
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_i16_t x = p_input[i];
+        const neuton_u16_t sign = SIGN_I16(x);
+
+        if (x < min)
+            min = x;
+        if (x > max)
+            max = x;
+
+        crossings += (sign != prev_sign);
+        prev_sign = sign;
+
+        sum += x;
+        tss += (neuton_u64_t)((neuton_i32_t)x * x);
+    }
+
+    p_stats->num       = num;
+    p_stats->min       = min;
+    p_stats->max       = max;
+    p_stats->first     = p_input[0];
+    p_stats->last      = p_input[num - 1];
+    p_stats->crossings = crossings;
+    p_stats->sum       = sum;
+    p_stats->tss       = tss;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_segment_stats_split_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                                        neuton_u16_t segments_num,
+                                        neuton_dsp_segment_stats_i16_t* p_segments)
+{
+    if (segments_num == 0)
+        return;
+
+    const neuton_u16_t segment_size = num / segments_num;
+
+    for (neuton_u16_t i = 0; i < segments_num; i++)
+    {
+        const neuton_u16_t size = (i == segments_num - 1) ? (num - i * segment_size) : segment_size;
+
+        neuton_dsp_segment_stats_i16(p_input, size, &p_segments[i]);
+        p_input += size;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_segment_stats_merge_i16(const neuton_dsp_segment_stats_i16_t* p_head,
+                                        const neuton_dsp_segment_stats_i16_t* p_tail,
+                                        neuton_dsp_segment_stats_i16_t*       p_output)
+{
+    if (p_tail->num == 0)
+    {
+        *p_output = *p_head;
+        return;
+    }
+
+    if (p_head->num == 0)
+    {
+        *p_output = *p_tail;
+        return;
+    }
+
+    const neuton_u16_t border = (SIGN_I16(p_head->last) != SIGN_I16(p_tail->first));
+
+    p_output->crossings = p_head->crossings + p_tail->crossings + border;
+    p_output->min       = (p_tail->min < p_head->min) ? p_tail->min : p_head->min;
+    p_output->max       = (p_tail->max > p_head->max) ? p_tail->max : p_head->max;
+    p_output->first     = p_head->first;
+    p_output->last      = p_tail->last;
+    p_output->sum       = p_head->sum + p_tail->sum;
+    p_output->tss       = p_head->tss + p_tail->tss;
+    p_output->num       = p_head->num + p_tail->num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_i16_t neuton_dsp_segment_stats_zcr_i16(const neuton_dsp_segment_stats_i16_t* p_stats)
+{
+    if (p_stats->num < 2)
+        return 0;
+
+    const neuton_u32_t crossings = (neuton_u32_t)p_stats->crossings * NEUTON_PERCENTAGE_TO_INT_FACTOR;
+
+    return (neuton_i16_t)(crossings / (neuton_u32_t)(p_stats->num - 1));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_segment_stats_to_ctx_i16(const neuton_dsp_segment_stats_i16_t* p_stats,
+                                         neuton_dsp_stat_ctx_i16_t*            p_ctx)
+{
+    p_ctx->value.sum = (neuton_i32_t)p_stats->sum;
+    p_ctx->value.tss = p_stats->tss;
+    p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_SUM_TSS_FLAGS;
+}
@@ -0,0 +1,53 @@
+#include <neuton/dsp/support/neuton_dsp_clipping.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CLIPPING_INPUT_TYPE    i16
+#define CLIPPING_SPAN          clip_span_dual_
+
+static void clip_span_dual_(neuton_i16_t* p_input, const neuton_i16_t* p_min, const neuton_i16_t* p_max,
+                            neuton_u16_t num);
+
+#include <neuton/private/template/dsp/neuton_dsp_clipping_channels_source.inc>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Span samples and limits are only halfword aligned, so words are accessed by memcpy(),
+ * that is a single LDR / STR on cores with unaligned access support */
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t load_u32_(const neuton_i16_t* p_src)
+{
+    neuton_u32_t word;
+    memcpy(&word, p_src, sizeof(word));
+    return word;
+}
+
+__NEUTON_STATIC_FORCEINLINE void store_u32_(neuton_i16_t* p_dst, neuton_u32_t word)
+{
+    memcpy(p_dst, &word, sizeof(word));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Clips two samples per word with the dual halfword max/min */
+static void clip_span_dual_(neuton_i16_t* p_input, const neuton_i16_t* p_min, const neuton_i16_t* p_max,
+                            neuton_u16_t num)
+{
+    neuton_u16_t loop_cnt = num >> 1U;
+
+    while (loop_cnt > 0U)
+    {
+        store_u32_(p_input, __NEUTON_SMIN16(__NEUTON_SMAX16(load_u32_(p_input), load_u32_(p_min)),
+                                            load_u32_(p_max)));
+        p_input += 2;
+        p_min += 2;
+        p_max += 2;
+        loop_cnt--;
+    }
+
+    if (num & 1U)
+        clip_span_(p_input, p_min, p_max, 1);
+}
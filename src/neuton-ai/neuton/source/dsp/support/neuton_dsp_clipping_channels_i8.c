@@ -0,0 +1,8 @@
+#include <neuton/dsp/support/neuton_dsp_clipping.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CLIPPING_INPUT_TYPE    i8
+
+#include <neuton/private/template/dsp/neuton_dsp_clipping_channels_source.inc>
@@ -0,0 +1,49 @@
+#include <neuton/dsp/support/neuton_dsp_quantization_stats.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_quantize_stats_init(neuton_dsp_quantize_stats_t* p_stats,
+                                               neuton_f32_t*                p_scales,
+                                               neuton_u32_t*                p_saturated_num,
+                                               neuton_u16_t                 channels_num,
+                                               neuton_f32_t                 scale,
+                                               neuton_u16_t                 adapt_threshold)
+{
+    RETURN_IF((p_stats == NULL) || (p_scales == NULL) || (p_saturated_num == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(channels_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    p_stats->p_scales        = p_scales;
+    p_stats->p_saturated_num = p_saturated_num;
+    p_stats->channels_num    = channels_num;
+    p_stats->adapt_threshold = adapt_threshold;
+
+    for (neuton_u16_t ch = 0; ch < channels_num; ch++)
+        p_scales[ch] = scale;
+
+    neuton_dsp_quantize_stats_reset(p_stats);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_quantize_stats_reset(neuton_dsp_quantize_stats_t* p_stats)
+{
+    for (neuton_u16_t ch = 0; ch < p_stats->channels_num; ch++)
+        p_stats->p_saturated_num[ch] = 0;
+
+    p_stats->frames_num      = 0;
+    p_stats->adaptations_num = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_f32_t neuton_dsp_quantize_stats_saturation_ratio(const neuton_dsp_quantize_stats_t* p_stats,
+                                                        neuton_u16_t                       channel)
+{
+    if ((channel >= p_stats->channels_num) || (p_stats->frames_num == 0))
+        return 0.0f;
+
+    return (neuton_f32_t)p_stats->p_saturated_num[channel] / (neuton_f32_t)p_stats->frames_num;
+}
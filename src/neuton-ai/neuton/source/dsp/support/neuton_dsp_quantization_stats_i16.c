@@ -0,0 +1,10 @@
+#include <neuton/dsp/support/neuton_dsp_quantization_stats.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define FUNC_TEMPLATE_OUTPUT_TYPE    i16
+#define QUANTIZE_OUTPUT_MIN          NEUTON_INT16_MIN
+#define QUANTIZE_OUTPUT_MAX          NEUTON_INT16_MAX
+
+#include <neuton/private/template/dsp/neuton_dsp_quantization_stats_source.inc>
@@ -0,0 +1,27 @@
+#include <neuton/dsp/support/neuton_dsp_running_median.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_running_median_reset(neuton_dsp_running_median_ctx_t* p_ctx)
+{
+    p_ctx->index = 0;
+    p_ctx->count = 0;
+
+    /* Ring buffer samples are assigned to heap nodes alternately from the Median outwards */
+    for (neuton_u16_t i = 0; i < p_ctx->window; i++)
+    {
+        const neuton_i16_t pos = (neuton_i16_t)((i + 1) / 2);
+
+        p_ctx->p_pos[i] = (i & 1) ? -pos : pos;
+        p_ctx->p_heap[p_ctx->p_pos[i]] = i;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_running_mad_reset(neuton_dsp_running_mad_ctx_t* p_ctx)
+{
+    neuton_dsp_running_median_reset(&p_ctx->median);
+    neuton_dsp_running_median_reset(&p_ctx->deviation);
+}
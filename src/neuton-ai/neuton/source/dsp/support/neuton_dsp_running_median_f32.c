@@ -0,0 +1,34 @@
+#include <neuton/dsp/support/neuton_dsp_running_median.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define RUNNING_MEDIAN_TYPE             f32
+#define RUNNING_MEDIAN_MEAN2(a, b)      (((a) + (b)) * 0.5f)
+#define RUNNING_MEDIAN_ABSDIFF(a, b)    fabsf((a) - (b))
+
+#include <neuton/private/template/dsp/neuton_dsp_running_median_source.inc>
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_dsp_hampel_filter_f32_s(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                            neuton_f32_t* p_inout, neuton_u16_t num, size_t stride,
+                                            neuton_f32_t threshold)
+{
+    neuton_u16_t replaced = 0;
+
+    for (neuton_u16_t i = 0; i < num; i++, p_inout += stride)
+    {
+        neuton_f32_t median;
+        const neuton_f32_t mad = neuton_dsp_running_mad_update_f32(p_ctx, *p_inout, &median);
+
+        if (fabsf(*p_inout - median) > threshold * mad)
+        {
+            *p_inout = median;
+            replaced++;
+        }
+    }
+    return replaced;
+}
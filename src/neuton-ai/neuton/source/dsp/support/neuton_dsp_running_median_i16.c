@@ -0,0 +1,37 @@
+#include <neuton/dsp/support/neuton_dsp_running_median.h>
+#include <neuton/private/neuton_common.h>
+
+#include <stdlib.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define RUNNING_MEDIAN_TYPE     i16
+#define RUNNING_MEDIAN_MEAN2(a, b) \
+    (neuton_i16_t)(((neuton_i32_t)(a) + (neuton_i32_t)(b)) >> 1)
+#define RUNNING_MEDIAN_ABSDIFF(a, b) \
+    (neuton_i16_t)CLIP_MINMAX(abs((neuton_i32_t)(a) - (neuton_i32_t)(b)), 0, NEUTON_INT16_MAX)
+
+#include <neuton/private/template/dsp/neuton_dsp_running_median_source.inc>
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_dsp_hampel_filter_i16_s(neuton_dsp_running_mad_ctx_t* p_ctx,
+                                            neuton_i16_t* p_inout, neuton_u16_t num, size_t stride,
+                                            neuton_u16_t threshold)
+{
+    neuton_u16_t replaced = 0;
+
+    for (neuton_u16_t i = 0; i < num; i++, p_inout += stride)
+    {
+        neuton_i16_t median;
+        const neuton_i16_t mad = neuton_dsp_running_mad_update_i16(p_ctx, *p_inout, &median);
+        const neuton_u32_t deviation = (neuton_u32_t)abs((neuton_i32_t)*p_inout - median);
+
+        if (deviation * NEUTON_PERCENTAGE_TO_INT_FACTOR > (neuton_u32_t)mad * threshold)
+        {
+            *p_inout = median;
+            replaced++;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,8 @@
+#include <neuton/dsp/support/neuton_dsp_scale_plan.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define FUNC_TEMPLATE_INPUT_TYPE    i16
+
+#include <neuton/private/template/dsp/neuton_dsp_scale_plan_source.inc>
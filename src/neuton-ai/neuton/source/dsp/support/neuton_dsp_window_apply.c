@@ -0,0 +1,108 @@
+#include <neuton/dsp/support/neuton_dsp_windowing.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define Q15_ROUND   ((neuton_i32_t)1 << 14)
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_i16_t mul_q15_(neuton_i16_t x, neuton_i16_t coeff)
+{
+    return (neuton_i16_t)(((neuton_i32_t)x * coeff + Q15_ROUND) >> 15);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t update_max_abs_(neuton_u32_t max, neuton_i32_t x)
+{
+    const neuton_u32_t abs = (neuton_u32_t)((x < 0) ? -x : x);
+    return (abs > max) ? abs : max;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The window is symmetric, so each coefficient is loaded once and applied to the samples
+ * at both ends of the window, the middle sample of the odd size window is applied separately.
+ * Both samples are read before the write, so the window could be applied in place.
+ */
+
+void neuton_dsp_window_apply_f32(const neuton_dsp_window_f32_t* p_window,
+                                 const neuton_f32_t*            p_input,
+                                 neuton_f32_t*                  p_output)
+{
+    const neuton_f32_t* p_coeffs = p_window->p_coeffs;
+    const neuton_u16_t  half     = p_window->size >> 1;
+    const neuton_u16_t  last     = p_window->size - 1;
+
+    for (neuton_u16_t i = 0; i < half; i++)
+    {
+        const neuton_f32_t coeff = p_coeffs[i];
+        const neuton_f32_t head  = p_input[i];
+        const neuton_f32_t tail  = p_input[last - i];
+
+        p_output[i]        = head * coeff;
+        p_output[last - i] = tail * coeff;
+    }
+
+    if (p_window->size & 1U)
+        p_output[half] = p_input[half] * p_coeffs[half];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_window_apply_q15(const neuton_dsp_window_q15_t* p_window,
+                                 const neuton_i16_t*            p_input,
+                                 neuton_i16_t*                  p_output)
+{
+    const neuton_i16_t* p_coeffs = p_window->p_coeffs;
+    const neuton_u16_t  half     = p_window->size >> 1;
+    const neuton_u16_t  last     = p_window->size - 1;
+
+    for (neuton_u16_t i = 0; i < half; i++)
+    {
+        const neuton_i16_t coeff = p_coeffs[i];
+        const neuton_i16_t head  = p_input[i];
+        const neuton_i16_t tail  = p_input[last - i];
+
+        p_output[i]        = mul_q15_(head, coeff);
+        p_output[last - i] = mul_q15_(tail, coeff);
+    }
+
+    if (p_window->size & 1U)
+        p_output[half] = mul_q15_(p_input[half], p_coeffs[half]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u32_t neuton_dsp_window_apply_max_abs_q15(const neuton_dsp_window_q15_t* p_window,
+                                                 const neuton_i16_t*            p_input,
+                                                 neuton_i16_t*                  p_output)
+{
+    const neuton_i16_t* p_coeffs = p_window->p_coeffs;
+    const neuton_u16_t  half     = p_window->size >> 1;
+    const neuton_u16_t  last     = p_window->size - 1;
+    neuton_u32_t        max      = 0;
+
+    for (neuton_u16_t i = 0; i < half; i++)
+    {
+        const neuton_i16_t coeff = p_coeffs[i];
+        const neuton_i16_t head  = mul_q15_(p_input[i], coeff);
+        const neuton_i16_t tail  = mul_q15_(p_input[last - i], coeff);
+
+        p_output[i]        = head;
+        p_output[last - i] = tail;
+
+        max = update_max_abs_(max, head);
+        max = update_max_abs_(max, tail);
+    }
+
+    if (p_window->size & 1U)
+    {
+        p_output[half] = mul_q15_(p_input[half], p_coeffs[half]);
+        max = update_max_abs_(max, p_output[half]);
+    }
+
+    return max;
+}
@@ -0,0 +1,115 @@
+#include <neuton/dsp/support/neuton_dsp_windowing.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define TWO_PI          (6.28318530718f)
+#define Q15_FACTOR      (32768.0f)
+
+/* Flat-top window coefficients, the same as in scipy.signal.windows.flattop */
+#define FLATTOP_A0      (0.21557895f)
+#define FLATTOP_A1      (0.41663158f)
+#define FLATTOP_A2      (0.277263158f)
+#define FLATTOP_A3      (0.083578947f)
+#define FLATTOP_A4      (0.006947368f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Coefficient n of the symmetric window of size samples, x = 2 * pi * n / (size - 1) */
+static neuton_f32_t coeff_(neuton_dsp_window_type_t type, neuton_f32_t param, neuton_u16_t n, neuton_u16_t size)
+{
+    if (size == 1)
+        return 1.0f;
+
+    const neuton_f32_t last = (neuton_f32_t)(size - 1);
+    const neuton_f32_t x    = TWO_PI * (neuton_f32_t)n / last;
+
+    switch (type)
+    {
+    case NEUTON_DSP_WINDOW_HANN:
+        return 0.5f - 0.5f * cosf(x);
+
+    case NEUTON_DSP_WINDOW_HAMMING:
+        return 0.54f - 0.46f * cosf(x);
+
+    case NEUTON_DSP_WINDOW_BLACKMAN:
+        return 0.42f - 0.5f * cosf(x) + 0.08f * cosf(2.0f * x);
+
+    case NEUTON_DSP_WINDOW_FLATTOP:
+        return FLATTOP_A0 - FLATTOP_A1 * cosf(x) + FLATTOP_A2 * cosf(2.0f * x) -
+               FLATTOP_A3 * cosf(3.0f * x) + FLATTOP_A4 * cosf(4.0f * x);
+
+    case NEUTON_DSP_WINDOW_TUKEY:
+    {
+        /* Cosine tapers of param * (size - 1) / 2 samples on both sides, flat in the middle */
+        const neuton_f32_t taper = param * last / 2.0f;
+
+        if ((neuton_f32_t)n >= taper)
+            return 1.0f;
+
+        return 0.5f - 0.5f * cosf(TWO_PI * (neuton_f32_t)n / (param * last));
+    }
+
+    default:
+        return 1.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_status_t check_args_(const void* p_window, const void* p_coeffs, neuton_u16_t size,
+                                   neuton_dsp_window_type_t type, neuton_f32_t param)
+{
+    RETURN_IF((p_window == NULL) || (p_coeffs == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((size == 0) || (type > NEUTON_DSP_WINDOW_TUKEY), NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF((type == NEUTON_DSP_WINDOW_TUKEY) && ((param < 0.0f) || (param > 1.0f)),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_window_init_f32(neuton_dsp_window_f32_t* p_window,
+                                           neuton_f32_t*            p_coeffs,
+                                           neuton_u16_t             size,
+                                           neuton_dsp_window_type_t type,
+                                           neuton_f32_t             param)
+{
+    const neuton_status_t status = check_args_(p_window, p_coeffs, size, type, param);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    for (neuton_u16_t n = 0; n < NEUTON_DSP_WINDOW_COEFFS_NUM(size); n++)
+        p_coeffs[n] = coeff_(type, param, n, size);
+
+    p_window->p_coeffs = p_coeffs;
+    p_window->size     = size;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_window_init_q15(neuton_dsp_window_q15_t* p_window,
+                                           neuton_i16_t*            p_coeffs,
+                                           neuton_u16_t             size,
+                                           neuton_dsp_window_type_t type,
+                                           neuton_f32_t             param)
+{
+    const neuton_status_t status = check_args_(p_window, p_coeffs, size, type, param);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    for (neuton_u16_t n = 0; n < NEUTON_DSP_WINDOW_COEFFS_NUM(size); n++)
+    {
+        const neuton_i32_t q15 = (neuton_i32_t)roundf(coeff_(type, param, n, size) * Q15_FACTOR);
+
+        p_coeffs[n] = (neuton_i16_t)CLIP_MINMAX(q15, NEUTON_INT16_MIN, NEUTON_INT16_MAX);
+    }
+
+    p_window->p_coeffs = p_coeffs;
+    p_window->size     = size;
+
+    return NEUTON_STATUS_SUCCESS;
+}
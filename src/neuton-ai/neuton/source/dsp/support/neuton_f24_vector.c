@@ -0,0 +1,111 @@
+#include <neuton/dsp/support/neuton_f24_vector.h>
+#include <neuton/private/neuton_f24_inline.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_f24_vec_from_i16(const neuton_i16_t* p_input, neuton_u16_t num,
+                             const neuton_f24_vec_t* p_output)
+{
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_i32_t x    = p_input[i];
+        const neuton_u8_t  sign = (x < 0) ? NEUTON_F24_SIGNED : NEUTON_F24_UNSIGNED;
+        const neuton_f24_t res  = neuton_f24_normalize_((neuton_u16_t)((x < 0) ? -x : x), sign);
+
+        p_output->p_man[i]  = res.man;
+        p_output->p_exps[i] = res.exps;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_f24_vec_normalize(const neuton_f24_vec_t* p_vec, neuton_u16_t num)
+{
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_f24_t res = neuton_f24_normalize_(p_vec->p_man[i], p_vec->p_exps[i]);
+
+        p_vec->p_man[i]  = res.man;
+        p_vec->p_exps[i] = res.exps;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_f24_vec_scale(const neuton_f24_vec_t* p_input, neuton_u16_t num,
+                          neuton_f24_t scale, const neuton_f24_vec_t* p_output)
+{
+    const neuton_u32_t s_man  = scale.man;
+    const neuton_i32_t s_exp  = neuton_f24_exps_to_exp_(scale.exps);
+    const neuton_u8_t  s_sign = NEUTON_F24_SIGN(scale);
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_u8_t  exps = p_input->p_exps[i];
+        const neuton_f24_t res  = neuton_f24_from_u32_(s_man * p_input->p_man[i],
+                                                       s_exp + neuton_f24_exps_to_exp_(exps),
+                                                       (exps & NEUTON_F24_SIGNED) ^ s_sign);
+
+        p_output->p_man[i]  = res.man;
+        p_output->p_exps[i] = res.exps;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_f24_t neuton_f24_vec_sum(const neuton_f24_vec_t* p_input, neuton_u16_t num)
+{
+    neuton_i64_t acc     = 0;
+    neuton_i32_t acc_exp = NEUTON_F24_ACC_EXP_INIT;
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_u8_t  exps = p_input->p_exps[i];
+        const neuton_i64_t man  = p_input->p_man[i];
+
+        neuton_f24_acc_add_(&acc, &acc_exp, (exps & NEUTON_F24_SIGNED) ? -man : man,
+                            neuton_f24_exps_to_exp_(exps));
+    }
+
+    return neuton_f24_from_acc_(acc, acc_exp);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_f24_t neuton_f24_vec_sum_sq(const neuton_f24_vec_t* p_input, neuton_u16_t num)
+{
+    neuton_i64_t acc     = 0;
+    neuton_i32_t acc_exp = NEUTON_F24_ACC_EXP_INIT;
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_u32_t man = p_input->p_man[i];
+
+        neuton_f24_acc_add_(&acc, &acc_exp, (neuton_i64_t)(man * man),
+                            2 * neuton_f24_exps_to_exp_(p_input->p_exps[i]));
+    }
+
+    return neuton_f24_from_acc_(acc, acc_exp);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_f24_t neuton_f24_vec_dot(const neuton_f24_vec_t* p_x, const neuton_f24_vec_t* p_y,
+                                neuton_u16_t num)
+{
+    neuton_i64_t acc     = 0;
+    neuton_i32_t acc_exp = NEUTON_F24_ACC_EXP_INIT;
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_u8_t  x_exps = p_x->p_exps[i];
+        const neuton_u8_t  y_exps = p_y->p_exps[i];
+        const neuton_i64_t prod   = (neuton_i64_t)((neuton_u32_t)p_x->p_man[i] * p_y->p_man[i]);
+
+        neuton_f24_acc_add_(&acc, &acc_exp, ((x_exps ^ y_exps) & NEUTON_F24_SIGNED) ? -prod : prod,
+                            neuton_f24_exps_to_exp_(x_exps) + neuton_f24_exps_to_exp_(y_exps));
+    }
+
+    return neuton_f24_from_acc_(acc, acc_exp);
+}
@@ -0,0 +1,315 @@
+#include <neuton/dsp/transform/fft/neuton_dsp_fft_i16.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Radix-2 butterfly magnitude growth is up to (1 + sqrt(2)), max input allowed without overflow */
+#define BFP_RDX2_HEADROOM_MAX  (13572)
+
+/** Real split stage magnitude growth is up to 2, max input allowed without overflow */
+#define BFP_SPLIT_HEADROOM_MAX (16383)
+
+/** Input is normalized up to be in range (BFP_NORM_TARGET_MAX / 2, BFP_NORM_TARGET_MAX] */
+#define BFP_NORM_TARGET_MAX    BFP_RDX2_HEADROOM_MAX
+
+#define Q15_ROUND              ((neuton_i32_t)1 << 14)
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t update_max_abs_(neuton_u32_t max, neuton_i32_t x)
+{
+    const neuton_u32_t abs = (neuton_u32_t)((x < 0) ? -x : x);
+    return (abs > max) ? abs : max;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t max_abs_i16_(const neuton_i16_t* p_input, neuton_u32_t num)
+{
+    neuton_u32_t max = 0;
+
+    for (neuton_u32_t i = 0; i < num; i++)
+    {
+        max = update_max_abs_(max, p_input[i]);
+    }
+    return max;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u8_t stage_shift_(neuton_u32_t max_abs, neuton_u32_t headroom_max)
+{
+    neuton_u8_t shift = 0;
+
+    while (max_abs > headroom_max)
+    {
+        max_abs >>= 1;
+        shift++;
+    }
+    return shift;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_i8_t normalize_(neuton_i16_t* p_inout, neuton_u32_t num, neuton_u32_t max_abs)
+{
+    /* Loud input already has no room to grow, the radix-2 stages scale it down themselves */
+    if ((max_abs == 0) || (max_abs > BFP_NORM_TARGET_MAX))
+        return 0;
+
+    /* Number of left shifts to put max_abs right below BFP_NORM_TARGET_MAX, it is not negative here */
+    neuton_i8_t up = (neuton_i8_t)(__NEUTON_CLZ(max_abs) - __NEUTON_CLZ(BFP_NORM_TARGET_MAX));
+
+    if ((max_abs << up) > BFP_NORM_TARGET_MAX)
+        up--;
+
+    if (up > 0)
+    {
+        /* Multiplication instead of the left shift, the samples are negative as well */
+        const neuton_i32_t scale = (neuton_i32_t)1 << up;
+
+        for (neuton_u32_t i = 0; i < num; i++)
+            p_inout[i] = (neuton_i16_t)(p_inout[i] * scale);
+        return -up;
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Complex samples are only halfword aligned, so they are accessed by memcpy(),
+ * that is a single LDR / STR on cores with unaligned access support */
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t load_u32_(const neuton_i16_t* p_src)
+{
+    neuton_u32_t word;
+    memcpy(&word, p_src, sizeof(word));
+    return word;
+}
+
+__NEUTON_STATIC_FORCEINLINE void store_u32_(neuton_i16_t* p_dst, neuton_u32_t word)
+{
+    memcpy(p_dst, &word, sizeof(word));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void bitreverse_(neuton_i16_t* p_inout, neuton_u32_t len)
+{
+    for (neuton_u32_t i = 1, j = 0; i < len; i++)
+    {
+        neuton_u32_t bit = len >> 1;
+
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            const neuton_u32_t tmp = load_u32_(&p_inout[2 * i]);
+            store_u32_(&p_inout[2 * i], load_u32_(&p_inout[2 * j]));
+            store_u32_(&p_inout[2 * j], tmp);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u32_t radix2_stage_(neuton_i16_t*       p_inout,
+                                  neuton_u32_t        len,
+                                  neuton_u32_t        half,
+                                  const neuton_i16_t* p_twiddle,
+                                  neuton_u8_t         shift)
+{
+    const neuton_u32_t tw_step = len / (half << 1);
+    neuton_u32_t       max     = 0;
+
+    for (neuton_u32_t k = 0; k < half; k++)
+    {
+        const neuton_i32_t wc = p_twiddle[2 * k * tw_step];
+        const neuton_i32_t ws = p_twiddle[2 * k * tw_step + 1];
+
+        for (neuton_u32_t i = k; i < len; i += (half << 1))
+        {
+            neuton_i16_t* p_a = &p_inout[2 * i];
+            neuton_i16_t* p_b = &p_inout[2 * (i + half)];
+
+            const neuton_i32_t ar = p_a[0] >> shift;
+            const neuton_i32_t ai = p_a[1] >> shift;
+            const neuton_i32_t br = p_b[0] >> shift;
+            const neuton_i32_t bi = p_b[1] >> shift;
+
+            /* b * exp(-j * 2 * pi * k / len) */
+            const neuton_i32_t tr = (br * wc + bi * ws + Q15_ROUND) >> 15;
+            const neuton_i32_t ti = (bi * wc - br * ws + Q15_ROUND) >> 15;
+
+            const neuton_i32_t o0r = __SSAT16(ar + tr);
+            const neuton_i32_t o0i = __SSAT16(ai + ti);
+            const neuton_i32_t o1r = __SSAT16(ar - tr);
+            const neuton_i32_t o1i = __SSAT16(ai - ti);
+
+            p_a[0] = (neuton_i16_t)o0r;
+            p_a[1] = (neuton_i16_t)o0i;
+            p_b[0] = (neuton_i16_t)o1r;
+            p_b[1] = (neuton_i16_t)o1i;
+
+            max = update_max_abs_(max, o0r);
+            max = update_max_abs_(max, o0i);
+            max = update_max_abs_(max, o1r);
+            max = update_max_abs_(max, o1i);
+        }
+    }
+
+    return max;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** max_abs is the maximum absolute value of the input, it is known for the windowed input */
+static neuton_i8_t cfft_bfp_(neuton_i16_t*       p_inout,
+                             neuton_u32_t        len,
+                             const neuton_i16_t* p_twiddle,
+                             neuton_u32_t        max_abs,
+                             neuton_u32_t*       p_max_abs)
+{
+    neuton_i8_t exponent = normalize_(p_inout, 2 * len, max_abs);
+
+    max_abs = (exponent < 0) ? (max_abs << -exponent) : max_abs;
+
+    bitreverse_(p_inout, len);
+
+    for (neuton_u32_t half = 1; half < len; half <<= 1)
+    {
+        const neuton_u8_t shift = stage_shift_(max_abs, BFP_RDX2_HEADROOM_MAX);
+
+        max_abs = radix2_stage_(p_inout, len, half, p_twiddle, shift);
+        exponent += shift;
+    }
+
+    *p_max_abs = max_abs;
+    return exponent;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_cfft_bfp_i16(const neuton_dsp_cfft_i16_t* p_cfft,
+                                        neuton_i16_t*                p_inout,
+                                        neuton_i8_t*                 p_exponent)
+{
+    RETURN_IF((p_cfft == NULL) || (p_inout == NULL) || (p_exponent == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((p_cfft->p_twiddle == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(!IS_POWER_OF_TWO(p_cfft->len), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u32_t max_abs;
+    *p_exponent = cfft_bfp_(p_inout, p_cfft->len, p_cfft->p_twiddle,
+                            max_abs_i16_(p_inout, 2 * p_cfft->len), &max_abs);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool rfft_valid_(const neuton_dsp_rfft_i16_t* p_rfft)
+{
+    return IS_POWER_OF_TWO(p_rfft->len) && (p_rfft->len >= 4) && (p_rfft->cfft.len == (p_rfft->len >> 1));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_i8_t rfft_bfp_(const neuton_dsp_rfft_i16_t* p_rfft,
+                             neuton_i16_t*                p_inout,
+                             neuton_u32_t                 input_max_abs)
+{
+    const neuton_u32_t  half   = p_rfft->cfft.len;
+    const neuton_i16_t* p_coef = p_rfft->p_twiddle_rfft;
+    neuton_u32_t        max_abs;
+
+    /* Even samples as real and odd samples as imaginary parts of half length complex sequence */
+    neuton_i8_t       exponent = cfft_bfp_(p_inout, half, p_rfft->cfft.p_twiddle, input_max_abs, &max_abs);
+    const neuton_u8_t shift    = stage_shift_(max_abs, BFP_SPLIT_HEADROOM_MAX);
+
+    /* DC and Nyquist bins */
+    const neuton_i32_t z0r = p_inout[0] >> shift;
+    const neuton_i32_t z0i = p_inout[1] >> shift;
+
+    p_inout[0] = (neuton_i16_t)__SSAT16(z0r + z0i);
+    p_inout[1] = (neuton_i16_t)__SSAT16(z0r - z0i);
+
+    /* X[k] = Z[k] * A[k] + conj(Z[N/2 - k]) * B[k],
+       A[k] = 0.5 * (1 - sin(2pi*k/N)) - 0.5j * cos(2pi*k/N), B[k] = 1 - A[k] */
+    for (neuton_u32_t k = 1; k <= (half >> 1); k++)
+    {
+        neuton_i16_t* p_k = &p_inout[2 * k];
+        neuton_i16_t* p_m = &p_inout[2 * (half - k)];
+
+        const neuton_i32_t zkr = p_k[0] >> shift;
+        const neuton_i32_t zki = p_k[1] >> shift;
+        const neuton_i32_t zmr = p_m[0] >> shift;
+        const neuton_i32_t zmi = p_m[1] >> shift;
+
+        const neuton_i32_t akr = p_coef[2 * k];
+        const neuton_i32_t aki = p_coef[2 * k + 1];
+        const neuton_i32_t bkr = 32768 - akr;
+        const neuton_i32_t bki = -aki;
+
+        p_k[0] = (neuton_i16_t)__SSAT16((zkr * akr - zki * aki + zmr * bkr + zmi * bki + Q15_ROUND) >> 15);
+        p_k[1] = (neuton_i16_t)__SSAT16((zki * akr + zkr * aki + zmr * bki - zmi * bkr + Q15_ROUND) >> 15);
+
+        if (k != (half - k))
+        {
+            /* Mirrored bin, A[N/2 - k] = conj(A[k]), B[N/2 - k] = conj(B[k]) */
+            const neuton_i32_t amr = akr;
+            const neuton_i32_t ami = -aki;
+            const neuton_i32_t bmr = bkr;
+            const neuton_i32_t bmi = -bki;
+
+            p_m[0] = (neuton_i16_t)__SSAT16((zmr * amr - zmi * ami + zkr * bmr + zki * bmi + Q15_ROUND) >> 15);
+            p_m[1] = (neuton_i16_t)__SSAT16((zmi * amr + zmr * ami + zkr * bmi - zki * bmr + Q15_ROUND) >> 15);
+        }
+    }
+
+    return exponent + shift;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_rfft_bfp_i16(const neuton_dsp_rfft_i16_t* p_rfft,
+                                        neuton_i16_t*                p_inout,
+                                        neuton_i8_t*                 p_exponent)
+{
+    RETURN_IF((p_rfft == NULL) || (p_inout == NULL) || (p_exponent == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((p_rfft->cfft.p_twiddle == NULL) || (p_rfft->p_twiddle_rfft == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(!rfft_valid_(p_rfft), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    *p_exponent = rfft_bfp_(p_rfft, p_inout, max_abs_i16_(p_inout, p_rfft->len));
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_rfft_bfp_windowed_i16(const neuton_dsp_rfft_i16_t*   p_rfft,
+                                                 const neuton_dsp_window_q15_t* p_window,
+                                                 const neuton_i16_t*            p_input,
+                                                 neuton_i16_t*                  p_output,
+                                                 neuton_i8_t*                   p_exponent)
+{
+    RETURN_IF((p_rfft == NULL) || (p_window == NULL) || (p_input == NULL) || (p_output == NULL) ||
+              (p_exponent == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((p_rfft->cfft.p_twiddle == NULL) || (p_rfft->p_twiddle_rfft == NULL) ||
+              (p_window->p_coeffs == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(!rfft_valid_(p_rfft) || (p_window->size != p_rfft->len), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Windowed input is placed to the FFT buffer and its max absolute value is found in the same pass */
+    const neuton_u32_t max_abs = neuton_dsp_window_apply_max_abs_q15(p_window, p_input, p_output);
+
+    *p_exponent = rfft_bfp_(p_rfft, p_output, max_abs);
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,40 @@
+#include <neuton/dsp/transform/neuton_dsp_fft.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_rfft_windowed_f32(neuton_dsp_rfft_f32_t*         p_rfft,
+                                             const neuton_dsp_window_f32_t* p_window,
+                                             const neuton_f32_t*            p_input,
+                                             neuton_f32_t*                  p_output)
+{
+    RETURN_IF((p_rfft == NULL) || (p_window == NULL) || (p_input == NULL) || (p_output == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_window->p_coeffs == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_window->size != p_rfft->len, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Windowed input is placed to the FFT buffer, the real FFT is computed in place of it */
+    neuton_dsp_window_apply_f32(p_window, p_input, p_output);
+    neuton_dsp_rfft_f32(p_rfft, p_output, p_output);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_rfft_windowed_i16(const neuton_dsp_rfft_i16_t*   p_rfft,
+                                             const neuton_dsp_window_q15_t* p_window,
+                                             const neuton_i16_t*            p_input,
+                                             neuton_i16_t*                  p_output)
+{
+    RETURN_IF((p_rfft == NULL) || (p_window == NULL) || (p_input == NULL) || (p_output == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_window->p_coeffs == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_window->size != p_rfft->len, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Windowed input is placed to the FFT buffer, the real FFT is computed in place of it */
+    neuton_dsp_window_apply_q15(p_window, p_input, p_output);
+    neuton_dsp_rfft_i16(p_rfft, p_output, p_output);
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,263 @@
+#include <neuton/dsp/transform/neuton_dsp_mel_filterbank.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define MEL_BREAK_FREQ_HZ   (700.0f)
+#define MEL_SCALE           (2595.0f)
+#define Q15_FACTOR          (32768.0f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_f32_t hz_to_mel_(neuton_f32_t hz)
+{
+    return MEL_SCALE * log10f(1.0f + hz / MEL_BREAK_FREQ_HZ);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Mel position of the FHT bin, the same as neuton_dsp_melspectr_make_f32() computes for every frame:
+ * the bin is between the upper mel band and the previous one, weight is its fractional position.
+ * The band start is rounded before the subtraction, as in the library, so that the weights are equal
+ */
+__NEUTON_NO_FP_CONTRACT
+static void bin_band_(neuton_u16_t bin, neuton_u16_t window_size, neuton_u16_t sample_rate,
+                      neuton_u16_t freq_bands, neuton_f32_t mel_step,
+                      neuton_u16_t* p_band, neuton_f32_t* p_weight)
+{
+    const neuton_f32_t mel        = hz_to_mel_((neuton_f32_t)(((neuton_u32_t)sample_rate * bin) / window_size));
+    const neuton_i32_t band       = (neuton_i32_t)(mel / mel_step);
+    const neuton_f32_t band_start = (neuton_f32_t)band * mel_step;
+
+    /* Bins are below the Nyquist frequency, the upper band is at most the one past the last */
+    *p_band   = (neuton_u16_t)((band > freq_bands) ? freq_bands : band);
+    *p_weight = (mel - band_start) / mel_step;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_f32_t mel_step_(neuton_u16_t sample_rate, neuton_u16_t freq_bands)
+{
+    return hz_to_mel_((neuton_f32_t)(sample_rate >> 1)) / (neuton_f32_t)(freq_bands + 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void extend_band_(neuton_dsp_mel_band_t* p_band, neuton_u16_t bin)
+{
+    if (p_band->bins_num == 0)
+        p_band->start_bin = bin;
+
+    p_band->bins_num = bin - p_band->start_bin + 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Index of the bin weight in the weights table */
+__NEUTON_STATIC_FORCEINLINE neuton_u16_t weight_index_(const neuton_dsp_mel_band_t* p_band, neuton_u16_t bin)
+{
+    return p_band->weights_offset + (bin - p_band->start_bin);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Bins mel bands are non-decreasing, so the bins of each band are contiguous:
+ * from the first bin of the band up to the last bin of the next band
+ */
+static neuton_status_t init_bands_(const void* p_filterbank, neuton_dsp_mel_band_t* p_bands, const void* p_weights,
+                                   neuton_u16_t window_size, neuton_u16_t sample_rate, neuton_u16_t freq_bands)
+{
+    RETURN_IF((p_filterbank == NULL) || (p_bands == NULL) || (p_weights == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((sample_rate == 0) || (freq_bands == 0) || (window_size < 2), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    const neuton_f32_t mel_step = mel_step_(sample_rate, freq_bands);
+
+    for (neuton_u16_t i = 0; i < freq_bands; i++)
+    {
+        p_bands[i].start_bin = 0;
+        p_bands[i].bins_num  = 0;
+    }
+
+    for (neuton_u16_t k = 0; k < window_size / 2U; k++)
+    {
+        neuton_u16_t band;
+        neuton_f32_t weight;
+
+        bin_band_(k, window_size, sample_rate, freq_bands, mel_step, &band, &weight);
+
+        if (band > 0)
+            extend_band_(&p_bands[band - 1], k);
+        if (band < freq_bands)
+            extend_band_(&p_bands[band], k);
+    }
+
+    neuton_u16_t offset = 0;
+
+    for (neuton_u16_t i = 0; i < freq_bands; i++)
+    {
+        p_bands[i].weights_offset = offset;
+        offset += p_bands[i].bins_num;
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_mel_filterbank_init_f32(neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                                   neuton_dsp_mel_band_t*           p_bands,
+                                                   neuton_f32_t*                    p_weights,
+                                                   neuton_u16_t                     window_size,
+                                                   neuton_u16_t                     sample_rate,
+                                                   neuton_u16_t                     freq_bands)
+{
+    const neuton_status_t status = init_bands_(p_filterbank, p_bands, p_weights,
+                                               window_size, sample_rate, freq_bands);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    const neuton_f32_t mel_step = mel_step_(sample_rate, freq_bands);
+
+    for (neuton_u16_t k = 0; k < window_size / 2U; k++)
+    {
+        neuton_u16_t band;
+        neuton_f32_t weight;
+
+        bin_band_(k, window_size, sample_rate, freq_bands, mel_step, &band, &weight);
+
+        if (band > 0)
+            p_weights[weight_index_(&p_bands[band - 1], k)] = 1.0f - weight;
+        if (band < freq_bands)
+            p_weights[weight_index_(&p_bands[band], k)] = weight;
+    }
+
+    p_filterbank->p_bands     = p_bands;
+    p_filterbank->p_weights   = p_weights;
+    p_filterbank->bands_num   = freq_bands;
+    p_filterbank->window_size = window_size;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_i16_t to_q15_(neuton_f32_t weight)
+{
+    const neuton_i32_t q15 = (neuton_i32_t)(weight * Q15_FACTOR + 0.5f);
+
+    return (neuton_i16_t)CLIP_MINMAX(q15, 0, NEUTON_INT16_MAX);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_mel_filterbank_init_q15(neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                   neuton_dsp_mel_band_t*           p_bands,
+                                                   neuton_i16_t*                    p_weights,
+                                                   neuton_u16_t                     window_size,
+                                                   neuton_u16_t                     sample_rate,
+                                                   neuton_u16_t                     freq_bands)
+{
+    const neuton_status_t status = init_bands_(p_filterbank, p_bands, p_weights,
+                                               window_size, sample_rate, freq_bands);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    const neuton_f32_t mel_step = mel_step_(sample_rate, freq_bands);
+
+    for (neuton_u16_t k = 0; k < window_size / 2U; k++)
+    {
+        neuton_u16_t band;
+        neuton_f32_t weight;
+
+        bin_band_(k, window_size, sample_rate, freq_bands, mel_step, &band, &weight);
+
+        if (band > 0)
+            p_weights[weight_index_(&p_bands[band - 1], k)] = to_q15_(1.0f - weight);
+        if (band < freq_bands)
+            p_weights[weight_index_(&p_bands[band], k)] = to_q15_(weight);
+    }
+
+    p_filterbank->p_bands     = p_bands;
+    p_filterbank->p_weights   = p_weights;
+    p_filterbank->bands_num   = freq_bands;
+    p_filterbank->window_size = window_size;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_NO_FP_CONTRACT
+void neuton_dsp_mel_filterbank_apply_f32(const neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                         const neuton_f32_t*                    p_power,
+                                         neuton_f32_t*                          p_output)
+{
+    const neuton_dsp_mel_band_t* p_band = p_filterbank->p_bands;
+
+    for (neuton_u16_t i = 0; i < p_filterbank->bands_num; i++, p_band++)
+    {
+        const neuton_f32_t* p_bin_power = &p_power[p_band->start_bin];
+        const neuton_f32_t* p_weight    = &p_filterbank->p_weights[p_band->weights_offset];
+        neuton_f32_t        energy      = 0.0f;
+
+        /* Bins are accumulated one by one in the ascending order with the rounded products,
+         * as in neuton_dsp_melspectr_make_f32() */
+        for (neuton_u16_t k = 0; k < p_band->bins_num; k++)
+        {
+            const neuton_f32_t product = p_weight[k] * p_bin_power[k];
+
+            energy += product;
+        }
+
+        p_output[i] = energy;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u32_t neuton_dsp_mel_filterbank_band_q15(const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                neuton_u16_t                           band,
+                                                const neuton_i16_t*                    p_power)
+{
+    const neuton_dsp_mel_band_t* p_band      = &p_filterbank->p_bands[band];
+    const neuton_i16_t*          p_bin_power = &p_power[p_band->start_bin];
+    const neuton_i16_t*          p_weight    = &p_filterbank->p_weights[p_band->weights_offset];
+    neuton_u64_t                 energy      = 0;
+    neuton_u16_t                 loop_cnt    = p_band->bins_num >> 2U;
+
+    while (loop_cnt > 0U)
+    {
+        energy += (neuton_u32_t)((neuton_i32_t)p_bin_power[0] * p_weight[0]);
+        energy += (neuton_u32_t)((neuton_i32_t)p_bin_power[1] * p_weight[1]);
+        energy += (neuton_u32_t)((neuton_i32_t)p_bin_power[2] * p_weight[2]);
+        energy += (neuton_u32_t)((neuton_i32_t)p_bin_power[3] * p_weight[3]);
+
+        p_bin_power += 4;
+        p_weight += 4;
+        loop_cnt--;
+    }
+
+    loop_cnt = p_band->bins_num & 3U;
+
+    while (loop_cnt > 0U)
+    {
+        energy += (neuton_u32_t)((neuton_i32_t)*p_bin_power++ * *p_weight++);
+        loop_cnt--;
+    }
+
+    energy >>= NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT;
+
+    return (energy > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (neuton_u32_t)energy;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_mel_filterbank_apply_q15(const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                         const neuton_i16_t*                    p_power,
+                                         neuton_u32_t*                          p_output)
+{
+    for (neuton_u16_t i = 0; i < p_filterbank->bands_num; i++)
+        p_output[i] = neuton_dsp_mel_filterbank_band_q15(p_filterbank, i, p_power);
+}
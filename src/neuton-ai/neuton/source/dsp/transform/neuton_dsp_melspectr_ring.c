@@ -0,0 +1,156 @@
+#include <neuton/dsp/transform/neuton_dsp_melspectr_ring.h>
+#include <neuton/private/neuton_common.h>
+
+#include <math.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_status_t init_(neuton_dsp_melspectr_ring_t*      p_ctx,
+                             const neuton_dsp_rfht_instance_t* p_fht,
+                             neuton_u16_t                      filterbank_window_size,
+                             neuton_u16_t                      freq_bands,
+                             void*                             p_ring,
+                             neuton_u16_t                      time_bands)
+{
+    RETURN_IF((p_ctx == NULL) || (p_fht == NULL) || (p_ring == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF((time_bands == 0) || (freq_bands == 0) || (filterbank_window_size != p_fht->window_size),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    p_ctx->p_ring.generic = p_ring;
+    p_ctx->fht            = *p_fht;
+    p_ctx->freq_bands     = freq_bands;
+    p_ctx->time_bands     = time_bands;
+    p_ctx->head           = 0;
+    p_ctx->filled         = 0;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_melspectr_ring_init_f32(neuton_dsp_melspectr_ring_t*           p_ctx,
+                                                   const neuton_dsp_rfht_instance_t*      p_fht,
+                                                   const neuton_dsp_mel_filterbank_f32_t* p_filterbank,
+                                                   neuton_f32_t*                          p_ring,
+                                                   neuton_u16_t                           time_bands)
+{
+    RETURN_IF(p_filterbank == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_status_t status = init_(p_ctx, p_fht, p_filterbank->window_size,
+                                         p_filterbank->bands_num, p_ring, time_bands);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    p_ctx->p_filterbank.f32 = p_filterbank;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_melspectr_ring_init_i16(neuton_dsp_melspectr_ring_t*           p_ctx,
+                                                   const neuton_dsp_rfht_instance_t*      p_fht,
+                                                   const neuton_dsp_mel_filterbank_q15_t* p_filterbank,
+                                                   neuton_i16_t*                          p_ring,
+                                                   neuton_u16_t                           time_bands)
+{
+    RETURN_IF(p_filterbank == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_status_t status = init_(p_ctx, p_fht, p_filterbank->window_size,
+                                         p_filterbank->bands_num, p_ring, time_bands);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    p_ctx->p_filterbank.q15 = p_filterbank;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_melspectr_ring_push_f32(neuton_dsp_melspectr_ring_t* p_ctx, neuton_f32_t* p_frame)
+{
+    const neuton_u16_t bands    = p_ctx->freq_bands;
+    neuton_f32_t*      p_column = &p_ctx->p_ring.f32[(neuton_sz_t)p_ctx->head * bands];
+
+    p_ctx->fht.p_window = p_frame;
+    neuton_dsp_rfht_f32(&p_ctx->fht);
+
+    neuton_dsp_mel_filterbank_apply_f32(p_ctx->p_filterbank.f32, p_frame, p_column);
+
+    for (neuton_u16_t i = 0; i < bands; i++)
+        p_column[i] = log10f((p_column[i] == 0.0f) ? NEUTON_F32_NP_MIN : p_column[i]);
+
+    p_ctx->head = (p_ctx->head + 1 == p_ctx->time_bands) ? 0 : (p_ctx->head + 1);
+
+    if (p_ctx->filled < p_ctx->time_bands)
+        p_ctx->filled++;
+
+    return (p_ctx->filled == p_ctx->time_bands) ? NEUTON_STATUS_SUCCESS : NEUTON_STATUS_INPROGRESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_melspectr_ring_shift(neuton_dsp_melspectr_ring_t* p_ctx, neuton_u16_t shift)
+{
+    p_ctx->filled = (shift < p_ctx->filled) ? (p_ctx->filled - shift) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void view_(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_dsp_melspectr_span_t* p_span,
+                  neuton_sz_t value_size)
+{
+    const neuton_u8_t* p_ring      = (const neuton_u8_t*)p_ctx->p_ring.generic;
+    const neuton_sz_t  column_size = value_size * p_ctx->freq_bands;
+
+    /* Oldest valid column is filled columns before the head */
+    const neuton_u16_t oldest = (p_ctx->head >= p_ctx->filled) ? (p_ctx->head - p_ctx->filled)
+                                                               : (p_ctx->head + p_ctx->time_bands - p_ctx->filled);
+    const neuton_u16_t to_end = p_ctx->time_bands - oldest;
+
+    p_span->p_first    = &p_ring[oldest * column_size];
+    p_span->first_num  = (p_ctx->filled < to_end) ? p_ctx->filled : to_end;
+    p_span->p_second   = p_ring;
+    p_span->second_num = p_ctx->filled - p_span->first_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void copy_(const neuton_dsp_melspectr_ring_t* p_ctx, void* p_output, neuton_sz_t value_size)
+{
+    neuton_dsp_melspectr_span_t span;
+    const neuton_sz_t           column_size = value_size * p_ctx->freq_bands;
+
+    view_(p_ctx, &span, value_size);
+
+    memcpy(p_output, span.p_first, span.first_num * column_size);
+    memcpy((neuton_u8_t*)p_output + span.first_num * column_size, span.p_second, span.second_num * column_size);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_melspectr_ring_view_f32(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_dsp_melspectr_span_t* p_span)
+{
+    view_(p_ctx, p_span, sizeof(neuton_f32_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_melspectr_ring_view_i16(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_dsp_melspectr_span_t* p_span)
+{
+    view_(p_ctx, p_span, sizeof(neuton_i16_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_melspectr_ring_copy_f32(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_f32_t* p_output)
+{
+    copy_(p_ctx, p_output, sizeof(neuton_f32_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_dsp_melspectr_ring_copy_i16(const neuton_dsp_melspectr_ring_t* p_ctx, neuton_i16_t* p_output)
+{
+    copy_(p_ctx, p_output, sizeof(neuton_i16_t));
+}
@@ -0,0 +1,77 @@
+#include <neuton/dsp/transform/neuton_dsp_melspectr_ring.h>
+#include <neuton/private/neuton_common.h>
+#include <neuton/private/neuton_c_intrinsics.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** log10(2) in Q16 */
+#define LOG10_2_Q16             19728
+
+#define LOG2_TABLE_BITS         5
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** log2(1 + i / 32) in Q16 */
+static const neuton_u32_t LOG2_TABLE_Q16[(1 << LOG2_TABLE_BITS) + 1] =
+{
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904,
+    47705, 49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534,
+    64047, 65536
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** log2(energy) in Q16, the mantissa is linearly interpolated between the table values */
+__NEUTON_STATIC_FORCEINLINE neuton_i32_t log2_q16_(neuton_u32_t energy)
+{
+    const neuton_u32_t clz = __NEUTON_CLZ(energy);
+
+    /* Mantissa without the leading one: table index in the upper bits, interpolation in the lower */
+    const neuton_u32_t mant   = (energy << clz) << 1;
+    const neuton_u32_t index  = mant >> (32 - LOG2_TABLE_BITS);
+    const neuton_u32_t interp = (mant << LOG2_TABLE_BITS) >> (32 - 16);
+
+    const neuton_u32_t lo = LOG2_TABLE_Q16[index];
+    const neuton_u32_t hi = LOG2_TABLE_Q16[index + 1];
+
+    return ((neuton_i32_t)(31 - clz) << 16) + (neuton_i32_t)(lo + (((hi - lo) * interp) >> 16));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** log10 of the band energy with NEUTON_DSP_MELSPECTR_LOG_FRACT_BITS fraction bits */
+__NEUTON_STATIC_FORCEINLINE neuton_i16_t log10_(neuton_u32_t energy, neuton_i32_t fract_bits)
+{
+    if (energy == 0)
+        return NEUTON_INT16_MIN;
+
+    const neuton_i64_t log2   = (neuton_i64_t)(log2_q16_(energy) - (fract_bits << 16));
+    const neuton_i32_t log10  = (neuton_i32_t)((log2 * LOG10_2_Q16) >> (32 - NEUTON_DSP_MELSPECTR_LOG_FRACT_BITS));
+
+    return (neuton_i16_t)CLIP_MINMAX(log10, NEUTON_INT16_MIN + 1, NEUTON_INT16_MAX);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_dsp_melspectr_ring_push_i16(neuton_dsp_melspectr_ring_t* p_ctx, neuton_i16_t* p_frame)
+{
+    const neuton_dsp_mel_filterbank_q15_t* p_filterbank = p_ctx->p_filterbank.q15;
+    neuton_i16_t*                          p_column     = &p_ctx->p_ring.i16[(neuton_sz_t)p_ctx->head * p_ctx->freq_bands];
+
+    p_ctx->fht.p_window = p_frame;
+
+    /* Bins powers have fract_bits of FHT, the band energies are accumulated with Q15 weights and the shift */
+    const neuton_i32_t fract_bits = (neuton_i32_t)neuton_dsp_rfht_i16(&p_ctx->fht) + 15 -
+                                    NEUTON_DSP_MEL_FILTERBANK_Q15_SHIFT;
+
+    for (neuton_u16_t i = 0; i < p_ctx->freq_bands; i++)
+        p_column[i] = log10_(neuton_dsp_mel_filterbank_band_q15(p_filterbank, i, p_frame), fract_bits);
+
+    p_ctx->head = (p_ctx->head + 1 == p_ctx->time_bands) ? 0 : (p_ctx->head + 1);
+
+    if (p_ctx->filled < p_ctx->time_bands)
+        p_ctx->filled++;
+
+    return (p_ctx->filled == p_ctx->time_bands) ? NEUTON_STATUS_SUCCESS : NEUTON_STATUS_INPROGRESS;
+}
@@ -0,0 +1,174 @@
+#include <neuton/nn/private/features/dsp/neuton_nn_features_timedomain.h>
+#include <neuton/dsp/statistic/neuton_dsp_fused_moments.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fused moments of the DSP pipeline processed by the features processing interface.
+ * The precompiled time-domain extraction passes only its statistics context to the pipeline functions,
+ * so the moments of the processed pipeline are referenced for the duration of the interface call.
+ */
+static neuton_nn_fused_moments_cache_t* p_bound_ = NULL;
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_nn_features_fused_moments_bind(neuton_nn_fused_moments_cache_t* p_cache)
+{
+    p_bound_ = p_cache;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Moments are shared between the time-domain pipeline functions of the same pipeline call
+ * in the bound cache. The pipeline statistics context is reset for every call, so the
+ * NEUTON_DSP_STAT_CTX_FUSED_FLAG in it tells that the shared moments belong to the current call.
+ * Without the bound cache the moments are calculated to p_local for each function.
+ */
+static const neuton_dsp_fused_moments_i16_t* get_fused_moments_i16_(neuton_i16_t*                   p_input,
+                                                                     neuton_sz_t                     num,
+                                                                     void*                           p_pipeline_ctx,
+                                                                     neuton_dsp_fused_moments_i16_t* p_local)
+{
+    neuton_dsp_stat_ctx_i16_t*      p_ctx     = (neuton_dsp_stat_ctx_i16_t*)p_pipeline_ctx;
+    neuton_dsp_fused_moments_i16_t* p_moments = (p_bound_ != NULL) ? &p_bound_->i16 : p_local;
+
+    if ((p_bound_ == NULL) || (p_ctx == NULL) || !(p_ctx->flags.all & NEUTON_DSP_STAT_CTX_FUSED_FLAG))
+    {
+        neuton_dsp_fused_moments_i16(p_input, (neuton_u16_t)num, p_moments);
+
+        if (p_ctx != NULL)
+        {
+            neuton_dsp_fused_moments_to_ctx_i16(p_moments, p_ctx);
+
+            if (p_bound_ != NULL)
+                p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_FUSED_FLAG;
+        }
+    }
+    return p_moments;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_dsp_fused_moments_f32_t* get_fused_moments_f32_(neuton_f32_t*                   p_input,
+                                                                     neuton_sz_t                     num,
+                                                                     void*                           p_pipeline_ctx,
+                                                                     neuton_dsp_fused_moments_f32_t* p_local)
+{
+    neuton_dsp_stat_ctx_f32_t*      p_ctx     = (neuton_dsp_stat_ctx_f32_t*)p_pipeline_ctx;
+    neuton_dsp_fused_moments_f32_t* p_moments = (p_bound_ != NULL) ? &p_bound_->f32 : p_local;
+
+    if ((p_bound_ == NULL) || (p_ctx == NULL) || !(p_ctx->flags.all & NEUTON_DSP_STAT_CTX_FUSED_FLAG))
+    {
+        neuton_dsp_fused_moments_f32(p_input, (neuton_u16_t)num, p_moments);
+
+        if (p_ctx != NULL)
+        {
+            neuton_dsp_fused_moments_to_ctx_f32(p_moments, p_ctx);
+
+            if (p_bound_ != NULL)
+                p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_FUSED_FLAG;
+        }
+    }
+    return p_moments;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(utility_fused_moments_i16)
+{
+    (void)p_features;
+    (void)feature_mask;
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_dsp_fused_moments_i16_t local;
+
+    get_fused_moments_i16_(p_input, num, p_pipeline_ctx, &local);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(fused_hjorth_i16)
+{
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_i32_t* p_output = p_features;
+
+    if (feature_mask.domain.time.is.hjorth_m || feature_mask.domain.time.is.hjorth_c)
+    {
+        neuton_dsp_fused_moments_i16_t local;
+        neuton_dsp_hjorth_params_i16_t params;
+        neuton_dsp_fused_hjorth_i16(get_fused_moments_i16_(p_input, num, p_pipeline_ctx, &local), &params);
+
+        if (feature_mask.domain.time.is.hjorth_m)
+            *p_output++ = params.mobility;
+        if (feature_mask.domain.time.is.hjorth_c)
+            *p_output++ = params.complexity;
+    }
+    return (neuton_sz_t)(p_output - p_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(utility_fused_moments_f32)
+{
+    (void)p_features;
+    (void)feature_mask;
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_dsp_fused_moments_f32_t local;
+
+    get_fused_moments_f32_(p_input, num, p_pipeline_ctx, &local);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(fused_skew_kur_f32)
+{
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_f32_t* p_output = p_features;
+
+    if (feature_mask.domain.time.is.skew || feature_mask.domain.time.is.kur)
+    {
+        neuton_dsp_fused_moments_f32_t local;
+        neuton_dsp_moments_f32_t       m;
+        neuton_dsp_fused_moments_get_f32(get_fused_moments_f32_(p_input, num, p_pipeline_ctx, &local), &m);
+
+        if (feature_mask.domain.time.is.skew)
+            *p_output++ = m.moment.skew;
+        if (feature_mask.domain.time.is.kur)
+            *p_output++ = m.moment.kur;
+    }
+    return (neuton_sz_t)(p_output - p_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_F32(fused_hjorth_f32)
+{
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_f32_t* p_output = p_features;
+
+    if (feature_mask.domain.time.is.hjorth_m || feature_mask.domain.time.is.hjorth_c)
+    {
+        neuton_dsp_fused_moments_f32_t local;
+        neuton_dsp_hjorth_params_f32_t params;
+        neuton_dsp_fused_hjorth_f32(get_fused_moments_f32_(p_input, num, p_pipeline_ctx, &local), &params);
+
+        if (feature_mask.domain.time.is.hjorth_m)
+            *p_output++ = params.mobility;
+        if (feature_mask.domain.time.is.hjorth_c)
+            *p_output++ = params.complexity;
+    }
+    return (neuton_sz_t)(p_output - p_features);
+}
@@ -0,0 +1,181 @@
+#include <neuton/nn/private/features/neuton_nn_features_prune.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define IS_BIT_SET(mask, n) (bool)((mask)[(n) >> 3] & (1U << ((n) % 8)))
+#define SET_BIT(mask, n)    ((mask)[(n) >> 3] |= (neuton_u8_t)(1U << ((n) % 8)))
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_model_used_inputs(const neuton_nn_model_t* p_model,
+                                            neuton_u16_t             inputs_num,
+                                            neuton_u8_t*             p_used_inputs,
+                                            neuton_u8_t*             p_used_neurons)
+{
+    RETURN_IF((p_model == NULL) || (p_used_inputs == NULL) || (p_used_neurons == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_nn_model_meta_t* p_meta = &p_model->meta;
+
+    memset(p_used_inputs, 0, (inputs_num + 7U) / 8U);
+    memset(p_used_neurons, 0, (p_meta->neurons_num + 7U) / 8U);
+
+    for (neuton_u16_t i = 0; i < p_meta->outputs_num; i++)
+    {
+        RETURN_IF(p_meta->p_output_neurons_indices[i] >= p_meta->neurons_num, NEUTON_STATUS_INVALID_ARGUMENT);
+        SET_BIT(p_used_neurons, p_meta->p_output_neurons_indices[i]);
+    }
+
+    /* Neurons are linked only to the previous neurons, so one backward pass reaches all of them */
+    for (neuton_u16_t n = p_meta->neurons_num; n-- > 0;)
+    {
+        if (!IS_BIT_SET(p_used_neurons, n))
+            continue;
+
+        /* Links of each neuron are stored as cumulative end indexes, internal links go first */
+        const neuton_u32_t begin        = (n > 0) ? p_meta->p_neuron_external_links_num[n - 1] : 0;
+        const neuton_u32_t internal_end = p_meta->p_neuron_internal_links_num[n];
+        const neuton_u32_t external_end = p_meta->p_neuron_external_links_num[n];
+
+        RETURN_IF((internal_end < begin) || (external_end < internal_end) ||
+                  (external_end > p_meta->weights_num), NEUTON_STATUS_INVALID_ARGUMENT);
+
+        for (neuton_u32_t link = begin; link < internal_end; link++)
+        {
+            RETURN_IF(p_meta->p_neuron_links[link] >= n, NEUTON_STATUS_INVALID_ARGUMENT);
+            SET_BIT(p_used_neurons, p_meta->p_neuron_links[link]);
+        }
+
+        for (neuton_u32_t link = internal_end; link < external_end; link++)
+        {
+            if (p_meta->p_neuron_links[link] < inputs_num)
+                SET_BIT(p_used_inputs, p_meta->p_neuron_links[link]);
+        }
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_features_prune(const neuton_nn_features_mask_t* p_masks,
+                                         neuton_u16_t                     masks_num,
+                                         const neuton_u8_t*               p_used_features,
+                                         neuton_u16_t                     features_num,
+                                         neuton_nn_features_mask_t*       p_pruned_masks,
+                                         neuton_u16_t*                    p_index_map,
+                                         neuton_u16_t*                    p_pruned_num)
+{
+    RETURN_IF((p_masks == NULL) || (p_used_features == NULL) || (p_pruned_masks == NULL) ||
+              (p_index_map == NULL) || (p_pruned_num == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_u16_t feature = 0;
+    neuton_u16_t pruned  = 0;
+
+    for (neuton_u16_t m = 0; m < masks_num; m++)
+    {
+        RETURN_IF(p_masks[m].domain.freq.all != 0, NEUTON_STATUS_NOT_SUPPORTED);
+
+        const neuton_u32_t time = p_masks[m].domain.time.all;
+        neuton_u32_t       used = 0;
+
+        for (neuton_u16_t bit = 0; bit < NEUTON_NN_FEATURE_cnt; bit++)
+        {
+            if (!(time & (1UL << bit)))
+                continue;
+
+            RETURN_IF(feature >= features_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+            if (IS_BIT_SET(p_used_features, feature))
+            {
+                used |= (1UL << bit);
+                p_index_map[feature] = pruned++;
+            }
+            else
+            {
+                p_index_map[feature] = NEUTON_NN_FEATURE_PRUNED;
+            }
+
+            feature++;
+        }
+
+        p_pruned_masks[m]                 = p_masks[m];
+        p_pruned_masks[m].domain.time.all = used;
+    }
+
+    RETURN_IF(feature != features_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    *p_pruned_num = pruned;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_features_compact(const void*         p_src,
+                                           void*               p_dst,
+                                           neuton_sz_t         item_size,
+                                           const neuton_u16_t* p_index_map,
+                                           neuton_u16_t        features_num)
+{
+    RETURN_IF((p_src == NULL) || (p_dst == NULL) || (p_index_map == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_u8_t* p_from = (const neuton_u8_t*)p_src;
+    neuton_u8_t*       p_to   = (neuton_u8_t*)p_dst;
+
+    /* Compacted index is never greater than the original one, so forward copy works in place */
+    for (neuton_u16_t i = 0; i < features_num; i++)
+    {
+        if (p_index_map[i] == NEUTON_NN_FEATURE_PRUNED)
+            continue;
+
+        memmove(p_to + p_index_map[i] * item_size, p_from + i * item_size, item_size);
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_model_remap_inputs(const neuton_nn_model_t* p_model,
+                                             const neuton_u16_t*      p_index_map,
+                                             neuton_u16_t             inputs_num,
+                                             neuton_u16_t             pruned_num,
+                                             neuton_u16_t*            p_links)
+{
+    RETURN_IF((p_model == NULL) || (p_index_map == NULL) || (p_links == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_nn_model_meta_t* p_meta = &p_model->meta;
+    neuton_u32_t                  link   = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        const neuton_u32_t internal_end = p_meta->p_neuron_internal_links_num[n];
+        const neuton_u32_t external_end = p_meta->p_neuron_external_links_num[n];
+
+        RETURN_IF((internal_end < link) || (external_end < internal_end) ||
+                  (external_end > p_meta->weights_num), NEUTON_STATUS_INVALID_ARGUMENT);
+
+        for (; link < internal_end; link++)
+            p_links[link] = p_meta->p_neuron_links[link];
+
+        for (; link < external_end; link++)
+        {
+            const neuton_u16_t input = p_meta->p_neuron_links[link];
+
+            if (input >= inputs_num)
+            {
+                p_links[link] = pruned_num;
+                continue;
+            }
+
+            /* Pruned input could be linked only from the neuron that is not reachable from outputs */
+            p_links[link] = (p_index_map[input] != NEUTON_NN_FEATURE_PRUNED) ? p_index_map[input] : pruned_num;
+        }
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,102 @@
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/features/neuton_nn_extract_features.h>
+#include <neuton/nn/private/features/dsp/neuton_nn_features_timedomain.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void scale_by_division_q16_(neuton_nn_dsp_feature_extraction_t* p_features)
+{
+    const neuton_i32_t* p_extracted = p_features->extracted_memory.p_i32;
+    neuton_u16_t*       p_scaled    = (neuton_u16_t*)p_features->extracted_memory.p_void;
+    const neuton_i32_t* p_min       = p_features->meta.i32.p_min;
+    const neuton_i32_t* p_max       = p_features->meta.i32.p_max;
+
+    for (neuton_u16_t i = 0; i < p_features->overall_num; i++)
+    {
+        neuton_i32_t       feature = p_extracted[i];
+        const neuton_u32_t range   = (neuton_u32_t)(p_max[i] - p_min[i]);
+
+        if (feature < p_min[i])
+            feature = p_min[i];
+        else if (feature > p_max[i])
+            feature = p_max[i];
+
+        p_scaled[i] = (range != 0) ? (neuton_u16_t)(((neuton_u32_t)(feature - p_min[i]) * NEUTON_UINT16_MAX) / range)
+                                   : 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_features_scale_q16(neuton_nn_dsp_pipeline_t* p_dsp)
+{
+    RETURN_IF(p_dsp == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_nn_dsp_feature_extraction_t* p_features = &p_dsp->features;
+    neuton_dsp_scale_plan_t*            p_plan     = p_dsp->p_scale_plan;
+
+    RETURN_IF((p_features->meta.i32.p_min == NULL) || (p_features->meta.i32.p_max == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+
+    if (p_plan == NULL)
+    {
+        scale_by_division_q16_(p_features);
+        return NEUTON_STATUS_SUCCESS;
+    }
+
+    /* Plan items buffer is provided with the plan, so the plan is rebuilt in place */
+    if (p_plan->items_num != p_features->overall_num)
+    {
+        neuton_status_t status = neuton_dsp_scale_plan_init_i32(p_plan, p_plan->p_items,
+                                                                p_features->meta.i32.p_min,
+                                                                p_features->meta.i32.p_max,
+                                                                p_features->overall_num);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+    }
+
+    neuton_dsp_scale_plan_apply_i32_q16(p_plan, p_features->extracted_memory.p_i32, p_features->overall_num,
+                                        (neuton_u16_t*)p_features->extracted_memory.p_void);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_nn_features_scale_reset(neuton_nn_dsp_pipeline_t* p_dsp)
+{
+    if ((p_dsp != NULL) && (p_dsp->p_scale_plan != NULL))
+        p_dsp->p_scale_plan->items_num = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool neuton_nn_features_is_dsp_i16_q16(neuton_nn_iface_process_features_t process_features)
+{
+    return (process_features == neuton_nn_process_features_dsp_i16_q16) ||
+           (process_features == neuton_nn_process_features_dsp_i16_q16_planned) ||
+           (process_features == neuton_nn_process_features_dsp_i16_q16_segmented);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool neuton_nn_features_is_dsp_i16_unscaled(neuton_nn_iface_process_features_t process_features)
+{
+    return (process_features == neuton_nn_process_features_dsp_i16_unscaled) ||
+           (process_features == neuton_nn_process_features_dsp_i16_unscaled_segmented);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_q16_planned)
+{
+    RETURN_IF((p_input == NULL) || (p_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    /* Features are scaled with the model min/max as is, the status is the same as of dsp_i16_q16 */
+    neuton_nn_features_fused_moments_bind(p_dsp->p_fused_moments);
+    extract_features_i16(p_input, p_dsp);
+    neuton_nn_features_fused_moments_bind(NULL);
+
+    return neuton_nn_features_scale_q16(p_dsp);
+}
@@ -0,0 +1,224 @@
+#include <neuton/nn/private/features/dsp/neuton_nn_features_timedomain.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/dsp/statistic/neuton_dsp_segment_stats.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXIS_NONE    (0xFFFFU)
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Segment aggregates of the DSP pipeline processed by the segmented features processing interface.
+ * The precompiled time-domain extraction passes only its statistics context to the pipeline functions,
+ * so the aggregates of the processed pipeline are referenced for the duration of the interface call.
+ */
+static neuton_nn_segment_stats_cache_t* p_bound_ = NULL;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The pipeline is called for the full window of each axis and then for its subwindows,
+ * so the aggregates of the axis subwindows are calculated on the first call and merged for the next ones.
+ */
+static void bind_(neuton_nn_segment_stats_cache_t* p_cache, const neuton_nn_input_t* p_input)
+{
+    if (p_cache == NULL)
+        return;
+
+    const neuton_u16_t segments_num = (p_input->subwindow_num != 0) ? p_input->subwindow_num : 1;
+
+    /* Too many subwindows are extracted without the cached aggregates */
+    p_cache->p_window     = (segments_num <= NEUTON_NN_SEGMENT_STATS_MAX) ? p_input->window_memory.p_i16 : NULL;
+    p_cache->window_size  = p_input->window_size;
+    p_cache->windows_num  = p_input->unique_num_used;
+    p_cache->segments_num = segments_num;
+    p_cache->cached_axis  = AXIS_NONE;
+
+    p_bound_ = p_cache;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void unbind_(neuton_nn_segment_stats_cache_t* p_cache)
+{
+    if (p_cache != NULL)
+    {
+        p_cache->p_window    = NULL;
+        p_cache->cached_axis = AXIS_NONE;
+    }
+
+    p_bound_ = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool merge_cached_(neuton_nn_segment_stats_cache_t* p_cache,
+                          const neuton_i16_t* p_input, neuton_sz_t num, neuton_dsp_segment_stats_i16_t* p_stats)
+{
+    if ((p_cache->p_window == NULL) || (p_input < p_cache->p_window))
+        return false;
+
+    const neuton_sz_t offset = (neuton_sz_t)(p_input - p_cache->p_window);
+    const neuton_u16_t axis = (neuton_u16_t)(offset / p_cache->window_size);
+    const neuton_sz_t position = offset % p_cache->window_size;
+
+    if ((axis >= p_cache->windows_num) || (position + num > p_cache->window_size))
+        return false;
+
+    if (axis != p_cache->cached_axis)
+    {
+        neuton_dsp_segment_stats_split_i16(&p_cache->p_window[(neuton_sz_t)axis * p_cache->window_size],
+                                           p_cache->window_size, p_cache->segments_num, p_cache->segments);
+        p_cache->cached_axis = axis;
+    }
+
+    /* Requested range should be a sequence of the whole segments */
+    neuton_sz_t start = 0;
+    neuton_u16_t i = 0;
+
+    while ((i < p_cache->segments_num) && (start < position))
+        start += p_cache->segments[i++].num;
+
+    if (start != position)
+        return false;
+
+    *p_stats = p_cache->segments[i];
+    neuton_sz_t end = start + p_cache->segments[i++].num;
+
+    while ((i < p_cache->segments_num) && (end < position + num))
+    {
+        neuton_dsp_segment_stats_merge_i16(p_stats, &p_cache->segments[i], p_stats);
+        end += p_cache->segments[i++].num;
+    }
+
+    return end == position + num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Aggregates are shared between the time-domain pipeline functions of the same pipeline call
+ * in the bound cache. The pipeline statistics context is reset for every call, so the
+ * NEUTON_DSP_STAT_CTX_SEGMENT_FLAG in it tells that the shared aggregates belong to the current call.
+ * Without the bound cache the aggregates are calculated to p_local for each function.
+ */
+static const neuton_dsp_segment_stats_i16_t* get_segment_stats_i16_(neuton_i16_t*                   p_input,
+                                                                     neuton_sz_t                     num,
+                                                                     void*                           p_pipeline_ctx,
+                                                                     neuton_dsp_segment_stats_i16_t* p_local)
+{
+    neuton_dsp_stat_ctx_i16_t*       p_ctx   = (neuton_dsp_stat_ctx_i16_t*)p_pipeline_ctx;
+    neuton_nn_segment_stats_cache_t* p_cache = p_bound_;
+
+    if (p_cache == NULL)
+    {
+        neuton_dsp_segment_stats_i16(p_input, (neuton_u16_t)num, p_local);
+
+        if (p_ctx != NULL)
+            neuton_dsp_segment_stats_to_ctx_i16(p_local, p_ctx);
+
+        return p_local;
+    }
+
+    if ((p_ctx == NULL) || !(p_ctx->flags.all & NEUTON_DSP_STAT_CTX_SEGMENT_FLAG))
+    {
+        if (!merge_cached_(p_cache, p_input, num, &p_cache->shared))
+            neuton_dsp_segment_stats_i16(p_input, (neuton_u16_t)num, &p_cache->shared);
+
+        if (p_ctx != NULL)
+        {
+            neuton_dsp_segment_stats_to_ctx_i16(&p_cache->shared, p_ctx);
+            p_ctx->flags.all |= NEUTON_DSP_STAT_CTX_SEGMENT_FLAG;
+        }
+    }
+    return &p_cache->shared;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(utility_segment_stats_i16)
+{
+    (void)p_features;
+    (void)feature_mask;
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_dsp_segment_stats_i16_t local;
+
+    get_segment_stats_i16_(p_input, num, p_pipeline_ctx, &local);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(segment_min_max_range_i16)
+{
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    neuton_i32_t* p_output = p_features;
+
+    if (feature_mask.domain.time.is.min || feature_mask.domain.time.is.max || feature_mask.domain.time.is.range)
+    {
+        neuton_dsp_segment_stats_i16_t        local;
+        const neuton_dsp_segment_stats_i16_t* p_stats = get_segment_stats_i16_(p_input, num, p_pipeline_ctx, &local);
+
+        if (feature_mask.domain.time.is.min)
+            *p_output++ = p_stats->min;
+        if (feature_mask.domain.time.is.max)
+            *p_output++ = p_stats->max;
+        if (feature_mask.domain.time.is.range)
+            *p_output++ = (neuton_i32_t)p_stats->max - p_stats->min;
+    }
+    return (neuton_sz_t)(p_output - p_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_FEATURE_FUNCTION_I16(segment_zcr_i16)
+{
+    (void)get_argument;
+    (void)p_argument_ctx;
+
+    if (!feature_mask.domain.time.is.zcr)
+        return 0;
+
+    neuton_dsp_segment_stats_i16_t local;
+
+    *p_features = neuton_dsp_segment_stats_zcr_i16(get_segment_stats_i16_(p_input, num, p_pipeline_ctx, &local));
+    return 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_q16_segmented)
+{
+    RETURN_IF((p_input == NULL) || (p_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    bind_(p_dsp->p_segment_stats, p_input);
+
+    neuton_status_t status = neuton_nn_process_features_dsp_i16_q16_planned(p_input, p_dsp);
+
+    /* Window is changed after the extraction, so the cached aggregates are not valid anymore */
+    unbind_(p_dsp->p_segment_stats);
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_unscaled_segmented)
+{
+    RETURN_IF((p_input == NULL) || (p_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    bind_(p_dsp->p_segment_stats, p_input);
+
+    neuton_status_t status = neuton_nn_process_features_dsp_i16_unscaled(p_input, p_dsp);
+
+    /* Window is changed after the extraction, so the cached aggregates are not valid anymore */
+    unbind_(p_dsp->p_segment_stats);
+
+    return status;
+}
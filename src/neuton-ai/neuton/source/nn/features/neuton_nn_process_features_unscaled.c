@@ -0,0 +1,21 @@
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/features/neuton_nn_extract_features.h>
+#include <neuton/nn/private/features/dsp/neuton_nn_features_timedomain.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_PROCESS_FEATURES_INTERFACE(dsp_i16_unscaled)
+{
+    RETURN_IF((p_input == NULL) || (p_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_nn_features_fused_moments_bind(p_dsp->p_fused_moments);
+
+    const neuton_sz_t extracted_num = extract_features_i16(p_input, p_dsp);
+
+    neuton_nn_features_fused_moments_bind(NULL);
+
+    RETURN_IF(extracted_num != p_dsp->features.overall_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,52 @@
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sigmoid is evaluated in base 2 as 1 / (1 + 2^x), x = -(coeff * summ) with fractional bits,
+ * between the integer points of x its value is linearly interpolated.
+ * Lookup table holds the values in the integer points x = 0, 1, 2, ... while they are non-zero.
+ */
+static const neuton_u16_t SIGMOID_LUT_Q16[] = {
+    32768, 21845, 13107, 7281, 3855, 1985, 1008, 508, 255, 127, 63, 31, 15, 7, 3, 1, 0
+};
+
+#define SIGMOID_LUT_Q16_SIZE (sizeof(SIGMOID_LUT_Q16) / sizeof(SIGMOID_LUT_Q16[0]))
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u16_t sigmoid_point_q16_(neuton_u32_t x)
+{
+    return (x < SIGMOID_LUT_Q16_SIZE) ? SIGMOID_LUT_Q16[x] : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_nn_sigmoid_lut_q16(neuton_u16_t coeff, neuton_i64_t summ)
+{
+    /* Product is Q16 fixed point sigmoid argument, only its lower 32 bits are used */
+    const neuton_i64_t x    = (neuton_i64_t)((neuton_u64_t)coeff * (neuton_u64_t)summ) >> 25;
+    const neuton_i32_t x32  = (neuton_i32_t)x;
+    const neuton_u32_t sign = (neuton_u32_t)(x32 >> 31);
+    const neuton_u32_t abs  = ((neuton_u32_t)x32 ^ sign) - sign;
+
+    if (abs == 0)
+        return SIGMOID_LUT_Q16[0];
+
+    const neuton_u32_t point = abs >> 16;
+    const neuton_i32_t frac  = (neuton_i32_t)(abs & NEUTON_UINT16_MAX);
+    const neuton_i32_t y0    = sigmoid_point_q16_(point);
+
+    /* Integer points of positive argument are mirrored as the bitwise complement */
+    if (frac == 0)
+        return (neuton_u16_t)((x > 0) ? (NEUTON_UINT16_MAX - y0) : y0);
+
+    const neuton_i32_t dy = (neuton_i32_t)sigmoid_point_q16_(point + 1) - y0;
+    const neuton_u16_t y  = (neuton_u16_t)(y0 + ((dy * frac) >> 16));
+
+    if (x <= 0)
+        return y;
+
+    return (y != 0) ? (neuton_u16_t)(0U - y) : NEUTON_UINT16_MAX;
+}
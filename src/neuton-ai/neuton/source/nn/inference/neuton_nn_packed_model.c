@@ -0,0 +1,305 @@
+#include <neuton/nn/private/inference/neuton_nn_packed_model.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define IS_RELU_ACTIVATION(mask, n) (bool)((mask)[(n) >> 3] & (1U << ((n) % 8)))
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_model_pack_q16(const neuton_nn_model_t* p_model,
+                                         neuton_u16_t* p_records, neuton_u32_t records_num)
+{
+    RETURN_IF((p_model == NULL) || (p_records == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_nn_model_meta_t*       p_meta   = &p_model->meta;
+    const neuton_nn_model_params_q16_t* p_params = &p_model->params.q16;
+
+    RETURN_IF(records_num < NEUTON_NN_PACKED_Q16_RECORDS_NUM(p_meta->neurons_num, p_meta->weights_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u32_t link = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        /* Links of each neuron are stored as cumulative end indexes, internal links go first */
+        const neuton_u32_t internal_end = p_meta->p_neuron_internal_links_num[n];
+        const neuton_u32_t external_end = p_meta->p_neuron_external_links_num[n];
+
+        RETURN_IF((internal_end < link) || (external_end < internal_end) ||
+                  (external_end > p_meta->weights_num), NEUTON_STATUS_INVALID_ARGUMENT);
+        RETURN_IF((internal_end - link > NEUTON_NN_PACKED_LINKS_NUM_MASK), NEUTON_STATUS_NOT_SUPPORTED);
+
+        *p_records++ = (neuton_u16_t)(internal_end - link) |
+                       (IS_RELU_ACTIVATION(p_meta->p_neuron_act_type_mask, n) ? NEUTON_NN_PACKED_ACT_RELU_FLAG : 0);
+        *p_records++ = (neuton_u16_t)(external_end - internal_end);
+        *p_records++ = p_params->p_act_weights[n];
+
+        for (; link < external_end; link++)
+        {
+            *p_records++ = p_meta->p_neuron_links[link];
+            *p_records++ = (neuton_u16_t)p_params->p_weights[link];
+        }
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Finds scale multiplier and shift of the neuron, so that
+ * (sum(weight_q8 * (value >> 1)) * mult) >> shift == sum(weight_q16 * value),
+ * multiplier is normalized to the full 16-bit range for better precision.
+ */
+static void q8w_scale_(neuton_u32_t weight_absmax, neuton_u16_t* p_mult, neuton_u16_t* p_shift)
+{
+    *p_mult  = 0;
+    *p_shift = 1;
+
+    if (weight_absmax == 0)
+        return;
+
+    /* Weight scale is weight_absmax / NEUTON_INT8_QFACTOR and values are scaled by 1/2 */
+    for (neuton_u16_t shift = 1; shift < 48; shift++)
+    {
+        const neuton_u64_t scaled = ((neuton_u64_t)(2 * weight_absmax) << shift);
+        const neuton_u64_t mult   = (scaled + NEUTON_INT8_QFACTOR / 2) / NEUTON_INT8_QFACTOR;
+
+        if (mult > NEUTON_UINT16_MAX)
+            break;
+
+        *p_mult  = (neuton_u16_t)mult;
+        *p_shift = shift;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Rounds the 16-bit weight scaled to the full 8-bit range by the neuron maximum absolute weight */
+__NEUTON_STATIC_FORCEINLINE neuton_i8_t q8w_weight_(neuton_i16_t weight, neuton_u32_t weight_absmax)
+{
+    if (weight_absmax == 0)
+        return 0;
+
+    const neuton_u32_t abs = (neuton_u32_t)((weight < 0) ? -weight : weight);
+    const neuton_i32_t q8  = (neuton_i32_t)((abs * NEUTON_INT8_QFACTOR + weight_absmax / 2) / weight_absmax);
+
+    return (neuton_i8_t)((weight < 0) ? -q8 : q8);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_model_requantize_q8w(const neuton_nn_model_t* p_model,
+                                               neuton_u16_t* p_records, neuton_u32_t records_num,
+                                               neuton_u32_t* p_records_used)
+{
+    RETURN_IF((p_model == NULL) || (p_records == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_nn_model_meta_t*       p_meta   = &p_model->meta;
+    const neuton_nn_model_params_q16_t* p_params = &p_model->params.q16;
+
+    RETURN_IF(records_num < NEUTON_NN_PACKED_Q8W_RECORDS_NUM(p_meta->neurons_num, p_meta->weights_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u16_t* p_begin = p_records;
+    neuton_u32_t  link    = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        /* Links of each neuron are stored as cumulative end indexes, internal links go first */
+        const neuton_u32_t internal_end = p_meta->p_neuron_internal_links_num[n];
+        const neuton_u32_t external_end = p_meta->p_neuron_external_links_num[n];
+
+        RETURN_IF((internal_end < link) || (external_end < internal_end) ||
+                  (external_end > p_meta->weights_num), NEUTON_STATUS_INVALID_ARGUMENT);
+        RETURN_IF((internal_end - link > NEUTON_NN_PACKED_LINKS_NUM_MASK), NEUTON_STATUS_NOT_SUPPORTED);
+
+        const neuton_u32_t links_num     = external_end - link;
+        neuton_u32_t       weight_absmax = 0;
+
+        for (neuton_u32_t i = link; i < external_end; i++)
+        {
+            const neuton_i32_t weight = p_params->p_weights[i];
+            const neuton_u32_t abs    = (neuton_u32_t)((weight < 0) ? -weight : weight);
+
+            if (abs > weight_absmax)
+                weight_absmax = abs;
+        }
+
+        *p_records++ = (neuton_u16_t)(internal_end - link) |
+                       (IS_RELU_ACTIVATION(p_meta->p_neuron_act_type_mask, n) ? NEUTON_NN_PACKED_ACT_RELU_FLAG : 0);
+        *p_records++ = (neuton_u16_t)(external_end - internal_end);
+        *p_records++ = p_params->p_act_weights[n];
+        q8w_scale_(weight_absmax, &p_records[0], &p_records[1]);
+        p_records += 2;
+
+        for (neuton_u32_t i = link; i < external_end; i++)
+            *p_records++ = p_meta->p_neuron_links[i];
+
+        /* 8-bit weights are stored two per word in little-endian order and padded with zeros */
+        neuton_u16_t* p_weights = p_records;
+        p_records += NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(links_num);
+
+        for (neuton_u16_t* p = p_weights; p < p_records; p++)
+            *p = 0;
+
+        for (neuton_u32_t i = 0; i < links_num; i++, link++)
+            p_weights[i / 2] |= (neuton_u16_t)((neuton_u8_t)q8w_weight_(p_params->p_weights[link], weight_absmax)
+                                               << (8 * (i % 2)));
+    }
+
+    if (p_records_used != NULL)
+        *p_records_used = (neuton_u32_t)(p_records - p_begin);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Maximum fraction bits of the fused weights */
+#define FUSED_SHIFT_MAX 24
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Rounds the weight of the feature scaled to the 16-bit quantized range,
+ * (weight * __NEURON_BIAS_Q16 << shift) / (max - min), feature with empty range is scaled to zero
+ */
+static neuton_i64_t fused_weight_(neuton_i16_t weight, neuton_i32_t min, neuton_i32_t max, neuton_u16_t shift)
+{
+    const neuton_i64_t range = (neuton_i64_t)max - min;
+
+    if (range == 0)
+        return 0;
+
+    const neuton_i64_t abs    = (weight < 0) ? -(neuton_i64_t)weight : weight;
+    const neuton_i64_t scaled = ((abs * __NEURON_BIAS_Q16 << shift) + range / 2) / range;
+
+    return (weight < 0) ? -scaled : scaled;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void write_u32_(neuton_u16_t* p_record, neuton_u32_t value)
+{
+    p_record[0] = (neuton_u16_t)value;
+    p_record[1] = (neuton_u16_t)(value >> 16);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_model_fuse_scaling_q16(const neuton_nn_model_t* p_model,
+                                                 const neuton_i32_t* p_features_min,
+                                                 const neuton_i32_t* p_features_max,
+                                                 neuton_u16_t features_num,
+                                                 neuton_u16_t* p_records, neuton_u32_t records_num,
+                                                 neuton_u32_t* p_records_used)
+{
+    RETURN_IF((p_model == NULL) || (p_features_min == NULL) || (p_features_max == NULL) || (p_records == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+
+    const neuton_nn_model_meta_t*       p_meta   = &p_model->meta;
+    const neuton_nn_model_params_q16_t* p_params = &p_model->params.q16;
+
+    RETURN_IF(p_meta->uses_as_input.features.input, NEUTON_STATUS_NOT_SUPPORTED);
+    RETURN_IF(records_num < NEUTON_NN_PACKED_FUSED_RECORDS_NUM(p_meta->neurons_num, p_meta->weights_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    for (neuton_u16_t i = 0; i < features_num; i++)
+        RETURN_IF(p_features_max[i] < p_features_min[i], NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u16_t* p_begin = p_records;
+    neuton_u32_t  link    = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        /* Links of each neuron are stored as cumulative end indexes, internal links go first */
+        const neuton_u32_t internal_end = p_meta->p_neuron_internal_links_num[n];
+        const neuton_u32_t external_end = p_meta->p_neuron_external_links_num[n];
+
+        RETURN_IF((internal_end < link) || (external_end < internal_end) ||
+                  (external_end > p_meta->weights_num), NEUTON_STATUS_INVALID_ARGUMENT);
+        RETURN_IF((internal_end - link > NEUTON_NN_PACKED_LINKS_NUM_MASK), NEUTON_STATUS_NOT_SUPPORTED);
+
+        /* The largest shift that keeps all fused weights of the neuron in 32 bits */
+        neuton_u16_t shift          = FUSED_SHIFT_MAX;
+        neuton_u16_t features_links = 0;
+
+        for (neuton_u32_t i = internal_end; i < external_end; i++)
+        {
+            const neuton_u16_t feature = p_meta->p_neuron_links[i];
+
+            if (feature >= features_num)
+                continue;
+
+            features_links++;
+
+            while (shift > 0)
+            {
+                const neuton_i64_t fused = fused_weight_(p_params->p_weights[i], p_features_min[feature],
+                                                         p_features_max[feature], shift);
+
+                if ((fused <= NEUTON_INT32_MAX) && (fused >= -NEUTON_INT32_MAX))
+                    break;
+
+                shift--;
+            }
+        }
+
+        /* Bias input is folded with the scaling offsets and the mean rounding error of the scaling division */
+        neuton_i64_t bias = 0;
+
+        for (neuton_u32_t i = internal_end; i < external_end; i++)
+        {
+            const neuton_u16_t feature = p_meta->p_neuron_links[i];
+            const neuton_i64_t weight  = p_params->p_weights[i];
+
+            if (feature >= features_num)
+            {
+                bias += (weight * __NEURON_BIAS_Q16) * ((neuton_i64_t)1 << shift);
+                continue;
+            }
+
+            if (p_features_max[feature] == p_features_min[feature])
+                continue;
+
+            bias -= fused_weight_(p_params->p_weights[i], p_features_min[feature], p_features_max[feature], shift) *
+                    p_features_min[feature];
+            bias -= (weight * ((neuton_i64_t)1 << shift)) / 2;
+        }
+
+        *p_records++ = (neuton_u16_t)(internal_end - link) |
+                       (IS_RELU_ACTIVATION(p_meta->p_neuron_act_type_mask, n) ? NEUTON_NN_PACKED_ACT_RELU_FLAG : 0);
+        *p_records++ = features_links;
+        *p_records++ = p_params->p_act_weights[n];
+        *p_records++ = shift;
+        write_u32_(p_records, (neuton_u32_t)(neuton_u64_t)bias);
+        write_u32_(p_records + 2, (neuton_u32_t)((neuton_u64_t)bias >> 32));
+        p_records += 4;
+
+        for (; link < internal_end; link++)
+        {
+            *p_records++ = p_meta->p_neuron_links[link];
+            *p_records++ = (neuton_u16_t)p_params->p_weights[link];
+        }
+
+        for (; link < external_end; link++)
+        {
+            const neuton_u16_t feature = p_meta->p_neuron_links[link];
+
+            if (feature >= features_num)
+                continue;
+
+            *p_records++ = feature;
+            write_u32_(p_records, (neuton_u32_t)fused_weight_(p_params->p_weights[link], p_features_min[feature],
+                                                              p_features_max[feature], shift));
+            p_records += 2;
+        }
+    }
+
+    if (p_records_used != NULL)
+        *p_records_used = (neuton_u32_t)(p_records - p_begin);
+
+    return NEUTON_STATUS_SUCCESS;
+}
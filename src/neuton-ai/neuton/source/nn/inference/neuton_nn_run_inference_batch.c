@@ -0,0 +1,301 @@
+#include <neuton/neuton.h>
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+#include <neuton/nn/private/output/neuton_nn_output_propagate.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Value of the bias input, that is referenced by an out of range external link */
+#define BIAS_INPUT_Q16  NEUTON_UINT16_MAX
+
+#define IS_RELU_ACTIVATION(mask, n) (bool)((mask)[(n) >> 3] & (1U << ((n) % 8)))
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Chunk of the batch evaluated together, neurons and inputs of the vector i are stored at
+ * p_neurons[i * neurons_num] and p_inputs[i * inputs_num], models with fused features scaling
+ * take the unscaled features p_features[i * inputs_num] instead of the scaled inputs
+ */
+typedef struct batch_chunk_s
+{
+    const neuton_u16_t* p_inputs;
+    const neuton_i32_t* p_features;
+    const neuton_i32_t* p_features_min;
+    const neuton_i32_t* p_features_max;
+    neuton_u16_t*       p_neurons;
+    neuton_u16_t        inputs_num;
+    neuton_u16_t        neurons_num;
+    neuton_u16_t        num;
+    neuton_i64_t        summ[NEUTON_NN_BATCH_CHUNK_SIZE];
+} batch_chunk_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void mac_internal_(batch_chunk_t* p_chunk, neuton_i32_t weight,
+                                               neuton_u16_t index, neuton_u16_t value_shift)
+{
+    const neuton_u16_t* p_value = &p_chunk->p_neurons[index];
+
+    for (neuton_u16_t i = 0; i < p_chunk->num; i++, p_value += p_chunk->neurons_num)
+        p_chunk->summ[i] += weight * (neuton_i32_t)(*p_value >> value_shift);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void mac_external_(batch_chunk_t* p_chunk, neuton_i32_t weight,
+                                               neuton_u16_t index, neuton_u16_t value_shift)
+{
+    if (index >= p_chunk->inputs_num)
+    {
+        const neuton_i64_t bias = weight * (neuton_i32_t)(BIAS_INPUT_Q16 >> value_shift);
+
+        for (neuton_u16_t i = 0; i < p_chunk->num; i++)
+            p_chunk->summ[i] += bias;
+        return;
+    }
+
+    const neuton_u16_t* p_value = &p_chunk->p_inputs[index];
+
+    for (neuton_u16_t i = 0; i < p_chunk->num; i++, p_value += p_chunk->inputs_num)
+        p_chunk->summ[i] += weight * (neuton_i32_t)(*p_value >> value_shift);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void mac_fused_(batch_chunk_t* p_chunk, neuton_i32_t weight, neuton_u16_t index)
+{
+    const neuton_i32_t  min       = p_chunk->p_features_min[index];
+    const neuton_i32_t  max       = p_chunk->p_features_max[index];
+    const neuton_i32_t* p_feature = &p_chunk->p_features[index];
+
+    /* Features are clipped to the scaling range as the separate scaling does */
+    for (neuton_u16_t i = 0; i < p_chunk->num; i++, p_feature += p_chunk->inputs_num)
+        p_chunk->summ[i] += (neuton_i64_t)weight * CLIP_MINMAX(*p_feature, min, max);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Reads 32-bit value stored in the packed record from the least significant word */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t read_u32_(const neuton_u16_t* p_record)
+{
+    return (neuton_u32_t)p_record[0] | ((neuton_u32_t)p_record[1] << 16);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE void activate_(batch_chunk_t* p_chunk, neuton_u16_t n,
+                                           neuton_u16_t coeff, bool is_relu)
+{
+    neuton_u16_t* p_neuron = &p_chunk->p_neurons[n];
+
+    for (neuton_u16_t i = 0; i < p_chunk->num; i++, p_neuron += p_chunk->neurons_num)
+    {
+        *p_neuron = is_relu ? neuton_nn_relu_q16(coeff, p_chunk->summ[i])
+                            : NEUTON_NN_SIGMOID_Q16(coeff, p_chunk->summ[i]);
+        p_chunk->summ[i] = 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void run_chunk_q16_(const neuton_nn_model_t* p_model, batch_chunk_t* p_chunk)
+{
+    const neuton_nn_model_meta_t*       p_meta   = &p_model->meta;
+    const neuton_nn_model_params_q16_t* p_params = &p_model->params.q16;
+
+    neuton_u32_t link = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        /* Links of each neuron are stored as cumulative end indexes, internal links go first */
+        for (; link < p_meta->p_neuron_internal_links_num[n]; link++)
+            mac_internal_(p_chunk, p_params->p_weights[link], p_meta->p_neuron_links[link], 0);
+
+        for (; link < p_meta->p_neuron_external_links_num[n]; link++)
+            mac_external_(p_chunk, p_params->p_weights[link], p_meta->p_neuron_links[link], 0);
+
+        activate_(p_chunk, n, p_params->p_act_weights[n], IS_RELU_ACTIVATION(p_meta->p_neuron_act_type_mask, n));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void run_chunk_packed_q16_(const neuton_nn_model_t* p_model, batch_chunk_t* p_chunk)
+{
+    const neuton_u16_t* p_record = p_model->params.packed_q16.p_records;
+
+    for (neuton_u16_t n = 0; n < p_model->meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t external_num = *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+
+        for (neuton_u16_t i = header & NEUTON_NN_PACKED_LINKS_NUM_MASK; i > 0; i--, p_record += 2)
+            mac_internal_(p_chunk, (neuton_i16_t)p_record[1], p_record[0], 0);
+
+        for (neuton_u16_t i = external_num; i > 0; i--, p_record += 2)
+            mac_external_(p_chunk, (neuton_i16_t)p_record[1], p_record[0], 0);
+
+        activate_(p_chunk, n, coeff, header & NEUTON_NN_PACKED_ACT_RELU_FLAG);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void run_chunk_packed_q8w_(const neuton_nn_model_t* p_model, batch_chunk_t* p_chunk)
+{
+    const neuton_u16_t* p_record = p_model->params.packed_q8w.p_records;
+
+    for (neuton_u16_t n = 0; n < p_model->meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t internal_num = header & NEUTON_NN_PACKED_LINKS_NUM_MASK;
+        const neuton_u16_t links_num    = internal_num + *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+        const neuton_u16_t scale_mult   = *p_record++;
+        const neuton_u16_t scale_shift  = *p_record++;
+
+        const neuton_u16_t* p_links   = p_record;
+        const neuton_u8_t*  p_weights = (const neuton_u8_t*)(p_record + links_num);
+
+        /* Neuron and input values are converted to Q15 as in the single vector inference */
+        neuton_u16_t link = 0;
+
+        for (; link < internal_num; link++)
+            mac_internal_(p_chunk, (neuton_i8_t)p_weights[link], p_links[link], 1);
+
+        for (; link < links_num; link++)
+            mac_external_(p_chunk, (neuton_i8_t)p_weights[link], p_links[link], 1);
+
+        p_record += links_num + NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(links_num);
+
+        for (neuton_u16_t i = 0; i < p_chunk->num; i++)
+            p_chunk->summ[i] = ((p_chunk->summ[i] * scale_mult >> (scale_shift - 1)) + 1) >> 1;
+
+        activate_(p_chunk, n, coeff, header & NEUTON_NN_PACKED_ACT_RELU_FLAG);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void run_chunk_packed_fused_(const neuton_nn_model_t* p_model, batch_chunk_t* p_chunk)
+{
+    const neuton_u16_t* p_record = p_model->params.packed_fused.p_records;
+
+    for (neuton_u16_t n = 0; n < p_model->meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t internal_num = header & NEUTON_NN_PACKED_LINKS_NUM_MASK;
+        const neuton_u16_t external_num = *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+        const neuton_u16_t fused_shift  = *p_record++;
+
+        const neuton_i64_t fused = (neuton_i64_t)((neuton_u64_t)read_u32_(p_record) |
+                                                  ((neuton_u64_t)read_u32_(p_record + 2) << 32));
+
+        const neuton_u16_t* p_internal = p_record + 4;
+
+        p_record = p_internal + 2 * internal_num;
+
+        /* Fused features sum is shifted before the internal links are added, as in the single vector inference */
+        for (neuton_u16_t i = 0; i < p_chunk->num; i++)
+            p_chunk->summ[i] = fused;
+
+        for (neuton_u16_t i = external_num; i > 0; i--, p_record += 3)
+            mac_fused_(p_chunk, (neuton_i32_t)read_u32_(p_record + 1), p_record[0]);
+
+        for (neuton_u16_t i = 0; i < p_chunk->num; i++)
+            p_chunk->summ[i] >>= fused_shift;
+
+        for (neuton_u16_t i = internal_num; i > 0; i--, p_internal += 2)
+            mac_internal_(p_chunk, (neuton_i16_t)p_internal[1], p_internal[0], 0);
+
+        activate_(p_chunk, n, coeff, header & NEUTON_NN_PACKED_ACT_RELU_FLAG);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_run_inference_batch(neuton_nn_t* p_nn,
+                                              const void*  p_inputs,
+                                              neuton_u16_t batch_num,
+                                              void*        p_neurons,
+                                              void*        p_outputs)
+{
+    RETURN_IF((p_nn == NULL) || (p_inputs == NULL) || (p_neurons == NULL) || (p_outputs == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+
+    void (*run_chunk)(const neuton_nn_model_t*, batch_chunk_t*);
+
+    if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_q16)
+        run_chunk = run_chunk_q16_;
+    else if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_q16)
+        run_chunk = run_chunk_packed_q16_;
+    else if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_q8w)
+        run_chunk = run_chunk_packed_q8w_;
+    else if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_fused)
+        run_chunk = run_chunk_packed_fused_;
+    else
+        return NEUTON_STATUS_NOT_SUPPORTED;
+
+    neuton_sz_t output_size;
+
+    if (p_nn->interfaces.propagate_outputs == neuton_nn_output_dequantize_q16_f32)
+        output_size = sizeof(neuton_f32_t);
+    else if (p_nn->interfaces.propagate_outputs == neuton_nn_output_propagate_q16)
+        output_size = sizeof(neuton_u16_t);
+    else
+        return NEUTON_STATUS_NOT_SUPPORTED;
+
+    batch_chunk_t chunk = {
+        .p_inputs       = (const neuton_u16_t*)p_inputs,
+        .p_features     = (const neuton_i32_t*)p_inputs,
+        .p_neurons      = (neuton_u16_t*)p_neurons,
+        .neurons_num    = p_nn->model.meta.neurons_num,
+        .inputs_num     = p_nn->model.meta.uses_as_input.features.input ?
+                              (neuton_u16_t)(p_nn->input.unique_num_used * p_nn->input.window_size) :
+                              p_nn->p_dsp->features.overall_num,
+    };
+
+    if (run_chunk == run_chunk_packed_fused_)
+    {
+        chunk.p_features_min = p_nn->p_dsp->features.meta.i32.p_min;
+        chunk.p_features_max = p_nn->p_dsp->features.meta.i32.p_max;
+    }
+
+    for (neuton_u16_t i = 0; i < NEUTON_NN_BATCH_CHUNK_SIZE; i++)
+        chunk.summ[i] = 0;
+
+    for (neuton_u16_t done = 0; done < batch_num; done += chunk.num)
+    {
+        const neuton_u16_t left = batch_num - done;
+
+        chunk.num = (left < NEUTON_NN_BATCH_CHUNK_SIZE) ? left : NEUTON_NN_BATCH_CHUNK_SIZE;
+        run_chunk(&p_nn->model, &chunk);
+
+        chunk.p_inputs += chunk.num * chunk.inputs_num;
+        chunk.p_features += chunk.num * chunk.inputs_num;
+        chunk.p_neurons += chunk.num * chunk.neurons_num;
+    }
+
+    /* Outputs of every vector are propagated by the model interface from its neurons */
+    neuton_u16_t* p_model_neurons = p_nn->model.params.q16.p_neurons;
+    void*         p_model_outputs = p_nn->model.output.memory.p_void;
+    neuton_u8_t*  p_output        = (neuton_u8_t*)p_outputs;
+
+    for (neuton_u16_t i = 0; i < batch_num; i++)
+    {
+        p_nn->model.params.q16.p_neurons = (neuton_u16_t*)p_neurons + i * chunk.neurons_num;
+        p_nn->model.output.memory.p_void  = p_output;
+        p_nn->interfaces.propagate_outputs(&p_nn->model);
+
+        p_output += p_nn->model.output.num * output_size;
+    }
+
+    p_nn->model.params.q16.p_neurons = p_model_neurons;
+    p_nn->model.output.memory.p_void  = p_model_outputs;
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,58 @@
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Value of the bias input, that is referenced by an out of range external link */
+#define BIAS_INPUT_Q16  NEUTON_UINT16_MAX
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_nn_run_model_inference_packed_q16(neuton_nn_t* p_nn)
+{
+    const neuton_u16_t* p_record  = p_nn->model.params.packed_q16.p_records;
+    neuton_u16_t*       p_neurons = p_nn->model.params.packed_q16.p_neurons;
+    const neuton_u16_t* p_input;
+    neuton_u16_t        input_num;
+
+    if (p_nn->model.meta.uses_as_input.features.input)
+    {
+        p_input   = (const neuton_u16_t*)p_nn->input.window_memory.p_void;
+        input_num = (neuton_u16_t)(p_nn->input.unique_num_used * p_nn->input.window_size);
+    }
+    else
+    {
+        p_input   = (const neuton_u16_t*)p_nn->p_dsp->features.extracted_memory.p_void;
+        input_num = p_nn->p_dsp->features.overall_num;
+    }
+
+    for (neuton_u16_t n = 0; n < p_nn->model.meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t external_num = *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+
+        neuton_i64_t summ = 0;
+
+        for (neuton_u16_t i = header & NEUTON_NN_PACKED_LINKS_NUM_MASK; i > 0; i--)
+        {
+            const neuton_u16_t index  = *p_record++;
+            const neuton_i16_t weight = (neuton_i16_t)*p_record++;
+
+            summ += (neuton_i32_t)weight * p_neurons[index];
+        }
+
+        for (neuton_u16_t i = external_num; i > 0; i--)
+        {
+            const neuton_u16_t index  = *p_record++;
+            const neuton_i16_t weight = (neuton_i16_t)*p_record++;
+            const neuton_u16_t value  = (index < input_num) ? p_input[index] : BIAS_INPUT_Q16;
+
+            summ += (neuton_i32_t)weight * value;
+        }
+
+        p_neurons[n] = (header & NEUTON_NN_PACKED_ACT_RELU_FLAG) ? neuton_nn_relu_q16(coeff, summ)
+                                                                 : NEUTON_NN_SIGMOID_Q16(coeff, summ);
+    }
+}
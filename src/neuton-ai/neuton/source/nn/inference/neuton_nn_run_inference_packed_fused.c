@@ -0,0 +1,61 @@
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Reads 32-bit value stored in the packed record from the least significant word */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t read_u32_(const neuton_u16_t* p_record)
+{
+    return (neuton_u32_t)p_record[0] | ((neuton_u32_t)p_record[1] << 16);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_nn_run_model_inference_packed_fused(neuton_nn_t* p_nn)
+{
+    const neuton_u16_t* p_record   = p_nn->model.params.packed_fused.p_records;
+    neuton_u16_t*       p_neurons  = p_nn->model.params.packed_fused.p_neurons;
+    const neuton_i32_t* p_features = (const neuton_i32_t*)p_nn->p_dsp->features.extracted_memory.p_void;
+    const neuton_i32_t* p_min      = p_nn->p_dsp->features.meta.i32.p_min;
+    const neuton_i32_t* p_max      = p_nn->p_dsp->features.meta.i32.p_max;
+
+    for (neuton_u16_t n = 0; n < p_nn->model.meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t external_num = *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+        const neuton_u16_t fused_shift  = *p_record++;
+
+        neuton_i64_t fused = (neuton_i64_t)((neuton_u64_t)read_u32_(p_record) |
+                                            ((neuton_u64_t)read_u32_(p_record + 2) << 32));
+        neuton_i64_t summ  = 0;
+
+        p_record += 4;
+
+        for (neuton_u16_t i = header & NEUTON_NN_PACKED_LINKS_NUM_MASK; i > 0; i--)
+        {
+            const neuton_u16_t index  = *p_record++;
+            const neuton_i16_t weight = (neuton_i16_t)*p_record++;
+
+            summ += (neuton_i32_t)weight * p_neurons[index];
+        }
+
+        for (neuton_u16_t i = external_num; i > 0; i--)
+        {
+            const neuton_u16_t index  = p_record[0];
+            const neuton_i32_t weight = (neuton_i32_t)read_u32_(p_record + 1);
+
+            /* Features are clipped to the scaling range as the separate scaling does */
+            const neuton_i32_t feature = CLIP_MINMAX(p_features[index], p_min[index], p_max[index]);
+
+            fused += (neuton_i64_t)weight * feature;
+            p_record += 3;
+        }
+
+        summ += fused >> fused_shift;
+
+        p_neurons[n] = (header & NEUTON_NN_PACKED_ACT_RELU_FLAG) ? neuton_nn_relu_q16(coeff, summ)
+                                                                 : NEUTON_NN_SIGMOID_Q16(coeff, summ);
+    }
+}
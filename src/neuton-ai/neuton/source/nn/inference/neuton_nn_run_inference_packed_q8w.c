@@ -0,0 +1,151 @@
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+#include <neuton/private/neuton_c_intrinsics.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Value of the bias input, that is referenced by an out of range external link */
+#define BIAS_INPUT_Q16  NEUTON_UINT16_MAX
+
+/** Number of links processed by two dual 16-bit MAC instructions */
+#define LINKS_PER_STEP  4
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct link_values_ctx_s
+{
+    const neuton_u16_t* p_neurons;
+    const neuton_u16_t* p_input;
+    neuton_u16_t        input_num;
+} link_values_ctx_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Previous neuron value of the internal link converted to Q15, so it could be used as a signed 16-bit MAC operand */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t internal_q15_(const link_values_ctx_t* p_ctx, neuton_u16_t index)
+{
+    return p_ctx->p_neurons[index] >> 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Input value of the external link converted to Q15, the bias input is selected without a branch */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t external_q15_(const link_values_ctx_t* p_ctx, neuton_u16_t index)
+{
+    return ((index < p_ctx->input_num) ? p_ctx->p_input[index] : BIAS_INPUT_Q16) >> 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Value of any link of the neuron, links beyond the neuron links number are zero padding of the weights.
+ * Used only for the group of links on the internal/external boundary and for the last padded group.
+ */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t link_value_q15_(const link_values_ctx_t* p_ctx,
+                                                         const neuton_u16_t* p_links, neuton_u16_t link,
+                                                         neuton_u16_t internal_num, neuton_u16_t links_num)
+{
+    if (link >= links_num)
+        return 0;
+
+    return (link < internal_num) ? internal_q15_(p_ctx, p_links[link]) : external_q15_(p_ctx, p_links[link]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Accumulates the group of four links, weights bytes { w0, w1, w2, w3 } are split to halfwords { w0, w2 } and { w1, w3 } */
+__NEUTON_STATIC_FORCEINLINE neuton_i64_t mac_group_(neuton_i64_t acc, const neuton_u16_t* p_weights,
+                                                    neuton_u32_t v0, neuton_u32_t v1,
+                                                    neuton_u32_t v2, neuton_u32_t v3)
+{
+    const neuton_u32_t weights = (neuton_u32_t)p_weights[0] | ((neuton_u32_t)p_weights[1] << 16);
+
+    const neuton_u32_t w02 = __NEUTON_SXTB16(weights);
+    const neuton_u32_t w13 = __NEUTON_SXTB16(__NEUTON_ROR(weights, 8));
+
+    acc = __NEUTON_SMLALD(w02, v0 | (v2 << 16), acc);
+    return __NEUTON_SMLALD(w13, v1 | (v3 << 16), acc);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void neuton_nn_run_model_inference_packed_q8w(neuton_nn_t* p_nn)
+{
+    const neuton_u16_t* p_record  = p_nn->model.params.packed_q8w.p_records;
+    neuton_u16_t*       p_neurons = p_nn->model.params.packed_q8w.p_neurons;
+    link_values_ctx_t   ctx       = { .p_neurons = p_neurons };
+
+    if (p_nn->model.meta.uses_as_input.features.input)
+    {
+        ctx.p_input   = (const neuton_u16_t*)p_nn->input.window_memory.p_void;
+        ctx.input_num = (neuton_u16_t)(p_nn->input.unique_num_used * p_nn->input.window_size);
+    }
+    else
+    {
+        ctx.p_input   = (const neuton_u16_t*)p_nn->p_dsp->features.extracted_memory.p_void;
+        ctx.input_num = p_nn->p_dsp->features.overall_num;
+    }
+
+    for (neuton_u16_t n = 0; n < p_nn->model.meta.neurons_num; n++)
+    {
+        const neuton_u16_t header       = *p_record++;
+        const neuton_u16_t internal_num = header & NEUTON_NN_PACKED_LINKS_NUM_MASK;
+        const neuton_u16_t links_num    = internal_num + *p_record++;
+        const neuton_u16_t coeff        = *p_record++;
+        const neuton_u16_t scale_mult   = *p_record++;
+        const neuton_u16_t scale_shift  = *p_record++;
+
+        const neuton_u16_t* p_links   = p_record;
+        const neuton_u16_t* p_weights = p_record + links_num;
+
+        neuton_i64_t acc  = 0;
+        neuton_u16_t link = 0;
+
+        /* Groups of internal links only, values are read from the neurons */
+        for (; link + LINKS_PER_STEP <= internal_num; link += LINKS_PER_STEP, p_weights += 2)
+        {
+            acc = mac_group_(acc, p_weights,
+                             internal_q15_(&ctx, p_links[link + 0]), internal_q15_(&ctx, p_links[link + 1]),
+                             internal_q15_(&ctx, p_links[link + 2]), internal_q15_(&ctx, p_links[link + 3]));
+        }
+
+        /* Group on the internal/external boundary */
+        if (link < internal_num)
+        {
+            acc = mac_group_(acc, p_weights,
+                             link_value_q15_(&ctx, p_links, link + 0, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 1, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 2, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 3, internal_num, links_num));
+            link += LINKS_PER_STEP;
+            p_weights += 2;
+        }
+
+        /* Groups of external links only, values are read from the inputs */
+        for (; link + LINKS_PER_STEP <= links_num; link += LINKS_PER_STEP, p_weights += 2)
+        {
+            acc = mac_group_(acc, p_weights,
+                             external_q15_(&ctx, p_links[link + 0]), external_q15_(&ctx, p_links[link + 1]),
+                             external_q15_(&ctx, p_links[link + 2]), external_q15_(&ctx, p_links[link + 3]));
+        }
+
+        /* Last group padded with zero weights */
+        if (link < links_num)
+        {
+            acc = mac_group_(acc, p_weights,
+                             link_value_q15_(&ctx, p_links, link + 0, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 1, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 2, internal_num, links_num),
+                             link_value_q15_(&ctx, p_links, link + 3, internal_num, links_num));
+        }
+
+        p_record += links_num + NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(links_num);
+
+        /* Restore the 16-bit quantized weighted sum with rounding */
+        const neuton_i64_t summ = ((acc * scale_mult >> (scale_shift - 1)) + 1) >> 1;
+
+        p_neurons[n] = (header & NEUTON_NN_PACKED_ACT_RELU_FLAG) ? neuton_nn_relu_q16(coeff, summ)
+                                                                 : NEUTON_NN_SIGMOID_Q16(coeff, summ);
+    }
+}
@@ -0,0 +1,65 @@
+#include <neuton/nn/private/input/neuton_nn_input_feed.h>
+#include <neuton/nn/private/input/neuton_nn_input_setup.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_input_setup_sliding_window_gather(neuton_nn_input_t* p_input_ctx)
+{
+    neuton_status_t status = neuton_nn_input_setup_sliding_window(p_input_ctx);
+
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    neuton_osl_window_ctx_t* p_window_ctx = &p_input_ctx->p_window_ctx->sliding;
+
+    p_window_ctx->gather_num = 0;
+
+    if (p_input_ctx->p_usage_mask == NULL)
+        return NEUTON_STATUS_SUCCESS;
+
+    /* Too many used features for the indices list are fed by the usage mask */
+    neuton_osl_window_gather_init(p_window_ctx, p_input_ctx->p_usage_mask);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_fast_i16)
+{
+    RETURN_IF(((size_t)p_input_values & 1U) != 0, NEUTON_STATUS_WRONG_MEM_ALIGNMENT);
+
+    neuton_osl_window_ctx_t* p_window_ctx = &p_input_ctx->p_window_ctx->sliding;
+    const neuton_i16_t* p_input = (const neuton_i16_t*)p_input_values;
+    const neuton_u16_t num = num_values / p_input_ctx->unique_num;
+    neuton_u16_t samples_left;
+
+    /* Deinterleaving kernels take all features, the unused ones are skipped by the usage mask */
+    if (p_input_ctx->p_usage_mask == NULL)
+        samples_left = neuton_osl_window_feed_fast_i16(p_window_ctx, p_input, num);
+    else
+        samples_left = neuton_osl_window_feed_bymask_i16(p_window_ctx, p_input, num, p_input_ctx->p_usage_mask);
+
+    return (samples_left == 0) ? NEUTON_STATUS_SUCCESS : NEUTON_STATUS_INPROGRESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+NEUTON_NN_DECLARE_INPUT_FEED_INTERFACE(sliding_window_gather_i16)
+{
+    RETURN_IF(((size_t)p_input_values & 1U) != 0, NEUTON_STATUS_WRONG_MEM_ALIGNMENT);
+
+    neuton_osl_window_ctx_t* p_window_ctx = &p_input_ctx->p_window_ctx->sliding;
+    const neuton_i16_t* p_input = (const neuton_i16_t*)p_input_values;
+    const neuton_u16_t num = num_values / p_input_ctx->unique_num;
+    neuton_u16_t samples_left;
+
+    if (p_input_ctx->p_usage_mask == NULL)
+        samples_left = neuton_osl_window_feed_fast_i16(p_window_ctx, p_input, num);
+    else if (p_window_ctx->gather_num != 0)
+        samples_left = neuton_osl_window_feed_gather_i16(p_window_ctx, p_input, num);
+    else
+        samples_left = neuton_osl_window_feed_bymask_i16(p_window_ctx, p_input, num, p_input_ctx->p_usage_mask);
+
+    return (samples_left == 0) ? NEUTON_STATUS_SUCCESS : NEUTON_STATUS_INPROGRESS;
+}
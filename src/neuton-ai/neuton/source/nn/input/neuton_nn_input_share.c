@@ -0,0 +1,38 @@
+#include <neuton/nn/private/input/neuton_nn_input_share.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool is_same_scale_(const neuton_nn_input_t* p_a, const neuton_nn_input_t* p_b)
+{
+    /* Input type value is the size of input sample in bytes */
+    const neuton_sz_t size = (neuton_sz_t)p_a->unique_scales_num * (neuton_sz_t)p_a->type;
+
+    if (p_a->unique_scales_num != p_b->unique_scales_num)
+        return false;
+
+    return (memcmp(p_a->scale.i8.p_min, p_b->scale.i8.p_min, size) == 0) &&
+           (memcmp(p_a->scale.i8.p_max, p_b->scale.i8.p_max, size) == 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool neuton_nn_input_is_shareable(const neuton_nn_input_t* p_a, const neuton_nn_input_t* p_b)
+{
+    if ((p_a->type != p_b->type) || (p_a->unique_num != p_b->unique_num) ||
+        (p_a->unique_num_used != p_b->unique_num_used) || (p_a->window_size != p_b->window_size) ||
+        (p_a->window_shift != p_b->window_shift) || (p_a->subwindow_num != p_b->subwindow_num))
+        return false;
+
+    /* Usage mask has a bit for every unique input feature */
+    if ((p_a->p_usage_mask == NULL) != (p_b->p_usage_mask == NULL))
+        return false;
+
+    if ((p_a->p_usage_mask != NULL) &&
+        (memcmp(p_a->p_usage_mask, p_b->p_usage_mask, (p_a->unique_num + 7U) / 8U) != 0))
+        return false;
+
+    return is_same_scale_(p_a, p_b);
+}
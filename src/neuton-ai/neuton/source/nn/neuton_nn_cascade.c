@@ -0,0 +1,102 @@
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_cascade.h>
+#include <neuton/nn/private/input/neuton_nn_input_share.h>
+#include <neuton/nn/private/output/neuton_nn_output_propagate.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool is_classification_(const neuton_nn_t* p_nn)
+{
+    return (p_nn->model.meta.task == NEUTON_NN_TASK_MULT_CLASS) ||
+           (p_nn->model.meta.task == NEUTON_NN_TASK_BIN_CLASS);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool has_f32_outputs_(const neuton_nn_t* p_nn)
+{
+    return (p_nn->interfaces.propagate_outputs == neuton_nn_output_dequantize_q16_f32) ||
+           (p_nn->interfaces.propagate_outputs == neuton_nn_output_dequantize_q8_f32) ||
+           (p_nn->interfaces.propagate_outputs == neuton_nn_output_propagate_f32);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_cascade_setup(neuton_nn_cascade_t* p_cascade)
+{
+    RETURN_IF((p_cascade == NULL) || (p_cascade->p_gate == NULL) || (p_cascade->p_main == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_nn_t* p_gate = p_cascade->p_gate;
+    neuton_nn_t* p_main = p_cascade->p_main;
+
+    RETURN_IF(!is_classification_(p_gate) || !is_classification_(p_main) ||
+              !has_f32_outputs_(p_gate) || !has_f32_outputs_(p_main), NEUTON_STATUS_NOT_SUPPORTED);
+    RETURN_IF((p_cascade->pass_class >= p_gate->model.meta.outputs_num) ||
+              (p_cascade->reject_class >= p_main->model.meta.outputs_num), NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!neuton_nn_input_is_shareable(&p_gate->input, &p_main->input), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Frequency-domain features could transform the window in place, that is shared with the main model */
+    RETURN_IF((p_gate->p_dsp != NULL) && (p_gate->p_dsp->features.p_freqdomain_pipeline != NULL),
+              NEUTON_STATUS_NOT_SUPPORTED);
+
+    neuton_status_t status = neuton_nn_setup(p_main);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    status = neuton_nn_setup(p_gate);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    p_gate->input.window_memory.p_void = p_main->input.window_memory.p_void;
+
+    p_cascade->stats.windows_num   = 0;
+    p_cascade->stats.main_runs_num = 0;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_cascade_feed_inputs(neuton_nn_cascade_t* p_cascade,
+                                              void*                p_input_values,
+                                              neuton_u16_t         num_values)
+{
+    RETURN_IF(p_cascade == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    return neuton_nn_feed_inputs(p_cascade->p_main, p_input_values, num_values);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_cascade_run_inference(neuton_nn_cascade_t* p_cascade)
+{
+    RETURN_IF(p_cascade == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_status_t status = neuton_nn_run_inference(p_cascade->p_gate);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    p_cascade->stats.windows_num++;
+
+    const neuton_f32_t pass_probability =
+        p_cascade->p_gate->decoded_output.classif.probabilities.p_f32[p_cascade->pass_class];
+
+    if (pass_probability >= p_cascade->pass_threshold)
+    {
+        p_cascade->stats.main_runs_num++;
+        return neuton_nn_run_inference(p_cascade->p_main);
+    }
+
+    /* Rejected window is reported as the main model prediction of the reject class */
+    neuton_nn_model_t* p_model   = &p_cascade->p_main->model;
+    neuton_f32_t*      p_outputs = p_model->output.memory.p_f32;
+
+    for (neuton_u16_t i = 0; i < p_model->output.num; i++)
+        p_outputs[i] = 0;
+
+    p_outputs[p_cascade->reject_class] = 1.0f - pass_probability;
+
+    p_cascade->p_main->decoded_output.classif.predicted_class     = p_cascade->reject_class;
+    p_cascade->p_main->decoded_output.classif.probabilities.p_f32 = p_outputs;
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,499 @@
+#include <neuton/nn/neuton_nn_model_blob.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/inference/neuton_nn_packed_model.h>
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/private/neuton_common.h>
+
+#include <stddef.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Maximum shift of the fused weighted sum, that is applied to 64-bit value */
+#define FUSED_SHIFT_LIMIT 64U
+
+/** Range of the 8-bit weights sum scale shift, inference rounds it as (value >> (shift - 1)) of 64-bit value */
+#define Q8W_SHIFT_MIN 1U
+#define Q8W_SHIFT_MAX 63U
+
+/** CRC-32 (IEEE 802.3, reflected 0xEDB88320 polynomial) table for 4-bit processing,
+ *  small enough to validate the blob without a 1 KB table in flash */
+static const neuton_u32_t CRC32_NIBBLE_TABLE_[16] = {
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u32_t crc32_(const neuton_u8_t* p_data, neuton_u32_t size)
+{
+    neuton_u32_t crc = 0xFFFFFFFFUL;
+
+    for (neuton_u32_t i = 0; i < size; i++)
+    {
+        crc ^= p_data[i];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE_[crc & 0x0FU];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE_[crc & 0x0FU];
+    }
+
+    return ~crc;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** CRC of the blob covers everything after the crc32 field of the header */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t blob_crc32_(const neuton_nn_blob_header_t* p_header)
+{
+    const neuton_u32_t skip = offsetof(neuton_nn_blob_header_t, crc32) + sizeof(p_header->crc32);
+
+    return crc32_((const neuton_u8_t*)p_header + skip, p_header->total_size - skip);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE const void* section_(const neuton_nn_blob_header_t* p_header,
+                                                 neuton_nn_blob_section_id_t    id)
+{
+    return (const neuton_u8_t*)p_header + p_header->sections[id].offset;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t align_(neuton_u32_t size)
+{
+    return (size + (NEUTON_NN_BLOB_ALIGN - 1U)) & ~(neuton_u32_t)(NEUTON_NN_BLOB_ALIGN - 1U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool layout_interface_(const neuton_nn_t* p_nn, neuton_nn_blob_layout_t* p_layout)
+{
+    if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_fused)
+        *p_layout = NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED;
+    else if (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_q8w)
+        *p_layout = NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W;
+    else if ((p_nn->interfaces.run_inference == neuton_nn_run_model_inference_packed_q16) ||
+             (p_nn->interfaces.run_inference == neuton_nn_run_model_inference_q16))
+        *p_layout = NEUTON_NN_BLOB_LAYOUT_PACKED_Q16;
+    else
+        return false;
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Only 16-bit quantized classification models with extracted time-domain features could be loaded,
+ * so the blob doesn't carry output scaling and features arguments
+ */
+static bool is_supported_(const neuton_nn_t* p_nn)
+{
+    const neuton_nn_dsp_pipeline_t* p_dsp = p_nn->p_dsp;
+    neuton_nn_blob_layout_t         layout;
+
+    if ((p_dsp == NULL) || (p_dsp->features.p_freqdomain_pipeline != NULL) ||
+        (p_dsp->features.meta.i32.p_arguments != NULL) || p_nn->model.meta.uses_as_input.features.input)
+        return false;
+
+    if ((p_nn->model.meta.task != NEUTON_NN_TASK_MULT_CLASS) && (p_nn->model.meta.task != NEUTON_NN_TASK_BIN_CLASS))
+        return false;
+
+    if (!neuton_nn_features_is_dsp_i16_q16(p_nn->interfaces.process_features) &&
+        !neuton_nn_features_is_dsp_i16_unscaled(p_nn->interfaces.process_features))
+        return false;
+
+    return layout_interface_(p_nn, &layout);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Model time-domain pipeline uses the segment aggregates features, that need the segmented features processing */
+__NEUTON_STATIC_FORCEINLINE bool segmented_(const neuton_nn_t* p_nn)
+{
+    return (p_nn->interfaces.process_features == neuton_nn_process_features_dsp_i16_q16_segmented) ||
+           (p_nn->interfaces.process_features == neuton_nn_process_features_dsp_i16_unscaled_segmented);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool section_valid_(const neuton_nn_blob_header_t* p_header,
+                           neuton_nn_blob_section_id_t    id,
+                           neuton_u32_t                   expected_size)
+{
+    const neuton_nn_blob_section_t* p_section = &p_header->sections[id];
+
+    return (p_section->offset >= p_header->header_size) && (p_section->offset <= p_header->total_size) &&
+           ((p_section->offset % NEUTON_NN_BLOB_ALIGN) == 0) &&
+           (p_section->size <= p_header->total_size - p_section->offset) && (p_section->size == expected_size);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Walks the packed neuron records and checks that every record and link index is in bounds,
+ * so a blob produced by a broken generator can't make inference read out of the model memory
+ */
+static bool records_valid_(neuton_nn_blob_layout_t layout,
+                           const neuton_u16_t*     p_records,
+                           neuton_u32_t            records_num,
+                           neuton_u16_t            neurons_num,
+                           neuton_u16_t            features_num)
+{
+    neuton_u32_t pos = 0;
+
+    for (neuton_u16_t n = 0; n < neurons_num; n++)
+    {
+        const neuton_u32_t header_words = (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED) ?
+                                              NEUTON_NN_PACKED_FUSED_HEADER_WORDS :
+                                          (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W) ?
+                                              NEUTON_NN_PACKED_Q8W_HEADER_WORDS :
+                                              NEUTON_NN_PACKED_HEADER_WORDS;
+
+        if (records_num - pos < header_words)
+            return false;
+
+        const neuton_u32_t internal_num = p_records[pos] & NEUTON_NN_PACKED_LINKS_NUM_MASK;
+        const neuton_u32_t external_num = p_records[pos + 1];
+        const neuton_u32_t links_num    = internal_num + external_num;
+        neuton_u32_t       record_words;
+
+        if (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED)
+            record_words = header_words + 2U * internal_num + 3U * external_num;
+        else if (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W)
+            record_words = header_words + links_num + NEUTON_NN_PACKED_Q8W_WEIGHTS_WORDS(links_num);
+        else
+            record_words = header_words + 2U * links_num;
+
+        if (records_num - pos < record_words)
+            return false;
+
+        const neuton_u16_t* p_links = &p_records[pos + header_words];
+        const neuton_u32_t  stride  = (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W) ? 1U : 2U;
+
+        for (neuton_u32_t i = 0; i < internal_num; i++)
+        {
+            if (p_links[i * stride] >= neurons_num)
+                return false;
+        }
+
+        if (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W)
+        {
+            const neuton_u32_t scale_shift = p_records[pos + 4];
+
+            if ((scale_shift < Q8W_SHIFT_MIN) || (scale_shift > Q8W_SHIFT_MAX))
+                return false;
+        }
+
+        /* External links of the other layouts out of the features range are the bias input */
+        if (layout == NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED)
+        {
+            if (p_records[pos + 3] >= FUSED_SHIFT_LIMIT)
+                return false;
+
+            for (neuton_u32_t i = 0; i < external_num; i++)
+            {
+                if (p_links[2U * internal_num + 3U * i] >= features_num)
+                    return false;
+            }
+        }
+
+        pos += record_words;
+    }
+
+    return pos == records_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Blob masks should extract the compiled features number with the compiled pipeline functions,
+ * so they could only use the features bits of the compiled masks
+ */
+static bool masks_valid_(const neuton_nn_dsp_feature_extraction_t* p_features,
+                         const neuton_nn_features_mask_t*          p_masks)
+{
+    neuton_u32_t compiled_bits = 0;
+    neuton_u32_t features_num  = 0;
+
+    for (neuton_u16_t m = 0; m < p_features->masks_num; m++)
+        compiled_bits |= p_features->p_masks[m].domain.time.all;
+
+    for (neuton_u16_t m = 0; m < p_features->masks_num; m++)
+    {
+        const neuton_u32_t bits = p_masks[m].domain.time.all;
+
+        if ((p_masks[m].domain.freq.all != 0) || ((bits & ~compiled_bits) != 0))
+            return false;
+
+        for (neuton_u16_t bit = 0; bit < NEUTON_NN_FEATURE_cnt; bit++)
+            features_num += (bits >> bit) & 1U;
+    }
+
+    return features_num == p_features->overall_num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_blob_validate(const neuton_nn_t* p_nn, const void* p_blob, neuton_u32_t blob_size)
+{
+    RETURN_IF((p_nn == NULL) || (p_blob == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(((uintptr_t)p_blob % NEUTON_NN_BLOB_ALIGN) != 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(blob_size < sizeof(neuton_nn_blob_header_t), NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!is_supported_(p_nn), NEUTON_STATUS_NOT_SUPPORTED);
+
+    const neuton_nn_blob_header_t*            p_header   = (const neuton_nn_blob_header_t*)p_blob;
+    const neuton_nn_dsp_feature_extraction_t* p_features = &p_nn->p_dsp->features;
+    const neuton_nn_model_meta_t*             p_meta     = &p_nn->model.meta;
+
+    RETURN_IF((p_header->magic != NEUTON_NN_BLOB_MAGIC) || (p_header->version != NEUTON_NN_BLOB_VERSION) ||
+              (p_header->header_size != sizeof(neuton_nn_blob_header_t)),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF((p_header->total_size < p_header->header_size) || (p_header->total_size > blob_size),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(p_header->crc32 != blob_crc32_(p_header), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Loaded model reuses the compiled neurons, outputs and features buffers */
+    RETURN_IF((p_header->neurons_num != p_meta->neurons_num) || (p_header->outputs_num != p_meta->outputs_num) ||
+              (p_header->task != (neuton_u16_t)p_meta->task) || (p_header->features_num != p_features->overall_num) ||
+              (p_header->masks_num != p_features->masks_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(p_header->layout > NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED, NEUTON_STATUS_NOT_SUPPORTED);
+
+    const neuton_u32_t records_size = p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].size;
+    const neuton_u32_t scale_size   = p_header->sections[NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN].size;
+    const neuton_u32_t id_size      = p_header->sections[NEUTON_NN_BLOB_SECTION_SOLUTION_ID].size;
+
+    /* Scaling is folded into the fused records, so it is optional for them */
+    RETURN_IF((scale_size != p_header->features_num * sizeof(neuton_i32_t)) &&
+              ((scale_size != 0) || (p_header->layout != NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED)),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    RETURN_IF((records_size == 0) || ((records_size % sizeof(neuton_u16_t)) != 0) || (id_size == 0),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!section_valid_(p_header, NEUTON_NN_BLOB_SECTION_RECORDS, records_size) ||
+              !section_valid_(p_header, NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES,
+                              p_header->outputs_num * sizeof(neuton_u16_t)) ||
+              !section_valid_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_MASKS,
+                              p_header->masks_num * sizeof(neuton_nn_features_mask_t)) ||
+              !section_valid_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN, scale_size) ||
+              !section_valid_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MAX, scale_size) ||
+              !section_valid_(p_header, NEUTON_NN_BLOB_SECTION_SOLUTION_ID, id_size),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    const char* p_solution_id = (const char*)section_(p_header, NEUTON_NN_BLOB_SECTION_SOLUTION_ID);
+    RETURN_IF(p_solution_id[id_size - 1] != '\0', NEUTON_STATUS_INVALID_ARGUMENT);
+
+    const neuton_u16_t* p_outputs = (const neuton_u16_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES);
+
+    for (neuton_u16_t i = 0; i < p_header->outputs_num; i++)
+        RETURN_IF(p_outputs[i] >= p_header->neurons_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    RETURN_IF(!masks_valid_(p_features, (const neuton_nn_features_mask_t*)section_(
+                                            p_header, NEUTON_NN_BLOB_SECTION_FEATURES_MASKS)),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    RETURN_IF(!records_valid_((neuton_nn_blob_layout_t)p_header->layout,
+                              (const neuton_u16_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_RECORDS),
+                              records_size / sizeof(neuton_u16_t), p_header->neurons_num, p_header->features_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_blob_load(neuton_nn_t* p_nn, const void* p_blob, neuton_u32_t blob_size)
+{
+    const neuton_status_t status = neuton_nn_blob_validate(p_nn, p_blob, blob_size);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    const neuton_nn_blob_header_t*      p_header   = (const neuton_nn_blob_header_t*)p_blob;
+    neuton_nn_dsp_feature_extraction_t* p_features = &p_nn->p_dsp->features;
+    const bool                          fused      = (p_header->layout == NEUTON_NN_BLOB_LAYOUT_PACKED_FUSED);
+
+    /* All packed layouts have the same pointers layout */
+    p_nn->model.params.packed_q16.p_records   = (const neuton_u16_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_RECORDS);
+    p_nn->model.params.packed_q16.records_num = p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].size /
+                                                sizeof(neuton_u16_t);
+
+    p_nn->model.meta.p_output_neurons_indices =
+        (const neuton_u16_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES);
+    p_nn->model.meta.p_solution_id_str = (const char*)section_(p_header, NEUTON_NN_BLOB_SECTION_SOLUTION_ID);
+
+    p_features->p_masks = (const neuton_nn_features_mask_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_MASKS);
+
+    if (p_header->sections[NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN].size != 0)
+    {
+        p_features->meta.i32.p_min = (const neuton_i32_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN);
+        p_features->meta.i32.p_max = (const neuton_i32_t*)section_(p_header, NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MAX);
+    }
+
+    /* Scaling plan is rebuilt from the loaded features min/max on the next features scaling */
+    neuton_nn_features_scale_reset(p_nn->p_dsp);
+
+    if (segmented_(p_nn))
+        p_nn->interfaces.process_features = fused ? neuton_nn_process_features_dsp_i16_unscaled_segmented
+                                                  : neuton_nn_process_features_dsp_i16_q16_segmented;
+    else
+        p_nn->interfaces.process_features = fused ? neuton_nn_process_features_dsp_i16_unscaled
+                                                  : neuton_nn_process_features_dsp_i16_q16_planned;
+
+    if (fused)
+        p_nn->interfaces.run_inference = neuton_nn_run_model_inference_packed_fused;
+    else if (p_header->layout == NEUTON_NN_BLOB_LAYOUT_PACKED_Q8W)
+        p_nn->interfaces.run_inference = neuton_nn_run_model_inference_packed_q8w;
+    else
+        p_nn->interfaces.run_inference = neuton_nn_run_model_inference_packed_q16;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Sequence number of the slot, that has the blob header, to order A/B slots before validation */
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t slot_sequence_(const void* p_slot, neuton_u32_t slot_size)
+{
+    const neuton_nn_blob_header_t* p_header = (const neuton_nn_blob_header_t*)p_slot;
+
+    if ((p_slot == NULL) || (slot_size < sizeof(neuton_nn_blob_header_t)) ||
+        (p_header->magic != NEUTON_NN_BLOB_MAGIC))
+        return 0;
+
+    return p_header->sequence;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_blob_load_ab(neuton_nn_t*  p_nn,
+                                       const void*   p_slot_a,
+                                       const void*   p_slot_b,
+                                       neuton_u32_t  slot_size,
+                                       neuton_u8_t*  p_loaded)
+{
+    RETURN_IF(p_nn == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    const void* slots[2] = { p_slot_a, p_slot_b };
+
+    /* Serial number comparison, so the sequence could wrap around */
+    const neuton_i32_t b_is_newer = (neuton_i32_t)(slot_sequence_(p_slot_b, slot_size) -
+                                                   slot_sequence_(p_slot_a, slot_size));
+    const neuton_u8_t  first      = (b_is_newer > 0) ? 1 : 0;
+
+    neuton_status_t status = NEUTON_STATUS_NULL_ARGUMENT;
+
+    for (neuton_u8_t attempt = 0; attempt < 2; attempt++)
+    {
+        const neuton_u8_t slot = first ^ attempt;
+
+        if (slots[slot] == NULL)
+            continue;
+
+        status = neuton_nn_blob_load(p_nn, slots[slot], slot_size);
+
+        if (status == NEUTON_STATUS_SUCCESS)
+        {
+            if (p_loaded != NULL)
+                *p_loaded = slot;
+            break;
+        }
+    }
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_blob_write(const neuton_nn_t* p_nn,
+                                     neuton_u32_t       sequence,
+                                     void*              p_buffer,
+                                     neuton_u32_t       buffer_size,
+                                     neuton_u32_t*      p_blob_size)
+{
+    RETURN_IF((p_nn == NULL) || (p_buffer == NULL) || (p_blob_size == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(((uintptr_t)p_buffer % NEUTON_NN_BLOB_ALIGN) != 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!is_supported_(p_nn), NEUTON_STATUS_NOT_SUPPORTED);
+
+    const neuton_nn_dsp_feature_extraction_t* p_features = &p_nn->p_dsp->features;
+    const neuton_nn_model_meta_t*             p_meta     = &p_nn->model.meta;
+    const bool                                packed     = (p_nn->interfaces.run_inference !=
+                                                            neuton_nn_run_model_inference_q16);
+    neuton_nn_blob_layout_t                   layout     = NEUTON_NN_BLOB_LAYOUT_PACKED_Q16;
+
+    layout_interface_(p_nn, &layout);
+
+    const char*        p_solution_id = (p_meta->p_solution_id_str != NULL) ? p_meta->p_solution_id_str : "";
+    const neuton_u32_t records_num   = packed ? p_nn->model.params.packed_q16.records_num
+                                              : NEUTON_NN_PACKED_Q16_RECORDS_NUM(p_meta->neurons_num,
+                                                                                 p_meta->weights_num);
+    const neuton_u32_t scale_size    = (p_features->meta.i32.p_min != NULL) ?
+                                           p_features->overall_num * sizeof(neuton_i32_t) : 0;
+    const neuton_u32_t sizes[NEUTON_NN_BLOB_SECTION_cnt] = {
+        [NEUTON_NN_BLOB_SECTION_RECORDS]           = records_num * sizeof(neuton_u16_t),
+        [NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES]    = p_meta->outputs_num * sizeof(neuton_u16_t),
+        [NEUTON_NN_BLOB_SECTION_FEATURES_MASKS]    = p_features->masks_num * sizeof(neuton_nn_features_mask_t),
+        [NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN] = scale_size,
+        [NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MAX] = scale_size,
+        [NEUTON_NN_BLOB_SECTION_SOLUTION_ID]       = (neuton_u32_t)strlen(p_solution_id) + 1U,
+    };
+    const void* sources[NEUTON_NN_BLOB_SECTION_cnt] = {
+        [NEUTON_NN_BLOB_SECTION_RECORDS]           = packed ? p_nn->model.params.packed_q16.p_records : NULL,
+        [NEUTON_NN_BLOB_SECTION_OUTPUT_INDICES]    = p_meta->p_output_neurons_indices,
+        [NEUTON_NN_BLOB_SECTION_FEATURES_MASKS]    = p_features->p_masks,
+        [NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MIN] = p_features->meta.i32.p_min,
+        [NEUTON_NN_BLOB_SECTION_FEATURES_SCALE_MAX] = p_features->meta.i32.p_max,
+        [NEUTON_NN_BLOB_SECTION_SOLUTION_ID]       = p_solution_id,
+    };
+
+    neuton_u32_t total_size = align_(sizeof(neuton_nn_blob_header_t));
+
+    for (neuton_u8_t id = 0; id < NEUTON_NN_BLOB_SECTION_cnt; id++)
+        total_size += align_(sizes[id]);
+
+    RETURN_IF(total_size > buffer_size, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u8_t*             p_blob   = (neuton_u8_t*)p_buffer;
+    neuton_nn_blob_header_t* p_header = (neuton_nn_blob_header_t*)p_buffer;
+
+    memset(p_blob, 0, total_size);
+
+    p_header->magic        = NEUTON_NN_BLOB_MAGIC;
+    p_header->version      = NEUTON_NN_BLOB_VERSION;
+    p_header->header_size  = sizeof(neuton_nn_blob_header_t);
+    p_header->total_size   = total_size;
+    p_header->sequence     = sequence;
+    p_header->layout       = (neuton_u16_t)layout;
+    p_header->task         = (neuton_u16_t)p_meta->task;
+    p_header->neurons_num  = p_meta->neurons_num;
+    p_header->outputs_num  = p_meta->outputs_num;
+    p_header->features_num = p_features->overall_num;
+    p_header->masks_num    = p_features->masks_num;
+
+    neuton_u32_t offset = align_(sizeof(neuton_nn_blob_header_t));
+
+    for (neuton_u8_t id = 0; id < NEUTON_NN_BLOB_SECTION_cnt; id++)
+    {
+        p_header->sections[id].offset = offset;
+        p_header->sections[id].size   = sizes[id];
+
+        if (sources[id] != NULL)
+            memcpy(p_blob + offset, sources[id], sizes[id]);
+
+        offset += align_(sizes[id]);
+    }
+
+    /* Model with separate arrays layout is packed right into the blob */
+    if (!packed)
+    {
+        const neuton_status_t status = neuton_nn_model_pack_q16(
+            &p_nn->model, (neuton_u16_t*)(p_blob + p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].offset),
+            records_num);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+    }
+
+    p_header->crc32 = blob_crc32_(p_header);
+    *p_blob_size    = total_size;
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,212 @@
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_multirate.h>
+#include <neuton/nn/private/features/neuton_nn_extract_features.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/input/neuton_nn_input_setup.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define US_IN_SECOND    (1000000UL)
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool is_scaled_q16_(const neuton_nn_t* p_nn)
+{
+    return neuton_nn_features_is_dsp_i16_q16(p_nn->interfaces.process_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool is_supported_(const neuton_nn_t* p_nn)
+{
+    return (p_nn->p_dsp != NULL) &&
+           (is_scaled_q16_(p_nn) || neuton_nn_features_is_dsp_i16_unscaled(p_nn->interfaces.process_features));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t all_groups_mask_(const neuton_nn_multirate_t* p_multirate)
+{
+    return (1UL << p_multirate->groups_num) - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Number of samples, which the group sliding window accepts until it is collected */
+__NEUTON_STATIC_FORCEINLINE neuton_u16_t samples_left_(const neuton_osl_window_ctx_t* p_window_ctx)
+{
+    if (p_window_ctx->is_shift_pending)
+        return p_window_ctx->window_shift;
+
+    return p_window_ctx->ord_win.max_samples_num - p_window_ctx->ord_win.current_sample;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_status_t setup_group_(neuton_nn_multirate_group_t*        p_group,
+                                    const neuton_nn_multirate_group_t*  p_first,
+                                    neuton_nn_dsp_feature_extraction_t* p_model_features,
+                                    neuton_u16_t                        features_offset)
+{
+    neuton_nn_input_t*        p_input = p_group->p_input;
+    neuton_nn_dsp_pipeline_t* p_dsp   = p_group->p_dsp;
+
+    RETURN_IF((p_input->type != NEUTON_NN_INPUT_I16) || (p_input->p_window_ctx == NULL),
+              NEUTON_STATUS_NOT_SUPPORTED);
+    RETURN_IF((p_input->window_shift == 0) || (p_input->window_shift > p_input->window_size),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(features_offset + p_dsp->features.overall_num > p_model_features->overall_num,
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    /* Hops of all groups take the same time: shift / rate == first shift / first rate */
+    RETURN_IF((neuton_u32_t)p_input->window_shift * p_first->rate_hz !=
+              (neuton_u32_t)p_first->p_input->window_shift * p_group->rate_hz,
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_status_t status = neuton_nn_input_setup_sliding_window(p_input);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    /* Group features are extracted directly to its part of the model features vector */
+    p_dsp->features.extracted_memory.p_i32 = &p_model_features->extracted_memory.p_i32[features_offset];
+    p_group->features_offset              = features_offset;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_multirate_add_group(neuton_nn_multirate_t*    p_multirate,
+                                              neuton_nn_input_t*        p_input,
+                                              neuton_nn_dsp_pipeline_t* p_dsp,
+                                              neuton_u16_t              rate_hz,
+                                              neuton_u16_t*             p_index)
+{
+    RETURN_IF((p_multirate == NULL) || (p_input == NULL) || (p_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_multirate->groups_num >= NEUTON_NN_MULTIRATE_GROUPS_MAX, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(rate_hz == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(p_dsp->features.p_freqdomain_pipeline != NULL, NEUTON_STATUS_NOT_SUPPORTED);
+
+    neuton_nn_multirate_group_t* p_group = &p_multirate->groups[p_multirate->groups_num];
+
+    p_group->p_input         = p_input;
+    p_group->p_dsp           = p_dsp;
+    p_group->rate_hz         = rate_hz;
+    p_group->features_offset = 0;
+
+    if (p_index != NULL)
+        *p_index = p_multirate->groups_num;
+
+    p_multirate->groups_num++;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_multirate_setup(neuton_nn_multirate_t* p_multirate)
+{
+    RETURN_IF((p_multirate == NULL) || (p_multirate->p_nn == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_multirate->groups_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!is_supported_(p_multirate->p_nn), NEUTON_STATUS_NOT_SUPPORTED);
+
+    neuton_nn_dsp_feature_extraction_t* p_model_features = &p_multirate->p_nn->p_dsp->features;
+    const neuton_nn_multirate_group_t*  p_first          = &p_multirate->groups[0];
+    neuton_u16_t                        features_offset  = 0;
+
+    neuton_status_t status = neuton_nn_setup(p_multirate->p_nn);
+    RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+    for (neuton_u16_t i = 0; i < p_multirate->groups_num; i++)
+    {
+        neuton_nn_multirate_group_t* p_group = &p_multirate->groups[i];
+
+        status = setup_group_(p_group, p_first, p_model_features, features_offset);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+        features_offset += p_group->p_dsp->features.overall_num;
+    }
+
+    RETURN_IF(features_offset != p_model_features->overall_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    p_multirate->tick_us      = (neuton_u32_t)(((neuton_u64_t)p_first->p_input->window_shift * US_IN_SECOND) /
+                                               p_first->rate_hz);
+    p_multirate->ready_mask   = 0;
+    p_multirate->overruns_num = 0;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_multirate_feed_inputs(neuton_nn_multirate_t* p_multirate,
+                                                neuton_u16_t           group_index,
+                                                void*                  p_input_values,
+                                                neuton_u16_t           num_values)
+{
+    RETURN_IF((p_multirate == NULL) || (p_input_values == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(group_index >= p_multirate->groups_num, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(((size_t)p_input_values & 1U) != 0, NEUTON_STATUS_WRONG_MEM_ALIGNMENT);
+
+    neuton_nn_multirate_group_t* p_group      = &p_multirate->groups[group_index];
+    neuton_nn_input_t*           p_input      = p_group->p_input;
+    neuton_osl_window_ctx_t*     p_window_ctx = &p_input->p_window_ctx->sliding;
+    const neuton_u32_t           group_bit    = 1UL << group_index;
+
+    const neuton_i16_t* p_samples = (const neuton_i16_t*)p_input_values;
+    neuton_u16_t        num       = num_values / p_input->unique_num;
+
+    while (num != 0)
+    {
+        /* Window feed stops when the window is collected, so the rest is fed to the next window */
+        const neuton_u16_t samples_left = samples_left_(p_window_ctx);
+        const neuton_u16_t chunk        = (num < samples_left) ? num : samples_left;
+
+        const neuton_u16_t collected = (p_input->p_usage_mask == NULL) ?
+            neuton_osl_window_feed_fast_i16(p_window_ctx, p_samples, chunk) :
+            neuton_osl_window_feed_bymask_i16(p_window_ctx, p_samples, chunk, p_input->p_usage_mask);
+
+        p_samples += (neuton_sz_t)chunk * p_input->unique_num;
+        num -= chunk;
+
+        if (collected != 0)
+            continue;
+
+        const neuton_sz_t extracted_num = extract_features_i16(p_input, p_group->p_dsp);
+        RETURN_IF(extracted_num != p_group->p_dsp->features.overall_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+        if (p_multirate->ready_mask & group_bit)
+            p_multirate->overruns_num++;
+
+        p_multirate->ready_mask |= group_bit;
+    }
+
+    return (p_multirate->ready_mask == all_groups_mask_(p_multirate)) ? NEUTON_STATUS_SUCCESS
+                                                                      : NEUTON_STATUS_INPROGRESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_multirate_run_inference(neuton_nn_multirate_t* p_multirate)
+{
+    RETURN_IF((p_multirate == NULL) || (p_multirate->p_nn == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_multirate->groups_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(p_multirate->ready_mask != all_groups_mask_(p_multirate), NEUTON_STATUS_INPROGRESS);
+
+    neuton_nn_t* p_nn = p_multirate->p_nn;
+
+    if (is_scaled_q16_(p_nn))
+    {
+        const neuton_status_t status = neuton_nn_features_scale_q16(p_nn->p_dsp);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+    }
+
+    p_nn->interfaces.run_inference(p_nn);
+    p_nn->interfaces.propagate_outputs(&p_nn->model);
+    p_nn->interfaces.decode_outputs(&p_nn->model.output, &p_nn->decoded_output);
+
+    p_multirate->ready_mask = 0;
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,246 @@
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_runtime.h>
+#include <neuton/nn/private/features/neuton_nn_extract_features.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/input/neuton_nn_input_share.h>
+#include <neuton/nn/private/output/neuton_nn_output_propagate.h>
+#include <neuton/private/neuton_common.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool is_scaled_q16_(const neuton_nn_t* p_nn)
+{
+    return neuton_nn_features_is_dsp_i16_q16(p_nn->interfaces.process_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE bool is_supported_(const neuton_nn_t* p_nn)
+{
+    const neuton_nn_dsp_pipeline_t* p_dsp = p_nn->p_dsp;
+
+    if ((p_dsp == NULL) || (p_dsp->features.p_freqdomain_pipeline != NULL) ||
+        (p_dsp->features.meta.i32.p_arguments != NULL))
+        return false;
+
+    return is_scaled_q16_(p_nn) || neuton_nn_features_is_dsp_i16_unscaled(p_nn->interfaces.process_features);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t output_size_(const neuton_nn_t* p_nn)
+{
+    if (p_nn->interfaces.propagate_outputs == neuton_nn_output_propagate_q16)
+        return sizeof(neuton_u16_t);
+
+    if (p_nn->interfaces.propagate_outputs == neuton_nn_output_propagate_q8)
+        return sizeof(neuton_u8_t);
+
+    return sizeof(neuton_f32_t);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t window_size_(const neuton_nn_input_t* p_input)
+{
+    /* Input type value is the size of input sample in bytes */
+    return (neuton_u32_t)p_input->unique_num_used * p_input->window_size * (neuton_u32_t)p_input->type;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Maps the model features to the shared features cache, features are extracted mask by mask
+ * in order of the time-domain mask bits, so the model masks should be subsets of the shared masks
+ */
+static neuton_status_t map_features_(const neuton_nn_dsp_pipeline_t* p_shared,
+                                     const neuton_nn_dsp_pipeline_t* p_dsp,
+                                     neuton_u16_t*                   p_map)
+{
+    RETURN_IF(p_dsp->features.masks_num != p_shared->features.masks_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u16_t shared = 0;
+    neuton_u16_t own    = 0;
+
+    for (neuton_u16_t m = 0; m < p_shared->features.masks_num; m++)
+    {
+        const neuton_u32_t shared_mask = p_shared->features.p_masks[m].domain.time.all;
+        const neuton_u32_t own_mask    = p_dsp->features.p_masks[m].domain.time.all;
+
+        RETURN_IF((own_mask & ~shared_mask) != 0, NEUTON_STATUS_INVALID_ARGUMENT);
+
+        for (neuton_u16_t bit = 0; bit < NEUTON_NN_FEATURE_cnt; bit++)
+        {
+            if (!(shared_mask & (1UL << bit)))
+                continue;
+
+            if (own_mask & (1UL << bit))
+            {
+                RETURN_IF(own >= p_dsp->features.overall_num, NEUTON_STATUS_INVALID_ARGUMENT);
+                p_map[own++] = shared;
+            }
+
+            shared++;
+        }
+    }
+
+    RETURN_IF((own != p_dsp->features.overall_num) || (shared != p_shared->features.overall_num),
+              NEUTON_STATUS_INVALID_ARGUMENT);
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Takes the model features from the shared features cache and scales them in the same way
+ * as neuton_nn_process_features_dsp_i16_q16() does, or leaves them unscaled for fused scaling models
+ */
+static neuton_status_t take_features_(neuton_nn_t* p_nn, const neuton_i32_t* p_cache, const neuton_u16_t* p_map)
+{
+    neuton_nn_dsp_feature_extraction_t* p_features = &p_nn->p_dsp->features;
+
+    for (neuton_u16_t i = 0; i < p_features->overall_num; i++)
+        p_features->extracted_memory.p_i32[i] = p_cache[p_map[i]];
+
+    return is_scaled_q16_(p_nn) ? neuton_nn_features_scale_q16(p_nn->p_dsp) : NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_register(neuton_nn_runtime_t* p_runtime,
+                                           neuton_nn_t*         p_nn,
+                                           neuton_u16_t*        p_features_map,
+                                           neuton_u16_t*        p_index)
+{
+    RETURN_IF((p_runtime == NULL) || (p_nn == NULL) || (p_features_map == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_runtime->models_num >= NEUTON_NN_RUNTIME_MODELS_MAX, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(!is_supported_(p_nn), NEUTON_STATUS_NOT_SUPPORTED);
+
+    neuton_nn_runtime_model_t* p_model = &p_runtime->models[p_runtime->models_num];
+
+    p_model->p_nn           = p_nn;
+    p_model->p_features_map = p_features_map;
+    p_model->enabled        = false;
+
+    if (p_index != NULL)
+        *p_index = p_runtime->models_num;
+
+    p_runtime->models_num++;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_setup(neuton_nn_runtime_t* p_runtime)
+{
+    RETURN_IF((p_runtime == NULL) || (p_runtime->p_shared_dsp == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_runtime->models_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+    RETURN_IF(p_runtime->p_shared_dsp->features.p_freqdomain_pipeline != NULL, NEUTON_STATUS_NOT_SUPPORTED);
+
+    neuton_nn_t* p_owner = p_runtime->models[0].p_nn;
+
+    for (neuton_u16_t i = 0; i < p_runtime->models_num; i++)
+    {
+        neuton_nn_runtime_model_t* p_model = &p_runtime->models[i];
+
+        RETURN_IF(!neuton_nn_input_is_shareable(&p_owner->input, &p_model->p_nn->input),
+                  NEUTON_STATUS_INVALID_ARGUMENT);
+
+        neuton_status_t status = map_features_(p_runtime->p_shared_dsp, p_model->p_nn->p_dsp,
+                                               p_model->p_features_map);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+        status = neuton_nn_setup(p_model->p_nn);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+        p_model->p_nn->input.window_memory.p_void = p_owner->input.window_memory.p_void;
+        p_model->enabled                          = true;
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_enable(neuton_nn_runtime_t* p_runtime, neuton_u16_t index, bool enabled)
+{
+    RETURN_IF(p_runtime == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(index >= p_runtime->models_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    p_runtime->models[index].enabled = enabled;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_feed_inputs(neuton_nn_runtime_t* p_runtime,
+                                              void*                p_input_values,
+                                              neuton_u16_t         num_values)
+{
+    RETURN_IF(p_runtime == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_runtime->models_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    return neuton_nn_feed_inputs(p_runtime->models[0].p_nn, p_input_values, num_values);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_run_inference(neuton_nn_runtime_t* p_runtime)
+{
+    RETURN_IF(p_runtime == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(p_runtime->models_num == 0, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_nn_dsp_pipeline_t* p_shared = p_runtime->p_shared_dsp;
+
+    const neuton_sz_t extracted_num = extract_features_i16(&p_runtime->models[0].p_nn->input, p_shared);
+    RETURN_IF(extracted_num != p_shared->features.overall_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    for (neuton_u16_t i = 0; i < p_runtime->models_num; i++)
+    {
+        neuton_nn_runtime_model_t* p_model = &p_runtime->models[i];
+        neuton_nn_t*               p_nn    = p_model->p_nn;
+
+        if (!p_model->enabled)
+            continue;
+
+        const neuton_status_t status = take_features_(p_nn, p_shared->features.extracted_memory.p_i32,
+                                                      p_model->p_features_map);
+        RETURN_IF(status != NEUTON_STATUS_SUCCESS, status);
+
+        p_nn->interfaces.run_inference(p_nn);
+        p_nn->interfaces.propagate_outputs(&p_nn->model);
+        p_nn->interfaces.decode_outputs(&p_nn->model.output, &p_nn->decoded_output);
+    }
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_nn_runtime_memory(const neuton_nn_runtime_t* p_runtime,
+                                         neuton_u16_t               index,
+                                         neuton_nn_runtime_memory_t* p_memory)
+{
+    RETURN_IF((p_runtime == NULL) || (p_memory == NULL), NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(index >= p_runtime->models_num, NEUTON_STATUS_INVALID_ARGUMENT);
+
+    const neuton_nn_t*       p_nn          = p_runtime->models[index].p_nn;
+    const neuton_nn_input_t* p_owner_input = &p_runtime->models[0].p_nn->input;
+    const neuton_u32_t       features_num  = p_nn->p_dsp->features.overall_num;
+
+    /* Supported models have 16-bit quantized neurons and 32-bit extracted features buffer */
+    p_memory->model_bytes = (neuton_u32_t)p_nn->model.meta.neurons_num * sizeof(neuton_u16_t) +
+                            (neuton_u32_t)p_nn->model.output.num * output_size_(p_nn) +
+                            features_num * (sizeof(neuton_i32_t) + sizeof(neuton_u16_t));
+
+    p_memory->shared_bytes = window_size_(p_owner_input) +
+                             (neuton_u32_t)p_runtime->p_shared_dsp->features.overall_num * sizeof(neuton_i32_t);
+
+    p_memory->saved_bytes = (index != 0) ? window_size_(&p_nn->input) : 0;
+
+    return NEUTON_STATUS_SUCCESS;
+}
@@ -0,0 +1,260 @@
+#include <neuton/utils/neuton_ordered_window.h>
+#include <neuton/utils/neuton_osl_window.h>
+#include <neuton/private/neuton_common.h>
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define IS_UNIQ_FEATURE_USED(index, mask)     (bool)(mask[index >> 3] & (1U << (index % 8)))
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Input and window are only halfword aligned, so words are accessed by memcpy(),
+ * that is a single LDR / STR on cores with unaligned access support */
+
+__NEUTON_STATIC_FORCEINLINE neuton_u32_t load_u32_(const neuton_i16_t* p_src)
+{
+    neuton_u32_t word;
+    memcpy(&word, p_src, sizeof(word));
+    return word;
+}
+
+__NEUTON_STATIC_FORCEINLINE void store_u32_(neuton_i16_t* p_dst, neuton_u32_t word)
+{
+    memcpy(p_dst, &word, sizeof(word));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Two samples { x0, y0, z0, x1, y1, z1 } are loaded as { x0 y0 }, { z0 x1 }, { y1 z1 } words */
+static void deinterleave_3x_i16_(neuton_i16_t* p_window, const neuton_u16_t max_samples_num,
+                                 const neuton_i16_t* p_input, neuton_u16_t pairs_num)
+{
+    neuton_i16_t* p_x = p_window;
+    neuton_i16_t* p_y = p_x + max_samples_num;
+    neuton_i16_t* p_z = p_y + max_samples_num;
+
+    while (pairs_num--)
+    {
+        const neuton_u32_t w0 = load_u32_(&p_input[0]);
+        const neuton_u32_t w1 = load_u32_(&p_input[2]);
+        const neuton_u32_t w2 = load_u32_(&p_input[4]);
+
+        store_u32_(p_x, __NEUTON_PKHBT(w0, w1, 0));
+        store_u32_(p_y, __NEUTON_PKHBT(w0 >> 16, w2, 16));
+        store_u32_(p_z, __NEUTON_PKHBT(w1, w2, 0));
+
+        p_input += 6;
+        p_x += 2;
+        p_y += 2;
+        p_z += 2;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/* Two samples { a0, b0, c0, d0, e0, f0, a1, .. f1 } are loaded as { a0 b0 } .. { e1 f1 } words,
+ * every feature pair is packed from the words of the same position in both samples */
+static void deinterleave_6x_i16_(neuton_i16_t* p_window, const neuton_u16_t max_samples_num,
+                                 const neuton_i16_t* p_input, neuton_u16_t pairs_num)
+{
+    neuton_i16_t* p_a = p_window;
+
+    while (pairs_num--)
+    {
+        neuton_i16_t* p_dst = p_a;
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            const neuton_u32_t w0 = load_u32_(&p_input[2 * i]);
+            const neuton_u32_t w1 = load_u32_(&p_input[2 * i + 6]);
+
+            store_u32_(p_dst, __NEUTON_PKHBT(w0, w1, 16));
+            p_dst += max_samples_num;
+            store_u32_(p_dst, __NEUTON_PKHTB(w1, w0, 16));
+            p_dst += max_samples_num;
+        }
+
+        p_input += 12;
+        p_a += 2;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t complete_feed_(neuton_ordered_window_ctx_t* p_ctx, neuton_u16_t current_sample)
+{
+    const neuton_u16_t samples_left = p_ctx->max_samples_num - current_sample;
+
+    p_ctx->current_sample = (samples_left == 0) ? 0 : current_sample;
+
+    return samples_left;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_ordered_window_feed_fast_i16(neuton_ordered_window_ctx_t* p_ctx,
+                                                 const neuton_i16_t* p_input, neuton_u16_t num)
+{
+    const neuton_u16_t max_samples_num   = p_ctx->max_samples_num;
+    const neuton_u16_t uniq_features_num = p_ctx->uniq_features_num;
+
+    if ((uniq_features_num != 3) && (uniq_features_num != 6))
+        return neuton_ordered_window_feed_i16(p_ctx, p_input, num);
+
+    neuton_i16_t* p_window      = p_ctx->p_window.i16;
+    neuton_u16_t current_sample = p_ctx->current_sample;
+    neuton_u16_t samples_left   = max_samples_num - current_sample;
+    neuton_u16_t loop_cnt       = num > samples_left ? samples_left : num;
+    const neuton_u16_t pairs_num = loop_cnt >> 1;
+
+    if (pairs_num)
+    {
+        if (uniq_features_num == 3)
+            deinterleave_3x_i16_(&p_window[current_sample], max_samples_num, p_input, pairs_num);
+        else
+            deinterleave_6x_i16_(&p_window[current_sample], max_samples_num, p_input, pairs_num);
+
+        current_sample += pairs_num << 1;
+        p_input += (pairs_num << 1) * uniq_features_num;
+    }
+
+    /* Odd sample, also the common case of the sample by sample feeding */
+    if (loop_cnt & 1)
+    {
+        neuton_i16_t* p_dst = &p_window[current_sample];
+
+        for (size_t i = 0; i < uniq_features_num; i++, p_dst += max_samples_num)
+            *p_dst = p_input[i];
+
+        current_sample++;
+    }
+
+    return complete_feed_(p_ctx, current_sample);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_ordered_window_gather_init(const neuton_u8_t* p_usage_mask,
+                                                  const neuton_u16_t uniq_features_num,
+                                                  neuton_u8_t* p_indices, const neuton_u16_t max_indices_num,
+                                                  neuton_u16_t* p_indices_num)
+{
+    RETURN_IF((p_usage_mask == NULL) || (p_indices == NULL) || (p_indices_num == NULL),
+              NEUTON_STATUS_NULL_ARGUMENT);
+    RETURN_IF(uniq_features_num > (NEUTON_UINT8_MAX + 1U), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    neuton_u16_t collected = 0;
+
+    for (neuton_u16_t i = 0; i < uniq_features_num; i++)
+    {
+        if (!IS_UNIQ_FEATURE_USED(i, p_usage_mask))
+            continue;
+
+        RETURN_IF(collected >= max_indices_num, NEUTON_STATUS_INVALID_ARGUMENT);
+        p_indices[collected++] = (neuton_u8_t)i;
+    }
+
+    *p_indices_num = collected;
+
+    return NEUTON_STATUS_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_ordered_window_feed_gather_i16(neuton_ordered_window_ctx_t* p_ctx,
+                                                   const neuton_i16_t* p_input, neuton_u16_t num,
+                                                   const neuton_u8_t* p_indices, const neuton_u16_t indices_num)
+{
+    const neuton_u16_t max_samples_num   = p_ctx->max_samples_num;
+    const neuton_u16_t uniq_features_num = p_ctx->uniq_features_num;
+
+    neuton_i16_t* p_window      = p_ctx->p_window.i16;
+    neuton_u16_t current_sample = p_ctx->current_sample;
+    neuton_u16_t samples_left   = max_samples_num - current_sample;
+    neuton_u16_t loop_cnt       = num > samples_left ? samples_left : num;
+
+    while (loop_cnt)
+    {
+        neuton_i16_t* p_dst = &p_window[current_sample];
+
+        for (size_t i = 0; i < indices_num; i++, p_dst += max_samples_num)
+            *p_dst = p_input[p_indices[i]];
+
+        p_input += uniq_features_num;
+        current_sample++;
+        loop_cnt--;
+    }
+
+    p_ctx->uniq_features_collected = indices_num;
+
+    return complete_feed_(p_ctx, current_sample);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void shift_window_i16_(neuton_osl_window_ctx_t* p_ctx, const neuton_u16_t features_num)
+{
+    const neuton_u16_t max_samples_num = p_ctx->ord_win.max_samples_num;
+    const neuton_u32_t tail_size       = max_samples_num - p_ctx->window_shift;
+
+    for (size_t i = 0; i < features_num; i++)
+    {
+        neuton_i16_t* p_feature_window = &p_ctx->ord_win.p_window.i16[i * max_samples_num];
+
+        memmove(p_feature_window, &p_feature_window[p_ctx->window_shift], tail_size * sizeof(neuton_i16_t));
+    }
+
+    p_ctx->is_shift_pending       = false;
+    p_ctx->ord_win.current_sample = tail_size;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_osl_window_feed_fast_i16(neuton_osl_window_ctx_t* p_ctx,
+                                             const neuton_i16_t* p_input, neuton_u16_t num)
+{
+    if (p_ctx->is_shift_pending)
+        shift_window_i16_(p_ctx, p_ctx->ord_win.uniq_features_num);
+
+    neuton_u16_t samples_left = neuton_ordered_window_feed_fast_i16(&p_ctx->ord_win, p_input, num);
+
+    if (samples_left == 0)
+        p_ctx->is_shift_pending = true;
+
+    return samples_left;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_status_t neuton_osl_window_gather_init(neuton_osl_window_ctx_t* p_ctx, const neuton_u8_t* p_usage_mask)
+{
+    RETURN_IF(p_ctx == NULL, NEUTON_STATUS_NULL_ARGUMENT);
+
+    neuton_u16_t indices_num = 0;
+    neuton_status_t status = neuton_ordered_window_gather_init(p_usage_mask, p_ctx->ord_win.uniq_features_num,
+                                                               p_ctx->gather_indices, NEUTON_OSL_WINDOW_GATHER_MAX,
+                                                               &indices_num);
+
+    p_ctx->gather_num = (status == NEUTON_STATUS_SUCCESS) ? (neuton_u8_t)indices_num : 0;
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+neuton_u16_t neuton_osl_window_feed_gather_i16(neuton_osl_window_ctx_t* p_ctx,
+                                               const neuton_i16_t* p_input, neuton_u16_t num)
+{
+    if (p_ctx->is_shift_pending)
+        shift_window_i16_(p_ctx, p_ctx->gather_num);
+
+    neuton_u16_t samples_left = neuton_ordered_window_feed_gather_i16(&p_ctx->ord_win, p_input, num,
+                                                                      p_ctx->gather_indices, p_ctx->gather_num);
+
+    if (samples_left == 0)
+        p_ctx->is_shift_pending = true;
+
+    return samples_left;
+}
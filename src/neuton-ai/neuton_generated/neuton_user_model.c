@@ -70,6 +70,32 @@ applicable.
 #define MODEL_PARAMS_TYPE          q16
 #define MODEL_REORDERING           0
 
+/** Model layout switches below could be overridden by the build, e.g. by the equivalence test */
+
+/** Model parameters are stored as packed record-per-neuron layout,
+ *  @ref neuton_nn_model_params_packed_q16_t */
+#ifndef MODEL_PACKED_LAYOUT
+#define MODEL_PACKED_LAYOUT        1
+#endif
+
+/** Packed neuron records use 8-bit per-neuron scaled weights,
+ *  @ref neuton_nn_model_params_packed_q8w_t */
+#ifndef MODEL_PACKED_WEIGHTS_Q8
+#define MODEL_PACKED_WEIGHTS_Q8    0
+#endif
+
+/** Extracted features min/max scaling is fused into the packed neuron records,
+ *  @ref neuton_nn_model_params_packed_fused_t */
+#ifndef MODEL_PACKED_FUSED_SCALING
+#define MODEL_PACKED_FUSED_SCALING 0
+#endif
+
+/** Window and subwindows time-domain statistics are assembled from the shared segment aggregates,
+ *  @ref neuton_dsp_segment_stats_i16_t */
+#ifndef MODEL_SEGMENT_STATS
+#define MODEL_SEGMENT_STATS        1
+#endif
+
 #define MODEL_USES_AS_INPUT_INPUT_FEATURES 0
 #define MODEL_USES_AS_INPUT_DSP_FEATURES 1
 #define MODEL_USES_AS_INPUT_MASK ((MODEL_USES_AS_INPUT_INPUT_FEATURES << 0) | (MODEL_USES_AS_INPUT_DSP_FEATURES << 1)) 
@@ -168,14 +194,23 @@ static neuton_u8_t extracted_features_buffer_[EXTRACTED_FEATURES_BUFFER_SIZE_BYT
 #define P_TIMEDOMAIN_FEATURES_CTX  NULL
 /** Timedomain features in feature extraction pipeline  */
 static const neuton_nn_features_pipeline_func_i16_t timedomain_features_[] = {
+#if MODEL_SEGMENT_STATS
+    neuton_nn_feature_utility_segment_stats_i16,
+    neuton_nn_feature_segment_min_max_range_i16,
+#else
     neuton_nn_feature_utility_tss_sum_i16,
     neuton_nn_feature_min_max_range_i16,
+#endif
     neuton_nn_feature_mean_i16,
     neuton_nn_feature_mad_i16,
     neuton_nn_feature_std_i16,
     neuton_nn_feature_rms_i16,
     neuton_nn_feature_mcr_i16,
+#if MODEL_SEGMENT_STATS
+    neuton_nn_feature_segment_zcr_i16,
+#else
     neuton_nn_feature_zcr_i16,
+#endif
     neuton_nn_feature_absmean_i16,
     neuton_nn_feature_amdf_i16,
     neuton_nn_feature_psoz_i16,
@@ -191,6 +226,21 @@ static const neuton_nn_features_pipeline_ctx_t timedomain_pipeline_ = {
 
 #define P_FREQDOMAIN_PIPELINE NULL
 
+/** Extracted features scaling plan, built from the scaling factors on the first features scaling */
+static neuton_dsp_scale_plan_item_t extracted_features_scale_plan_items_[EXTRACTED_FEATURES_NUM];
+static neuton_dsp_scale_plan_t extracted_features_scale_plan_ = {
+    .p_items   = extracted_features_scale_plan_items_,
+    .items_num = 0,
+};
+
+#if MODEL_SEGMENT_STATS
+/** Segment aggregates of the input window, shared by the segment aggregates features */
+static neuton_nn_segment_stats_cache_t segment_stats_cache_;
+#define P_SEGMENT_STATS_CACHE  &segment_stats_cache_
+#else
+#define P_SEGMENT_STATS_CACHE  NULL
+#endif
+
 static neuton_nn_dsp_pipeline_t dsp_pipeline_ = { 
    .features = {  
        .p_masks = (neuton_nn_features_mask_t*)FEATURES_EXTRACTION_MASK, 
@@ -207,6 +257,8 @@ static neuton_nn_dsp_pipeline_t dsp_pipeline_ = {
        .p_arguments = FEATURES_EXTRACTION_ARGUMENTS, 
        },
    }, 
+   .p_scale_plan = &extracted_features_scale_plan_, 
+   .p_segment_stats = P_SEGMENT_STATS_CACHE, 
 }; 
 
 #define P_DSP_PIPELINE         &dsp_pipeline_ 
@@ -214,6 +266,151 @@ static neuton_nn_dsp_pipeline_t dsp_pipeline_ = {
 
 //////////////////////////////////////////////////////////////////////////////
 
+#if MODEL_PACKED_LAYOUT && MODEL_PACKED_FUSED_SCALING
+
+/** Packed neuron records: { internal links num | relu flag, external links num, activation weight,
+ *  fused shift, fused bias x 4, { link index, weight } x internal links num,
+ *  { link index, fused weight x 2 } x external links num } */
+static const neuton_u16_t MODEL_NEURON_PACKED_FUSED_RECORDS[] = { 32768, 11, 0,
+     13, 14981, 58646, 65311, 65535, 0, 35695, 64249, 1, 3552, 2793, 18, 1002,
+     30028, 24, 22498, 62523, 29, 57356, 57883, 30, 61093, 6908, 33, 18969,
+     12322, 35, 54439, 64152, 48, 49751, 11540, 49, 55977, 10936, 50, 14089,
+     14376, 32768, 13, 0, 12, 36289, 65277, 609, 0, 2, 16385, 64361, 5, 49076,
+     5443, 6, 54331, 61066, 7, 40812, 1443, 11, 6495, 645, 12, 8476, 64263, 15,
+     49480, 2077, 17, 39949, 65059, 20, 47700, 101, 25, 55509, 1795, 32, 18649,
+     62883, 46, 16510, 3759, 50, 51277, 46218, 32769, 9, 0, 10, 60112, 25055,
+     65520, 65535, 1, 16645, 0, 29392, 65468, 17, 55347, 65474, 19, 12380,
+     38476, 21, 7410, 65453, 33, 17521, 64916, 38, 23128, 691, 39, 16183, 828,
+     45, 56683, 1504, 47, 27457, 64901, 32771, 15, 0, 11, 54014, 1610, 1592, 0,
+     0, 5597, 1, 32794, 2, 19131, 2, 44940, 1635, 4, 58817, 63756, 8, 50309,
+     4216, 12, 38360, 1200, 13, 48324, 1159, 15, 29805, 771, 18, 40629, 3731,
+     21, 2375, 515, 23, 58751, 810, 27, 35881, 46432, 38, 20975, 2011, 39,
+     51877, 1378, 41, 22815, 62719, 45, 50344, 15386, 51, 32283, 1047, 32768,
+     21, 0, 9, 10799, 13371, 65177, 65535, 0, 36238, 65331, 3, 11583, 494, 4,
+     5536, 325, 6, 2472, 64820, 10, 8054, 65334, 11, 52846, 313, 14, 54457, 317,
+     17, 8066, 65239, 18, 46291, 78, 19, 62492, 53899, 20, 7847, 259, 22, 36633,
+     65444, 26, 12592, 64776, 28, 34522, 18, 30, 57330, 378, 37, 31929, 74, 41,
+     32327, 65018, 42, 12472, 21711, 43, 46656, 44451, 44, 3442, 64801, 47,
+     3226, 206, 32768, 17, 0, 9, 63534, 10569, 209, 0, 0, 53423, 20, 5, 45803,
+     666, 6, 21, 575, 7, 29988, 65053, 9, 3853, 65458, 11, 5675, 65291, 12,
+     15290, 149, 19, 29361, 16776, 20, 23604, 65359, 22, 18079, 65404, 25,
+     34294, 687, 26, 16842, 199, 27, 37033, 58387, 36, 49270, 425, 39, 21232,
+     455, 48, 19493, 721, 49, 42342, 675, 32769, 14, 0, 9, 6180, 22638, 115, 0,
+     1, 62856, 1, 29203, 315, 2, 48937, 65529, 4, 24997, 332, 5, 49256, 65280,
+     8, 445, 64042, 9, 16536, 257, 12, 860, 471, 13, 64217, 64929, 16, 26309,
+     16200, 30, 28377, 396, 31, 47843, 1082, 33, 39796, 65451, 42, 10018, 27866,
+     45, 28983, 1312, 32769, 4, 0, 12, 49833, 9840, 65197, 65535, 6, 11250, 6,
+     22958, 4473, 8, 53146, 22875, 13, 48467, 64197, 31, 21917, 55517, 32771, 7,
+     11264, 13, 12235, 63086, 727, 0, 1, 48962, 4, 33519, 6, 322, 0, 55168,
+     64511, 2, 54634, 882, 7, 55461, 23882, 11, 4900, 1395, 12, 60789, 1072, 17,
+     22715, 63595, 35, 47794, 5929, 32769, 6, 64512, 14, 3685, 33834, 61761,
+     65535, 1, 27747, 0, 42139, 65470, 5, 49709, 10052, 10, 49535, 3747, 15,
+     36450, 6750, 40, 25073, 52721, 41, 48752, 42407, 2, 0, 40959, 24, 0, 41216,
+     24313, 6, 0, 32768, 9, 32766, 32769, 0, 60416, 24, 0, 4096, 61478, 65497,
+     2, 31724, 2, 0, 40959, 24, 0, 61952, 3646, 65473, 2, 32765, 11, 32767,
+     32769, 0, 63488, 24, 0, 25856, 39729, 65486, 3, 32766, 2, 0, 40960, 24, 0,
+     54272, 11180, 83, 3, 32768, 13, 32768, 32771, 3, 60416, 9, 54142, 17791,
+     74, 0, 4, 32770, 5, 2695, 9, 32766, 1, 30755, 158, 29, 44723, 143, 43,
+     38436, 42849, 2, 0, 40955, 24, 0, 59136, 6433, 65502, 4, 32765, 15, 32768,
+     32771, 8, 16384, 10, 19657, 60840, 65169, 65535, 1, 49527, 5, 32553, 9,
+     32766, 6, 63237, 135, 10, 9193, 169, 15, 57452, 1205, 19, 61343, 16775, 25,
+     30092, 1661, 44, 38949, 1598, 46, 12869, 64549, 48, 38987, 1442, 2, 0,
+     40960, 24, 0, 31232, 34220, 83, 5, 36414, 17, 32768, 32769, 6, 0, 9, 6700,
+     61976, 1, 0, 7, 37278, 5, 939, 411, 16, 55857, 20305, 29, 10638, 197, 31,
+     58597, 1244, 33, 15623, 65116, 51, 33250, 106, 2, 0, 40960, 24, 0, 58112,
+     7390, 33, 6, 32768, 19, 32768, 32772, 8, 60416, 14, 9284, 1706, 64686,
+     65535, 2, 6479, 7, 34398, 8, 38718, 19, 8443, 1, 21284, 3847, 7, 41890,
+     42974, 9, 44516, 65269, 15, 50595, 242, 21, 36524, 62326, 31, 48769, 11622,
+     34, 24840, 57392, 40, 32554, 14014, 2, 0, 40954, 24, 0, 3072, 62464, 65535,
+     7, 32768, 21, 32766, 32772, 6, 64512, 14, 42166, 18774, 1072, 0, 1, 1331,
+     6, 4752, 8, 32770, 17, 61875, 10, 59531, 6867, 12, 43521, 52998, 17, 7467,
+     38796, 22, 8627, 1176, 24, 31916, 53743, 46, 11191, 11109, 3, 0, 40959, 24,
+     0, 33280, 32217, 38, 1, 33563, 8, 32765, 23, 32768 };
+
+#define MODEL_NEURON_PACKED_RECORDS MODEL_NEURON_PACKED_FUSED_RECORDS
+
+#elif MODEL_PACKED_LAYOUT && MODEL_PACKED_WEIGHTS_Q8
+
+/** Packed neuron records: { internal links num | relu flag, external links num, activation weight,
+ *  scale multiplier, scale shift, link index x links num, 8-bit weights x links num } */
+static const neuton_u16_t MODEL_NEURON_PACKED_Q8W_RECORDS[] = { 32768, 12, 0,
+     33024, 6, 0, 1, 18, 24, 29, 30, 33, 35, 48, 49, 50, 52, 14051, 59775,
+     29825, 62334, 32639, 28700, 32768, 14, 0, 33022, 6, 2, 5, 6, 7, 11, 12,
+     15, 17, 20, 25, 32, 46, 50, 52, 32737, 2209, 54558, 63275, 7686, 30927,
+     52150, 0, 32769, 10, 0, 53591, 7, 1, 0, 17, 19, 21, 33, 38, 39, 45, 47,
+     52, 61776, 33530, 49645, 32620, 39199, 174, 32771, 16, 0, 33023, 6, 0, 1,
+     2, 2, 4, 8, 12, 13, 15, 18, 21, 23, 27, 38, 39, 41, 45, 51, 52, 33046,
+     22602, 2222, 11344, 16160, 5679, 32732, 33878, 28543, 218, 32768, 22, 0,
+     33025, 6, 0, 3, 4, 6, 10, 11, 14, 17, 18, 19, 20, 22, 26, 28, 30, 37, 41,
+     42, 43, 44, 47, 52, 20919, 34364, 30134, 54069, 43013, 58495, 2464, 6502,
+     25509, 35778, 34870, 0, 32768, 18, 0, 33025, 6, 0, 5, 6, 7, 9, 11, 12, 19,
+     20, 22, 25, 26, 27, 36, 39, 48, 49, 52, 31751, 60002, 42458, 32552, 55209,
+     6492, 2762, 32625, 29566, 0, 32769, 15, 0, 33023, 6, 1, 1, 2, 4, 5, 8, 9,
+     12, 13, 16, 30, 31, 33, 42, 45, 52, 25078, 15871, 62928, 32383, 18852,
+     28011, 32754, 42027, 32769, 5, 0, 32916, 6, 6, 6, 8, 13, 31, 52, 24620,
+     58902, 11649, 0, 32771, 8, 11264, 64538, 7, 1, 4, 6, 0, 2, 7, 11, 12, 17,
+     35, 52, 33214, 59649, 18188, 4641, 14573, 14, 32769, 7, 64512, 33024, 6,
+     1, 0, 5, 10, 15, 40, 41, 52, 65388, 11067, 49187, 43393, 2, 1, 40959,
+     33026, 6, 0, 9, 52, 32641, 6, 32769, 1, 60416, 63948, 7, 2, 52, 55679, 0,
+     2, 1, 40959, 33025, 6, 2, 11, 52, 32639, 194, 32769, 1, 63488, 33024, 6,
+     3, 52, 53119, 0, 2, 1, 40960, 33026, 6, 3, 13, 52, 33153, 83, 32771, 4,
+     60416, 33024, 6, 4, 5, 9, 1, 29, 43, 52, 2689, 12671, 48678, 248, 2, 1,
+     40955, 33026, 6, 4, 15, 52, 33151, 222, 32771, 9, 16384, 33025, 6, 1, 5,
+     9, 6, 10, 15, 19, 25, 44, 46, 48, 52, 32450, 3199, 25631, 28479, 33407,
+     2943, 2, 1, 40960, 33026, 6, 5, 17, 52, 33167, 83, 32769, 7, 0, 65441, 7,
+     7, 5, 16, 29, 31, 33, 51, 52, 19857, 13660, 47999, 36654, 2, 1, 40960,
+     33026, 6, 6, 19, 52, 33153, 33, 32772, 9, 60416, 62766, 7, 2, 7, 8, 19, 1,
+     7, 9, 15, 21, 31, 34, 40, 52, 33050, 8851, 56871, 508, 10201, 18900, 240,
+     0, 2, 1, 40954, 33026, 6, 7, 21, 52, 32641, 0, 32772, 7, 64512, 33024, 6,
+     1, 6, 8, 17, 10, 12, 17, 22, 24, 46, 52, 4613, 62081, 38735, 2945, 22994,
+     188, 3, 1, 40959, 33026, 6, 1, 8, 23, 52, 32644, 9857 };
+
+#define MODEL_NEURON_PACKED_RECORDS MODEL_NEURON_PACKED_Q8W_RECORDS
+
+#elif MODEL_PACKED_LAYOUT
+
+/** Packed neuron records: { internal links num | relu flag, external links num, activation weight,
+ *  { link index, weight } x links num } */
+static const neuton_u16_t MODEL_NEURON_PACKED_RECORDS[] = { 32768, 12, 0, 0,
+     58135, 1, 13914, 18, 32763, 24, 59490, 29, 32886, 30, 30028, 33, 32524, 35,
+     62244, 48, 32766, 49, 32763, 50, 7111, 52, 28900, 32768, 14, 0, 2, 57411,
+     5, 32764, 6, 40941, 7, 2163, 11, 7738, 12, 54548, 15, 11126, 17, 63201, 20,
+     1608, 25, 7764, 32, 52938, 46, 31040, 50, 46426, 52, 51918, 32769, 10, 0,
+     1, 16645, 0, 62427, 17, 64337, 19, 39110, 21, 61615, 33, 52450, 38, 22524,
+     39, 26586, 45, 6409, 47, 43950, 52, 48426, 32771, 16, 0, 0, 5597, 1, 32794,
+     2, 19131, 2, 22626, 4, 44507, 8, 2059, 12, 20728, 13, 11375, 15, 8262, 18,
+     16286, 21, 12182, 23, 5790, 27, 56208, 38, 32764, 39, 22129, 41, 33613, 45,
+     32765, 51, 28718, 52, 55779, 32768, 22, 0, 0, 46717, 3, 20804, 4, 15370, 6,
+     34015, 10, 46370, 11, 30113, 14, 13603, 17, 53895, 18, 1374, 19, 42809, 20,
+     32767, 22, 58229, 26, 40876, 28, 2358, 30, 26347, 37, 6422, 41, 42075, 42,
+     25528, 43, 49599, 44, 35407, 47, 14018, 52, 34514, 32768, 18, 0, 0, 1916,
+     5, 32101, 6, 25315, 7, 59752, 9, 55609, 11, 42034, 12, 10306, 19, 32767,
+     20, 43199, 22, 55010, 25, 23779, 26, 6467, 27, 51574, 36, 2656, 39, 29231,
+     48, 32766, 49, 32384, 52, 29734, 32769, 15, 0, 1, 62856, 1, 25143, 2,
+     65190, 4, 15715, 5, 53246, 8, 62618, 9, 32765, 12, 32528, 13, 41760, 16,
+     18732, 30, 27568, 31, 28236, 33, 61972, 42, 32765, 45, 11179, 52, 41737,
+     32769, 5, 0, 6, 11250, 6, 24618, 8, 5585, 13, 58973, 31, 32877, 52, 11617,
+     32771, 8, 11264, 1, 48962, 4, 33519, 6, 322, 0, 59644, 2, 3053, 7, 17892,
+     11, 8367, 12, 4631, 17, 60780, 35, 14113, 52, 3428, 32769, 7, 64512, 1,
+     27747, 0, 65348, 5, 15126, 10, 11119, 15, 9037, 40, 49153, 41, 32770, 52,
+     43114, 2, 1, 40959, 0, 32768, 9, 32766, 52, 1631, 32769, 1, 60416, 2,
+     31724, 52, 55792, 2, 1, 40959, 2, 32765, 11, 32767, 52, 49422, 32769, 1,
+     63488, 3, 32766, 52, 52891, 2, 1, 40960, 3, 32768, 13, 32768, 52, 21292,
+     32771, 4, 60416, 4, 32770, 5, 2695, 9, 32766, 1, 12631, 29, 9809, 43,
+     48388, 52, 63358, 2, 1, 40955, 4, 32765, 15, 32768, 52, 56857, 32771, 9,
+     16384, 1, 49527, 5, 32553, 9, 32766, 6, 2993, 10, 8029, 15, 25829, 19,
+     16383, 25, 28732, 44, 32767, 46, 32944, 48, 32766, 52, 2879, 2, 1, 40960,
+     5, 36414, 17, 32768, 52, 21382, 32769, 7, 0, 7, 37278, 5, 19790, 16, 23479,
+     29, 13460, 31, 32465, 33, 47809, 51, 11680, 52, 36730, 2, 1, 40960, 6,
+     32768, 19, 32768, 52, 8477, 32772, 9, 60416, 2, 6479, 7, 34398, 8, 38718,
+     19, 8443, 1, 9583, 7, 57085, 9, 64476, 15, 325, 21, 56047, 31, 9472, 34,
+     54735, 40, 17917, 52, 61718, 2, 1, 40954, 7, 32768, 21, 32766, 52, 65524,
+     32772, 7, 64512, 1, 1331, 6, 4752, 8, 32770, 17, 61875, 10, 20376, 12,
+     38479, 17, 32770, 22, 2937, 24, 53703, 46, 22932, 52, 48023, 3, 1, 40959,
+     1, 33563, 8, 32765, 23, 32768, 52, 9854 };
+
+#else
+
 static const neuton_weight_t MODEL_WEIGHTS[] = { -7401, 13914, 32763, -6046,
      -32650, 30028, 32524, -3292, 32766, 32763, 7111, 28900, -8125, 32764, -24595,
      2163, 7738, -10988, 11126, -2335, 1608, 7764, -12598, 31040, -19110, -13618,
@@ -264,6 +461,8 @@ static const neuton_coeff_t MODEL_NEURON_ACTIVATION_WEIGHTS[] = { 0, 0, 0, 0, 0,
 
 static const neuton_u8_t MODEL_NEURON_ACTIVATION_TYPE_MASK[] = { 0xff, 0xab, 0xaa, 0x00 };
 
+#endif /* MODEL_PACKED_LAYOUT */
+
 static const neuton_u16_t MODEL_OUTPUT_NEURONS_INDICES[] = { 10, 24, 12, 14,
      16, 18, 20, 22 };
 
@@ -275,9 +474,31 @@ static const neuton_u16_t MODEL_OUTPUT_NEURONS_INDICES[] = { 10, 24, 12, 14,
 
 //////////////////////////////////////////////////////////////////////////////
 #define NN_INPUT_SETUP_INTERFACE       neuton_nn_input_setup_sliding_window 
-#define NN_INPUT_FEED_INTERFACE        neuton_nn_input_feed_sliding_window_i16 
-#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_q16 
+#ifndef NN_INPUT_FEED_INTERFACE
+#define NN_INPUT_FEED_INTERFACE        neuton_nn_input_feed_sliding_window_fast_i16 
+#endif
+#ifndef NN_PROCESS_FEATURES_INTERFACE
+#if MODEL_PACKED_LAYOUT && MODEL_PACKED_FUSED_SCALING && MODEL_SEGMENT_STATS
+#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_unscaled_segmented 
+#elif MODEL_PACKED_LAYOUT && MODEL_PACKED_FUSED_SCALING
+#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_unscaled 
+#elif MODEL_SEGMENT_STATS
+#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_q16_segmented 
+#else
+#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_q16_planned 
+#endif
+#endif
+#ifndef NN_RUN_INFERENCE_INTERFACE
+#if MODEL_PACKED_LAYOUT && MODEL_PACKED_FUSED_SCALING
+#define NN_RUN_INFERENCE_INTERFACE     neuton_nn_run_model_inference_packed_fused 
+#elif MODEL_PACKED_LAYOUT && MODEL_PACKED_WEIGHTS_Q8
+#define NN_RUN_INFERENCE_INTERFACE     neuton_nn_run_model_inference_packed_q8w 
+#elif MODEL_PACKED_LAYOUT
+#define NN_RUN_INFERENCE_INTERFACE     neuton_nn_run_model_inference_packed_q16 
+#else
 #define NN_RUN_INFERENCE_INTERFACE     neuton_nn_run_model_inference_q16 
+#endif
+#endif
 #define NN_PROPAGATE_OUTPUTS_INTERFACE neuton_nn_output_dequantize_q16_f32 
 #define NN_DECODE_OUTPUTS_INTERFACE    neuton_nn_output_decode_classification_f32 
 
@@ -310,22 +531,32 @@ static neuton_nn_t neuton_nn_ = {
     .p_dsp = P_DSP_PIPELINE,
     ///
     .model.meta.p_solution_id_str           = MODEL_SOLUTION_ID_STR,
+#if !MODEL_PACKED_LAYOUT
     .model.meta.p_neuron_internal_links_num = MODEL_NEURON_INTERNAL_LINKS_NUM,
     .model.meta.p_neuron_external_links_num = MODEL_NEURON_EXTERNAL_LINKS_NUM,
-    .model.meta.p_output_neurons_indices    = MODEL_OUTPUT_NEURONS_INDICES,
     .model.meta.p_neuron_links              = MODEL_NEURONS_LINKS,
     .model.meta.p_neuron_act_type_mask      = MODEL_NEURON_ACTIVATION_TYPE_MASK,
+#endif
+    .model.meta.p_output_neurons_indices    = MODEL_OUTPUT_NEURONS_INDICES,
     .model.meta.outputs_num                 = MODEL_OUTPUTS_NUM,
     .model.meta.neurons_num                 = MODEL_NEURONS_NUM,
     .model.meta.weights_num                 = MODEL_WEIGHTS_NUM,
     .model.meta.task                        = MODEL_TASK,
     .model.meta.uses_as_input.all           = MODEL_USES_AS_INPUT_MASK,
 
+#if MODEL_PACKED_LAYOUT
+    .model.params.packed_q16 = {
+        .p_records   = MODEL_NEURON_PACKED_RECORDS,
+        .records_num = sizeof(MODEL_NEURON_PACKED_RECORDS) / sizeof(MODEL_NEURON_PACKED_RECORDS[0]),
+        .p_neurons   = model_neurons_,
+    },
+#else
     .model.params.MODEL_PARAMS_TYPE = {
         .p_weights      = MODEL_WEIGHTS,
         .p_act_weights = MODEL_NEURON_ACTIVATION_WEIGHTS,
         .p_neurons      = model_neurons_,
     },
+#endif
 
     .model.output.memory.p_void = model_outputs_,
     .model.output.num = MODEL_OUTPUTS_NUM,
@@ -351,11 +582,16 @@ neuton_nn_t* neuton_nn_user_model(void)
 
 neuton_u32_t neuton_nn_user_model_size(void)
 {
+#if MODEL_PACKED_LAYOUT
+    neuton_u32_t model_meta_size = 
+    (sizeof(MODEL_NEURON_PACKED_RECORDS) + sizeof(MODEL_OUTPUT_NEURONS_INDICES));
+#else
     neuton_u32_t model_meta_size = 
     (sizeof(MODEL_WEIGHTS) + sizeof(MODEL_NEURONS_LINKS) + sizeof(MODEL_NEURON_EXTERNAL_LINKS_NUM) +
             sizeof(MODEL_NEURON_INTERNAL_LINKS_NUM) + sizeof(MODEL_NEURON_ACTIVATION_WEIGHTS) +
             sizeof(MODEL_NEURON_ACTIVATION_TYPE_MASK) +
             sizeof(MODEL_OUTPUT_NEURONS_INDICES));
+#endif
 
 #if MODEL_TASK == __NEUTON_NN_TASK_ANOMALY_DETECTION
     model_meta_size += sizeof(MODEL_AVERAGE_EMBEDDING) + sizeof(MODEL_OUTPUT_SCALE_MIN) + 
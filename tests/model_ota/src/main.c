@@ -0,0 +1,337 @@
+/*
+ * Loopback test of the model transfer protocol: the peer streams an image over a lossy link
+ * into the RAM flash slots, the slot erase is completed asynchronously as by the work item.
+ */
+#include "model_ota_protocol.h"
+
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define SLOT_SIZE (8192U)
+#define IMAGE_SIZE (5003U)
+#define MTU (244U)
+#define WINDOW (8U)
+#define LOSS_PERCENT (10U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint8_t flash_[MODEL_OTA_SLOTS_NUM][SLOT_SIZE];
+static uint8_t image_[IMAGE_SIZE];
+
+static struct
+{
+    int erase_requests;
+    int erase_result;
+    uint8_t erase_slot;
+    uint32_t erase_size;
+    int unaligned_writes;
+} storage_state_;
+
+static struct
+{
+    int responses;
+    uint8_t command;
+    uint8_t status;
+    uint16_t chunk_size;
+    bool ack;
+    uint32_t ack_offset;
+} peer_;
+
+static uint32_t random_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int erase_(uint8_t slot, uint32_t size)
+{
+    storage_state_.erase_requests++;
+    storage_state_.erase_slot = slot;
+    storage_state_.erase_size = size;
+
+    return storage_state_.erase_result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int write_(uint8_t slot, uint32_t offset, const void* p_data, uint32_t len)
+{
+    if (((offset % MODEL_OTA_WRITE_ALIGN) != 0) || ((len % MODEL_OTA_WRITE_ALIGN) != 0))
+        storage_state_.unaligned_writes++;
+
+    memcpy(&flash_[slot][offset], p_data, len);
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const void* map_(uint8_t slot)
+{
+    return flash_[slot];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int notify_(const uint8_t* p_data, uint16_t len, void* p_ctx)
+{
+    ARG_UNUSED(len);
+    ARG_UNUSED(p_ctx);
+
+    if (p_data[0] == MODEL_OTA_OP_ACK)
+    {
+        peer_.ack = true;
+        peer_.ack_offset = sys_get_le32(&p_data[1]);
+    }
+    else
+    {
+        peer_.responses++;
+        peer_.command = p_data[1];
+        peer_.status = p_data[2];
+        peer_.chunk_size = sys_get_le16(&p_data[3]);
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static bool verify_(const void* p_image, uint32_t size, void* p_ctx)
+{
+    ARG_UNUSED(p_image);
+    ARG_UNUSED(size);
+    ARG_UNUSED(p_ctx);
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static model_ota_storage_t storage_ = {
+    .erase = erase_,
+    .write = write_,
+    .map = map_,
+    .slot_size = SLOT_SIZE,
+};
+
+static model_ota_t ota_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_next_(void)
+{
+    random_ = random_ * 1664525U + 1013904223U;
+    return random_ >> 16;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void complete_erase_(int err)
+{
+    if (err == 0)
+        memset(flash_[storage_state_.erase_slot], 0xFF, storage_state_.erase_size);
+
+    model_ota_erased(&ota_, err);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static model_ota_status_t start_(uint32_t crc)
+{
+    uint8_t cmd[10] = {MODEL_OTA_OP_START};
+
+    sys_put_le32(IMAGE_SIZE, &cmd[1]);
+    sys_put_le32(crc, &cmd[5]);
+    cmd[9] = WINDOW;
+
+    return model_ota_on_control(&ota_, cmd, sizeof(cmd));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void send_chunk_(uint32_t offset)
+{
+    uint8_t packet[MTU];
+    const uint32_t len = MIN(IMAGE_SIZE - offset, peer_.chunk_size);
+
+    sys_put_le32(offset, packet);
+    memcpy(&packet[4], &image_[offset], len);
+
+    model_ota_on_data(&ota_, packet, (uint16_t)(4U + len));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Go-back-N peer, lost chunks are resent from the last acknowledged offset after the timeout */
+static void transfer_(uint32_t loss_percent)
+{
+    uint32_t base = 0;
+
+    while (base < IMAGE_SIZE)
+    {
+        uint32_t offset = base;
+
+        peer_.ack = false;
+
+        for (uint32_t i = 0; (i < WINDOW) && (offset < IMAGE_SIZE); i++)
+        {
+            if ((random_next_() % 100U) >= loss_percent)
+                send_chunk_(offset);
+
+            offset += MIN(IMAGE_SIZE - offset, peer_.chunk_size);
+        }
+
+        if (peer_.ack)
+            base = peer_.ack_offset;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static model_ota_status_t finish_(void)
+{
+    const uint8_t cmd = MODEL_OTA_OP_FINISH;
+
+    return model_ota_on_control(&ota_, &cmd, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    memset(&storage_state_, 0, sizeof(storage_state_));
+    memset(&peer_, 0, sizeof(peer_));
+    memset(flash_, 0, sizeof(flash_));
+
+    random_ = 1;
+
+    for (uint32_t i = 0; i < IMAGE_SIZE; i++)
+        image_[i] = (uint8_t)random_next_();
+
+    memset(&ota_, 0, sizeof(ota_));
+    ota_.p_storage = &storage_;
+    ota_.notify = notify_;
+    ota_.verify = verify_;
+    ota_.mtu = MTU;
+    ota_.active_slot = MODEL_OTA_SLOT_NONE;
+
+    model_ota_reset(&ota_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_crc32_check_value)
+{
+    zassert_equal(model_ota_crc32(0, "123456789", 9), 0xCBF43926U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_lossy_transfer)
+{
+    const uint32_t crc = model_ota_crc32(0, image_, IMAGE_SIZE);
+    uint8_t slot;
+
+    zassert_equal(start_(crc), MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(peer_.responses, 0, "START shouldn't be answered before the slot is erased");
+    zassert_equal(storage_state_.erase_slot, 0);
+
+    complete_erase_(0);
+    zassert_equal(peer_.responses, 1);
+    zassert_equal(peer_.command, MODEL_OTA_OP_START);
+    zassert_equal(peer_.status, MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(peer_.chunk_size, MODEL_OTA_CHUNK_MAX);
+
+    transfer_(LOSS_PERCENT);
+    zassert_true(ota_.stats.dropped > 0, "link should lose chunks");
+    zassert_equal(storage_state_.unaligned_writes, 0);
+
+    zassert_equal(finish_(), MODEL_OTA_STATUS_SUCCESS);
+    zassert_true(model_ota_pending(&ota_, &slot));
+    zassert_equal(slot, 0);
+    zassert_mem_equal(flash_[slot], image_, IMAGE_SIZE);
+
+    /* Pending slot couldn't be overwritten until it is activated */
+    zassert_equal(start_(crc), MODEL_OTA_STATUS_INVALID_STATE);
+
+    model_ota_activated(&ota_, true, 0);
+    zassert_equal(ota_.active_slot, 0);
+
+    zassert_equal(start_(crc), MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(storage_state_.erase_slot, 1, "transfer should target the inactive slot");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_crc_mismatch)
+{
+    const uint32_t crc = model_ota_crc32(0, image_, IMAGE_SIZE);
+
+    zassert_equal(start_(crc ^ 1U), MODEL_OTA_STATUS_SUCCESS);
+    complete_erase_(0);
+    transfer_(0);
+
+    zassert_equal(finish_(), MODEL_OTA_STATUS_CRC_MISMATCH);
+    zassert_false(model_ota_pending(&ota_, NULL));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_chunks_before_erase_are_dropped)
+{
+    zassert_equal(start_(0), MODEL_OTA_STATUS_SUCCESS);
+
+    peer_.chunk_size = MODEL_OTA_CHUNK_MAX;
+    send_chunk_(0);
+    zassert_equal(ota_.stats.chunks, 0);
+
+    complete_erase_(0);
+    send_chunk_(0);
+    zassert_equal(ota_.stats.chunks, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_erase_failure)
+{
+    zassert_equal(start_(0), MODEL_OTA_STATUS_SUCCESS);
+    complete_erase_(-EIO);
+
+    zassert_equal(peer_.responses, 1);
+    zassert_equal(peer_.status, MODEL_OTA_STATUS_STORAGE_ERROR);
+    zassert_equal(ota_.state, MODEL_OTA_STATE_IDLE);
+
+    storage_state_.erase_result = -EBUSY;
+    zassert_equal(start_(0), MODEL_OTA_STATUS_STORAGE_ERROR);
+    zassert_equal(peer_.status, MODEL_OTA_STATUS_STORAGE_ERROR);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(model_ota_protocol, test_abort_during_erase)
+{
+    const uint8_t abort = MODEL_OTA_OP_ABORT;
+
+    zassert_equal(start_(0), MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(model_ota_on_control(&ota_, &abort, 1), MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(peer_.responses, 1);
+
+    /* Slot is still erased for the aborted transfer */
+    zassert_equal(start_(0), MODEL_OTA_STATUS_INVALID_STATE);
+    zassert_equal(storage_state_.erase_requests, 1);
+
+    complete_erase_(0);
+    zassert_equal(peer_.responses, 2, "completion of the aborted erase shouldn't be answered");
+    zassert_equal(ota_.state, MODEL_OTA_STATE_IDLE);
+
+    zassert_equal(start_(0), MODEL_OTA_STATUS_SUCCESS);
+    zassert_equal(storage_state_.erase_requests, 2);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(model_ota_protocol, NULL, NULL, before_, NULL, NULL);
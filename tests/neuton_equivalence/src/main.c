@@ -0,0 +1,713 @@
+/*
+ * Equivalence test of the shipped user model: the default model of the application (packed layout,
+ * fast feed, segment aggregates, scaling plan) is compared with the same model on the prebuilt
+ * library defaults, the outputs should be bit-exact on the same input trace.
+ */
+#include "models.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/features/neuton_nn_process_features.h>
+#include <neuton/nn/private/inference/neuton_nn_packed_model.h>
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton/nn/private/input/neuton_nn_input_feed.h>
+#include <neuton/nn/private/input/neuton_nn_input_setup.h>
+#include <neuton/nn/private/output/neuton_nn_output_propagate.h>
+#include <neuton_user_model.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_NUM            (6U)
+#define WINDOWS_NUM         (200U)
+#define VECTORS_NUM         (2000U)
+#define FEED_CHUNK_MAX      (4U)
+#define WINDOW_SIZE_MAX     (128U)
+#define FEATURES_MAX        (64U)
+#define RECORDS_MAX         (1024U)
+#define NEURONS_MAX         (64U)
+#define OUTPUTS_MAX         (16U)
+
+/** Batch crosses the chunk boundary twice and ends with a partial chunk */
+#define BATCH_NUM           (2U * NEUTON_NN_BATCH_CHUNK_SIZE + 3U)
+
+/** Fused scaling tolerance: output neurons difference in q16 LSB and mismatched classes of VECTORS_NUM */
+#define FUSED_DELTA_MAX         (256U)
+#define FUSED_MISMATCHES_MAX    (VECTORS_NUM / 200U)
+
+/** 8-bit weights accuracy: probabilities difference and mismatched classes of WINDOWS_NUM */
+#define Q8W_DELTA_MAX           (0.2f)
+#define Q8W_DELTA_MEAN_MAX      (0.005f)
+#define Q8W_MISMATCHES_MAX      (WINDOWS_NUM / 50U)
+
+/** Sample rate of the trace, Hz */
+#define TRACE_RATE          (100.0f)
+
+/** Axes 0, 2, 3 and 5 of the masked input */
+#define USAGE_MASK          (0x2DU)
+#define AXES_USED_NUM       (4U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_t* p_ref_;
+static neuton_nn_t* p_dut_;
+static neuton_nn_t* p_fused_;
+static neuton_nn_t* p_q8w_;
+
+static struct
+{
+    uint32_t random;
+    uint32_t tick;
+    float    freq[AXES_NUM];
+    float    amplitude[AXES_NUM];
+} trace_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t random_next_(void)
+{
+    trace_.random = trace_.random * 1664525U + 1013904223U;
+    return trace_.random >> 8;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Uniform random value in [0, 1) */
+static float random_unit_(void)
+{
+    return (float)random_next_() / (float)(1U << 24);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Synthetic IMU trace: each axis is a sine with the random frequency and amplitude changed every window,
+ * with noise and rare spikes up to the sensor range, so the features also cross the model scaling bounds
+ */
+static void trace_sample_(neuton_i16_t* p_sample)
+{
+    if ((trace_.tick % 99U) == 0)
+    {
+        for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+        {
+            trace_.freq[axis]      = 0.2f + 8.0f * random_unit_();
+            trace_.amplitude[axis] = 30000.0f * random_unit_() * random_unit_();
+        }
+    }
+
+    const float t = (float)trace_.tick / TRACE_RATE;
+
+    for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        float value = trace_.amplitude[axis] * sinf(2.0f * 3.14159265f * trace_.freq[axis] * t + (float)axis);
+
+        value += 512.0f * (random_unit_() - 0.5f);
+
+        if ((random_next_() % 512U) == 0)
+            value = (random_next_() & 1U) ? 32767.0f : -32768.0f;
+
+        p_sample[axis] = (neuton_i16_t)CLAMP(value, -32768.0f, 32767.0f);
+    }
+
+    trace_.tick++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t* neurons_q16_(neuton_nn_t* p_nn)
+{
+    return p_nn->model.params.q16.p_neurons;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void* setup_(void)
+{
+    p_ref_   = reference_user_model();
+    p_dut_   = neuton_nn_user_model();
+    p_fused_ = fused_user_model();
+    p_q8w_   = q8w_user_model();
+
+    return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    memset(&trace_, 0, sizeof(trace_));
+    trace_.random = 1;
+
+    zassert_equal(neuton_nn_setup(p_ref_), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_setup(p_dut_), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_setup(p_fused_), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_setup(p_q8w_), NEUTON_STATUS_SUCCESS);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_equivalence, test_end_to_end_default)
+{
+    const neuton_u16_t features_num = p_ref_->p_dsp->features.overall_num;
+    const neuton_u16_t neurons_num  = p_ref_->model.meta.neurons_num;
+    const neuton_u16_t outputs_num  = p_ref_->model.output.num;
+    neuton_i16_t       sample[AXES_NUM];
+    uint32_t           windows = 0;
+
+    zassert_equal(p_dut_->p_dsp->features.overall_num, features_num);
+    zassert_equal(p_dut_->model.output.num, outputs_num);
+
+    while (windows < WINDOWS_NUM)
+    {
+        trace_sample_(sample);
+
+        const neuton_status_t status = neuton_nn_feed_inputs(p_ref_, sample, AXES_NUM);
+
+        zassert_equal(neuton_nn_feed_inputs(p_dut_, sample, AXES_NUM), status, "tick %u", trace_.tick);
+
+        if (status != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_equal(neuton_nn_run_inference(p_ref_), NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_nn_run_inference(p_dut_), NEUTON_STATUS_SUCCESS);
+
+        zassert_mem_equal(p_dut_->p_dsp->features.extracted_memory.p_void,
+                          p_ref_->p_dsp->features.extracted_memory.p_void,
+                          features_num * sizeof(neuton_u16_t), "window %u features", windows);
+        zassert_mem_equal(neurons_q16_(p_dut_), neurons_q16_(p_ref_), neurons_num * sizeof(neuton_u16_t),
+                          "window %u neurons", windows);
+        zassert_mem_equal(p_dut_->model.output.memory.p_f32, p_ref_->model.output.memory.p_f32,
+                          outputs_num * sizeof(neuton_f32_t), "window %u outputs", windows);
+        zassert_equal(p_dut_->decoded_output.classif.predicted_class,
+                      p_ref_->decoded_output.classif.predicted_class, "window %u class", windows);
+
+        windows++;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Packed q16 inference of the same scaled features, including the saturated ones */
+ZTEST(neuton_equivalence, test_packed_q16_inference)
+{
+    const neuton_u16_t features_num   = p_ref_->p_dsp->features.overall_num;
+    const neuton_u16_t neurons_num    = p_ref_->model.meta.neurons_num;
+    neuton_u16_t*      p_ref_features = (neuton_u16_t*)p_ref_->p_dsp->features.extracted_memory.p_void;
+    neuton_u16_t*      p_dut_features = (neuton_u16_t*)p_dut_->p_dsp->features.extracted_memory.p_void;
+
+    for (uint32_t v = 0; v < VECTORS_NUM; v++)
+    {
+        for (neuton_u16_t i = 0; i < features_num; i++)
+        {
+            if (v == 0)
+                p_ref_features[i] = 0;
+            else if (v == 1)
+                p_ref_features[i] = UINT16_MAX;
+            else
+                p_ref_features[i] = (neuton_u16_t)random_next_();
+        }
+
+        memcpy(p_dut_features, p_ref_features, features_num * sizeof(neuton_u16_t));
+
+        p_ref_->interfaces.run_inference(p_ref_);
+        p_dut_->interfaces.run_inference(p_dut_);
+
+        zassert_mem_equal(neurons_q16_(p_dut_), neurons_q16_(p_ref_), neurons_num * sizeof(neuton_u16_t),
+                          "vector %u", v);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Fast deinterleaving feed of the sliding window, samples are fed by 1 to FEED_CHUNK_MAX per call */
+ZTEST(neuton_equivalence, test_sliding_window_fast_feed)
+{
+    const neuton_u32_t window_size = (neuton_u32_t)p_ref_->input.window_size * p_ref_->input.unique_num_used;
+    neuton_i16_t       chunk[FEED_CHUNK_MAX * AXES_NUM];
+    uint32_t           windows = 0;
+
+    zassert_equal(p_dut_->input.window_size, p_ref_->input.window_size);
+    zassert_equal(p_dut_->input.window_shift, p_ref_->input.window_shift);
+
+    while (windows < WINDOWS_NUM)
+    {
+        const neuton_u16_t samples_num = (neuton_u16_t)(1U + random_next_() % FEED_CHUNK_MAX);
+
+        for (neuton_u16_t i = 0; i < samples_num; i++)
+            trace_sample_(&chunk[i * AXES_NUM]);
+
+        const neuton_status_t status = p_ref_->interfaces.feed_inputs(&p_ref_->input, chunk,
+                                                                      samples_num * AXES_NUM);
+
+        zassert_equal(p_dut_->interfaces.feed_inputs(&p_dut_->input, chunk, samples_num * AXES_NUM), status,
+                      "tick %u", trace_.tick);
+
+        if (status != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_mem_equal(p_dut_->input.window_memory.p_i16, p_ref_->input.window_memory.p_i16,
+                          window_size * sizeof(neuton_i16_t), "window %u", windows);
+
+        windows++;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Masked input of the shipped model window parameters with its own window memory and context */
+static void make_masked_input_(neuton_nn_input_t*      p_input,
+                               neuton_i16_t*           p_window,
+                               neuton_nn_window_ctx_t* p_window_ctx)
+{
+    static const neuton_u8_t usage_mask = USAGE_MASK;
+
+    const neuton_nn_input_t input = {
+        .p_usage_mask         = &usage_mask,
+        .type                 = p_ref_->input.type,
+        .unique_num           = p_ref_->input.unique_num,
+        .unique_num_used      = AXES_USED_NUM,
+        .unique_scales_num    = p_ref_->input.unique_scales_num,
+        .window_size          = p_ref_->input.window_size,
+        .window_shift         = p_ref_->input.window_shift,
+        .subwindow_num        = p_ref_->input.subwindow_num,
+        .window_memory.p_i16  = p_window,
+        .p_window_ctx         = p_window_ctx,
+    };
+
+    zassert_true(p_ref_->input.window_size <= WINDOW_SIZE_MAX);
+
+    /* Input has constant members, so it is taken by memory */
+    memcpy(p_input, &input, sizeof(input));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fast and gather feeds of the input with the usage mask, that takes only the used axes
+ * like the library masked feed, samples are fed by 1 to FEED_CHUNK_MAX per call
+ */
+ZTEST(neuton_equivalence, test_sliding_window_fast_feed_masked)
+{
+    static neuton_i16_t           windows_memory[3][WINDOW_SIZE_MAX * AXES_USED_NUM];
+    static neuton_nn_window_ctx_t windows_ctx[3];
+    neuton_nn_input_t             ref;
+    neuton_nn_input_t             fast;
+    neuton_nn_input_t             gather;
+    neuton_i16_t                  chunk[FEED_CHUNK_MAX * AXES_NUM];
+    uint32_t                      windows = 0;
+
+    make_masked_input_(&ref, windows_memory[0], &windows_ctx[0]);
+    make_masked_input_(&fast, windows_memory[1], &windows_ctx[1]);
+    make_masked_input_(&gather, windows_memory[2], &windows_ctx[2]);
+
+    zassert_equal(neuton_nn_input_setup_sliding_window(&ref), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_input_setup_sliding_window(&fast), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_input_setup_sliding_window_gather(&gather), NEUTON_STATUS_SUCCESS);
+
+    while (windows < WINDOWS_NUM)
+    {
+        const neuton_u16_t samples_num = (neuton_u16_t)(1U + random_next_() % FEED_CHUNK_MAX);
+
+        for (neuton_u16_t i = 0; i < samples_num; i++)
+            trace_sample_(&chunk[i * AXES_NUM]);
+
+        const neuton_status_t status = neuton_nn_input_feed_sliding_window_masked_i16(&ref, chunk,
+                                                                                      samples_num * AXES_NUM);
+
+        zassert_equal(neuton_nn_input_feed_sliding_window_fast_i16(&fast, chunk, samples_num * AXES_NUM), status,
+                      "tick %u", trace_.tick);
+        zassert_equal(neuton_nn_input_feed_sliding_window_gather_i16(&gather, chunk, samples_num * AXES_NUM),
+                      status, "tick %u", trace_.tick);
+
+        if (status != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_mem_equal(windows_memory[1], windows_memory[0], sizeof(windows_memory[0]), "window %u", windows);
+        zassert_mem_equal(windows_memory[2], windows_memory[0], sizeof(windows_memory[0]), "window %u", windows);
+
+        windows++;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Next window of the trace collected by the library feed and copied to the tested model window,
+ * every few windows the axes are replaced with the constant and full-scale alternating signals
+ */
+static void next_window_(uint32_t index)
+{
+    const neuton_u16_t window_size = p_ref_->input.window_size;
+    neuton_i16_t*      p_window    = p_ref_->input.window_memory.p_i16;
+    neuton_i16_t       sample[AXES_NUM];
+
+    do
+    {
+        trace_sample_(sample);
+    } while (p_ref_->interfaces.feed_inputs(&p_ref_->input, sample, AXES_NUM) != NEUTON_STATUS_SUCCESS);
+
+    for (neuton_u16_t axis = 0; axis < p_ref_->input.unique_num_used; axis++)
+    {
+        neuton_i16_t* p_axis = &p_window[axis * window_size];
+
+        for (neuton_u16_t i = 0; i < window_size; i++)
+        {
+            if ((index % 8U) == 1U)
+                p_axis[i] = (neuton_i16_t)(axis * 1000);
+            else if ((index % 8U) == 2U)
+                p_axis[i] = (i & 1U) ? INT16_MAX : INT16_MIN;
+            else if ((index % 8U) == 3U)
+                p_axis[i] = (axis & 1U) ? INT16_MAX : INT16_MIN;
+        }
+    }
+
+    memcpy(p_dut_->input.window_memory.p_i16, p_window,
+           (neuton_u32_t)window_size * p_ref_->input.unique_num_used * sizeof(neuton_i16_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Window features assembled from the segment aggregates, scaled to q16 */
+ZTEST(neuton_equivalence, test_segmented_features)
+{
+    const neuton_u16_t features_num = p_ref_->p_dsp->features.overall_num;
+
+    zassert_equal(p_dut_->interfaces.process_features, neuton_nn_process_features_dsp_i16_q16_segmented);
+    zassert_not_null(p_dut_->p_dsp->p_segment_stats);
+
+    for (uint32_t w = 0; w < WINDOWS_NUM; w++)
+    {
+        next_window_(w);
+
+        zassert_equal(p_ref_->interfaces.process_features(&p_ref_->input, p_ref_->p_dsp), NEUTON_STATUS_SUCCESS);
+        zassert_equal(p_dut_->interfaces.process_features(&p_dut_->input, p_dut_->p_dsp), NEUTON_STATUS_SUCCESS);
+
+        zassert_mem_equal(p_dut_->p_dsp->features.extracted_memory.p_void,
+                          p_ref_->p_dsp->features.extracted_memory.p_void,
+                          features_num * sizeof(neuton_u16_t), "window %u", w);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library and planned scaling of the same window features with the reference model pipeline */
+static void check_planned_scaling_(uint32_t windows_num)
+{
+    neuton_nn_dsp_pipeline_t* p_dsp        = p_ref_->p_dsp;
+    const neuton_u16_t        features_num = p_dsp->features.overall_num;
+    neuton_u16_t              expected[FEATURES_MAX];
+
+    for (uint32_t w = 0; w < windows_num; w++)
+    {
+        next_window_(w);
+
+        const neuton_status_t status = neuton_nn_process_features_dsp_i16_q16(&p_ref_->input, p_dsp);
+        memcpy(expected, p_dsp->features.extracted_memory.p_void, features_num * sizeof(neuton_u16_t));
+
+        zassert_equal(neuton_nn_process_features_dsp_i16_q16_planned(&p_ref_->input, p_dsp), status,
+                      "window %u", w);
+        zassert_mem_equal(p_dsp->features.extracted_memory.p_void, expected, features_num * sizeof(neuton_u16_t),
+                          "window %u", w);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Features scaling with the precomputed reciprocals of the scaling plan */
+ZTEST(neuton_equivalence, test_planned_scaling)
+{
+    zassert_not_null(p_ref_->p_dsp->p_scale_plan);
+    zassert_true(p_ref_->p_dsp->features.overall_num <= FEATURES_MAX);
+
+    neuton_nn_features_scale_reset(p_ref_->p_dsp);
+    check_planned_scaling_(WINDOWS_NUM);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Degenerate scaling ranges: min == max, inverted and narrow ranges, so most features
+ * are saturated, the library scales them without the range check
+ */
+ZTEST(neuton_equivalence, test_planned_scaling_degenerate)
+{
+    neuton_nn_features_meta_i32_t*      p_meta       = &p_ref_->p_dsp->features.meta.i32;
+    const neuton_nn_features_meta_i32_t meta         = *p_meta;
+    const neuton_u16_t                  features_num = p_ref_->p_dsp->features.overall_num;
+    static neuton_i32_t                 min[FEATURES_MAX];
+    static neuton_i32_t                 max[FEATURES_MAX];
+
+    zassert_true(features_num <= FEATURES_MAX);
+
+    for (neuton_u16_t i = 0; i < features_num; i++)
+    {
+        const neuton_i32_t range = meta.p_max[i] - meta.p_min[i];
+
+        min[i] = meta.p_min[i];
+        max[i] = meta.p_max[i];
+
+        if ((i % 4U) == 0)
+        {
+            max[i] = min[i];
+        }
+        else if ((i % 4U) == 1)
+        {
+            min[i] = meta.p_max[i];
+            max[i] = meta.p_min[i];
+        }
+        else if ((i % 4U) == 2)
+        {
+            min[i] += range / 2;
+            max[i] = min[i] + 1;
+        }
+    }
+
+    p_meta->p_min = min;
+    p_meta->p_max = max;
+    neuton_nn_features_scale_reset(p_ref_->p_dsp);
+
+    check_planned_scaling_(WINDOWS_NUM);
+
+    *p_meta = meta;
+    neuton_nn_features_scale_reset(p_ref_->p_dsp);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Index of the largest output neuron */
+static neuton_u16_t predicted_class_(neuton_nn_t* p_nn)
+{
+    const neuton_u16_t* p_neurons = neurons_q16_(p_nn);
+    const neuton_u16_t* p_indices = p_nn->model.meta.p_output_neurons_indices;
+    neuton_u16_t        predicted = 0;
+
+    for (neuton_u16_t i = 1; i < p_nn->model.meta.outputs_num; i++)
+    {
+        if (p_neurons[p_indices[i]] > p_neurons[p_indices[predicted]])
+            predicted = i;
+    }
+
+    return predicted;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fused features scaling with the unscaled features out of the model scaling range:
+ * features are in [min - range, max + range], every few vectors all of them are at the ends,
+ * outputs should be within the quantization error of the library scaling and inference
+ */
+ZTEST(neuton_equivalence, test_fused_scaling_out_of_range)
+{
+    const neuton_nn_features_meta_i32_t* p_meta           = &p_ref_->p_dsp->features.meta.i32;
+    const neuton_u16_t                   features_num     = p_ref_->p_dsp->features.overall_num;
+    neuton_i32_t*                        p_ref_features   = p_ref_->p_dsp->features.extracted_memory.p_i32;
+    neuton_i32_t*                        p_fused_features = p_fused_->p_dsp->features.extracted_memory.p_i32;
+    uint32_t                             delta_max        = 0;
+    uint32_t                             mismatches       = 0;
+
+    neuton_nn_features_scale_reset(p_ref_->p_dsp);
+
+    for (uint32_t v = 0; v < VECTORS_NUM; v++)
+    {
+        for (neuton_u16_t i = 0; i < features_num; i++)
+        {
+            const neuton_i32_t range = p_meta->p_max[i] - p_meta->p_min[i];
+
+            if ((v % 8U) == 0)
+                p_fused_features[i] = p_meta->p_min[i] - range;
+            else if ((v % 8U) == 1)
+                p_fused_features[i] = p_meta->p_max[i] + range;
+            else
+                p_fused_features[i] = p_meta->p_min[i] - range + (neuton_i32_t)(random_next_() % (3U * range + 1U));
+        }
+
+        memcpy(p_ref_features, p_fused_features, features_num * sizeof(neuton_i32_t));
+
+        zassert_equal(neuton_nn_features_scale_q16(p_ref_->p_dsp), NEUTON_STATUS_SUCCESS);
+
+        p_ref_->interfaces.run_inference(p_ref_);
+        p_fused_->interfaces.run_inference(p_fused_);
+
+        for (neuton_u16_t o = 0; o < p_ref_->model.meta.outputs_num; o++)
+        {
+            const neuton_u16_t index = p_ref_->model.meta.p_output_neurons_indices[o];
+            const neuton_i32_t delta = (neuton_i32_t)neurons_q16_(p_fused_)[index] - neurons_q16_(p_ref_)[index];
+
+            delta_max = MAX(delta_max, (uint32_t)abs(delta));
+        }
+
+        if (predicted_class_(p_fused_) != predicted_class_(p_ref_))
+            mismatches++;
+    }
+
+    TC_PRINT("fused scaling: output delta max %u LSB, class mismatches %u of %u\n",
+             delta_max, mismatches, VECTORS_NUM);
+
+    zassert_true(delta_max <= FUSED_DELTA_MAX, "output delta %u", delta_max);
+    zassert_true(mismatches <= FUSED_MISMATCHES_MAX, "class mismatches %u", mismatches);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Accuracy of the 8-bit weights model on the trace, the library q16 model predictions are the reference,
+ * the class probabilities deltas and mismatched classes are reported
+ */
+ZTEST(neuton_equivalence, test_q8w_accuracy)
+{
+    const neuton_u16_t outputs_num = p_ref_->model.output.num;
+    neuton_i16_t       sample[AXES_NUM];
+    uint32_t           windows    = 0;
+    uint32_t           mismatches = 0;
+    float              delta_max  = 0.0f;
+    float              delta_sum  = 0.0f;
+
+    while (windows < WINDOWS_NUM)
+    {
+        trace_sample_(sample);
+
+        const neuton_status_t status = neuton_nn_feed_inputs(p_ref_, sample, AXES_NUM);
+
+        zassert_equal(neuton_nn_feed_inputs(p_q8w_, sample, AXES_NUM), status, "tick %u", trace_.tick);
+
+        if (status != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_equal(neuton_nn_run_inference(p_ref_), NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_nn_run_inference(p_q8w_), NEUTON_STATUS_SUCCESS);
+
+        for (neuton_u16_t o = 0; o < outputs_num; o++)
+        {
+            const float delta = fabsf(p_q8w_->model.output.memory.p_f32[o] - p_ref_->model.output.memory.p_f32[o]);
+
+            delta_max = MAX(delta_max, delta);
+            delta_sum += delta;
+        }
+
+        if (p_q8w_->decoded_output.classif.predicted_class != p_ref_->decoded_output.classif.predicted_class)
+            mismatches++;
+
+        windows++;
+    }
+
+    const float delta_mean = delta_sum / (float)(WINDOWS_NUM * outputs_num);
+
+    TC_PRINT("8-bit weights: probability delta max %.5f mean %.6f, class mismatches %u of %u\n",
+             (double)delta_max, (double)delta_mean, mismatches, WINDOWS_NUM);
+
+    zassert_true(delta_max <= Q8W_DELTA_MAX, "probability delta %f", (double)delta_max);
+    zassert_true(delta_mean <= Q8W_DELTA_MEAN_MAX, "mean probability delta %f", (double)delta_mean);
+    zassert_true(mismatches <= Q8W_MISMATCHES_MAX, "class mismatches %u", mismatches);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Records repacked from the reference model arrays are the shipped packed, 8-bit weights and fused ones */
+ZTEST(neuton_equivalence, test_repacked_records)
+{
+    static neuton_u16_t              records[RECORDS_MAX];
+    const neuton_nn_model_t*         p_model  = &p_ref_->model;
+    const neuton_nn_features_meta_t* p_meta   = &p_ref_->p_dsp->features.meta;
+    const neuton_u32_t               q16_num  = NEUTON_NN_PACKED_Q16_RECORDS_NUM(p_model->meta.neurons_num,
+                                                                                 p_model->meta.weights_num);
+    neuton_u32_t                     used_num = 0;
+
+    zassert_true(NEUTON_NN_PACKED_FUSED_RECORDS_NUM(p_model->meta.neurons_num, p_model->meta.weights_num) <=
+                 RECORDS_MAX);
+
+    zassert_equal(neuton_nn_model_pack_q16(p_model, records, RECORDS_MAX), NEUTON_STATUS_SUCCESS);
+    zassert_equal(p_dut_->model.params.packed_q16.records_num, q16_num);
+    zassert_mem_equal(records, p_dut_->model.params.packed_q16.p_records, q16_num * sizeof(neuton_u16_t));
+
+    zassert_equal(neuton_nn_model_requantize_q8w(p_model, records, RECORDS_MAX, &used_num), NEUTON_STATUS_SUCCESS);
+    zassert_equal(used_num, p_q8w_->model.params.packed_q8w.records_num);
+    zassert_mem_equal(records, p_q8w_->model.params.packed_q8w.p_records, used_num * sizeof(neuton_u16_t));
+
+    zassert_equal(neuton_nn_model_fuse_scaling_q16(p_model, p_meta->i32.p_min, p_meta->i32.p_max,
+                                                   p_ref_->p_dsp->features.overall_num, records, RECORDS_MAX,
+                                                   &used_num),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_equal(used_num, p_fused_->model.params.packed_fused.records_num);
+    zassert_mem_equal(records, p_fused_->model.params.packed_fused.p_records, used_num * sizeof(neuton_u16_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Batch inference of random model input vectors is compared with the inference of each vector,
+ * unscaled features of the fused model are in [min - range, max + range] of the scaling range
+ */
+static void check_batch_inference_(neuton_nn_t* p_nn)
+{
+    static neuton_i32_t inputs[BATCH_NUM * FEATURES_MAX];
+    static neuton_u16_t neurons[BATCH_NUM * NEURONS_MAX];
+    static neuton_f32_t outputs[BATCH_NUM * OUTPUTS_MAX];
+
+    const bool                           is_fused     = p_nn->interfaces.run_inference ==
+                                                        neuton_nn_run_model_inference_packed_fused;
+    const neuton_nn_features_meta_i32_t* p_meta       = &p_nn->p_dsp->features.meta.i32;
+    const neuton_u16_t                   features_num = p_nn->p_dsp->features.overall_num;
+    const neuton_u16_t                   neurons_num  = p_nn->model.meta.neurons_num;
+    const neuton_u16_t                   outputs_num  = p_nn->model.output.num;
+    const neuton_sz_t                    input_size   = is_fused ? sizeof(neuton_i32_t) : sizeof(neuton_u16_t);
+
+    zassert_true(features_num <= FEATURES_MAX);
+    zassert_true(neurons_num <= NEURONS_MAX);
+    zassert_true(outputs_num <= OUTPUTS_MAX);
+    zassert_equal(p_nn->interfaces.propagate_outputs, neuton_nn_output_dequantize_q16_f32);
+
+    for (neuton_u32_t i = 0; i < BATCH_NUM * features_num; i++)
+    {
+        const neuton_u16_t f = i % features_num;
+
+        if (is_fused)
+        {
+            const neuton_i32_t range = p_meta->p_max[f] - p_meta->p_min[f];
+
+            inputs[i] = p_meta->p_min[f] - range + (neuton_i32_t)(random_next_() % (3U * range + 1U));
+        }
+        else
+        {
+            ((neuton_u16_t*)inputs)[i] = (neuton_u16_t)random_next_();
+        }
+    }
+
+    zassert_equal(neuton_nn_run_inference_batch(p_nn, inputs, BATCH_NUM, neurons, outputs), NEUTON_STATUS_SUCCESS);
+
+    for (neuton_u16_t v = 0; v < BATCH_NUM; v++)
+    {
+        const neuton_u8_t* p_input = (const neuton_u8_t*)inputs + v * features_num * input_size;
+
+        memcpy(p_nn->p_dsp->features.extracted_memory.p_void, p_input, features_num * input_size);
+
+        p_nn->interfaces.run_inference(p_nn);
+        p_nn->interfaces.propagate_outputs(&p_nn->model);
+
+        zassert_mem_equal(&neurons[v * neurons_num], neurons_q16_(p_nn), neurons_num * sizeof(neuton_u16_t),
+                          "neurons of vector %u", v);
+        zassert_mem_equal(&outputs[v * outputs_num], p_nn->model.output.memory.p_f32,
+                          outputs_num * sizeof(neuton_f32_t), "outputs of vector %u", v);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Batch inference of the packed, 8-bit weights and fused models is bit-exact with the single vector one */
+ZTEST(neuton_equivalence, test_batch_inference)
+{
+    check_batch_inference_(p_dut_);
+    check_batch_inference_(p_q8w_);
+    check_batch_inference_(p_fused_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_equivalence, NULL, setup_, before_, NULL, NULL);
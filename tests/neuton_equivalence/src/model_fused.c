@@ -0,0 +1,10 @@
+/*
+ * The shipped user model with the extracted features scaling fused into the packed neuron records
+ */
+#define MODEL_PACKED_LAYOUT            1
+#define MODEL_PACKED_FUSED_SCALING     1
+
+#define neuton_nn_user_model           fused_user_model
+#define neuton_nn_user_model_size      fused_user_model_size
+
+#include "neuton_user_model.c"
@@ -0,0 +1,10 @@
+/*
+ * The shipped user model with the 8-bit per-neuron scaled weights in the packed neuron records
+ */
+#define MODEL_PACKED_LAYOUT            1
+#define MODEL_PACKED_WEIGHTS_Q8        1
+
+#define neuton_nn_user_model           q8w_user_model
+#define neuton_nn_user_model_size      q8w_user_model_size
+
+#include "neuton_user_model.c"
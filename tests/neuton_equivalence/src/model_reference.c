@@ -0,0 +1,17 @@
+/*
+ * The shipped user model with the prebuilt library defaults,
+ * as it was generated before the packed layout and the segment aggregates
+ */
+#define MODEL_PACKED_LAYOUT            0
+#define MODEL_PACKED_WEIGHTS_Q8        0
+#define MODEL_PACKED_FUSED_SCALING     0
+#define MODEL_SEGMENT_STATS            0
+
+#define NN_INPUT_FEED_INTERFACE        neuton_nn_input_feed_sliding_window_i16
+#define NN_PROCESS_FEATURES_INTERFACE  neuton_nn_process_features_dsp_i16_q16
+#define NN_RUN_INFERENCE_INTERFACE     neuton_nn_run_model_inference_q16
+
+#define neuton_nn_user_model           reference_user_model
+#define neuton_nn_user_model_size      reference_user_model_size
+
+#include "neuton_user_model.c"
@@ -0,0 +1,19 @@
+/*
+ * The shipped user model built with other layout switches and interfaces,
+ * see the model_*.c translation units
+ */
+#ifndef _NEUTON_EQUIVALENCE_MODELS_H_
+#define _NEUTON_EQUIVALENCE_MODELS_H_
+
+#include <neuton/nn/neuton_nn_types.h>
+
+/** Model with the prebuilt library defaults: separate arrays, library feed, features and inference */
+neuton_nn_t* reference_user_model(void);
+
+/** Model with the features scaling fused into the packed neuron records, extracted features are not scaled */
+neuton_nn_t* fused_user_model(void);
+
+/** Model with the 8-bit per-neuron scaled weights, requantized from the 16-bit weights */
+neuton_nn_t* q8w_user_model(void);
+
+#endif /* _NEUTON_EQUIVALENCE_MODELS_H_ */
@@ -0,0 +1,97 @@
+/*
+ * Activation functions test: the lookup table sigmoid of the packed models inference is compared
+ * with the library arithmetic sigmoid on dense and random arguments, and both are benchmarked.
+ */
+#include "test_bench.h"
+#include "test_random.h"
+
+#include <neuton/nn/private/inference/neuton_nn_activations.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define RANDOM_ARGS_NUM     (20000U)
+#define BENCH_ARGS_NUM      (256U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t     random_;
+static neuton_u16_t bench_coeff_[BENCH_ARGS_NUM];
+static neuton_i64_t bench_summ_[BENCH_ARGS_NUM];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Weighted sum with a random magnitude up to the range of the 16-bit quantized neuron links */
+static neuton_i64_t random_summ_(void)
+{
+    const neuton_i64_t summ = test_random_range(&random_, -(1 << 23), 1 << 23);
+
+    return summ * (neuton_i64_t)(1U << (test_random_next(&random_) % 10U));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_activations, test_sigmoid_lut_q16_vs_library)
+{
+    static const neuton_u16_t COEFFS[] = { 0, 1, 255, 4096, 32768, 65535 };
+
+    /* Dense sweep over the integer points and their neighbours of the sigmoid argument */
+    for (size_t c = 0; c < ARRAY_SIZE(COEFFS); c++)
+    {
+        for (neuton_i64_t summ = -(1 << 16); summ <= (1 << 16); summ += 7)
+        {
+            zassert_equal(neuton_nn_sigmoid_lut_q16(COEFFS[c], summ), neuton_nn_sigmoid_q16(COEFFS[c], summ),
+                          "coeff %u summ %d", COEFFS[c], (int)summ);
+        }
+    }
+
+    for (uint32_t i = 0; i < RANDOM_ARGS_NUM; i++)
+    {
+        const neuton_u16_t coeff = (neuton_u16_t)test_random_next(&random_);
+        const neuton_i64_t summ  = random_summ_();
+
+        zassert_equal(neuton_nn_sigmoid_lut_q16(coeff, summ), neuton_nn_sigmoid_q16(coeff, summ),
+                      "coeff %u summ %lld", coeff, (long long)summ);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_activations, test_benchmark)
+{
+    volatile neuton_u32_t sink = 0;
+    uint32_t              arithmetic;
+    uint32_t              lut;
+
+    for (uint32_t i = 0; i < BENCH_ARGS_NUM; i++)
+    {
+        bench_coeff_[i] = (neuton_u16_t)test_random_next(&random_);
+        bench_summ_[i]  = random_summ_();
+    }
+
+    TEST_BENCH_CYCLES(arithmetic, {
+        for (uint32_t i = 0; i < BENCH_ARGS_NUM; i++)
+            sink += neuton_nn_sigmoid_q16(bench_coeff_[i], bench_summ_[i]);
+    });
+
+    TEST_BENCH_CYCLES(lut, {
+        for (uint32_t i = 0; i < BENCH_ARGS_NUM; i++)
+            sink += neuton_nn_sigmoid_lut_q16(bench_coeff_[i], bench_summ_[i]);
+    });
+
+    test_bench_print("sigmoid q16 of 256 arguments", arithmetic, lut);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_activations, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,38 @@
+/*
+ * Cycle measurement of the benchmark cases, the results are printed and not asserted,
+ * the cycle counter of the emulated target only shows the relative cost of the compared paths
+ */
+#ifndef _NEUTON_EQUIVALENCE_TEST_BENCH_H_
+#define _NEUTON_EQUIVALENCE_TEST_BENCH_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/** Number of the measured runs, the fastest one is taken */
+#define TEST_BENCH_ROUNDS   (8U)
+
+/** Cycles of the fastest of TEST_BENCH_ROUNDS runs of the statement to cycles */
+#define TEST_BENCH_CYCLES(cycles, statement)                              \
+    do                                                                    \
+    {                                                                     \
+        uint32_t best_ = UINT32_MAX;                                      \
+        for (uint32_t round_ = 0; round_ < TEST_BENCH_ROUNDS; round_++)   \
+        {                                                                 \
+            const uint32_t start_ = k_cycle_get_32();                     \
+            statement;                                                    \
+            best_ = MIN(best_, k_cycle_get_32() - start_);                \
+        }                                                                 \
+        (cycles) = best_;                                                 \
+    } while (0)
+
+/** Print the cycles of the baseline and the compared path with the speedup ratio */
+static inline void test_bench_print(const char* p_name, uint32_t baseline, uint32_t cycles)
+{
+    const uint32_t ratio_x100 = (uint32_t)((uint64_t)baseline * 100U / MAX(cycles, 1U));
+
+    TC_PRINT("%s: %u -> %u cycles, x%u.%02u\n", p_name, baseline, cycles, ratio_x100 / 100U, ratio_x100 % 100U);
+}
+
+#endif /* _NEUTON_EQUIVALENCE_TEST_BENCH_H_ */
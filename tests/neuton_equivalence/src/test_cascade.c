@@ -0,0 +1,228 @@
+/*
+ * Cascaded inference test: the 8-bit weights model gates the shipped model on a replayed trace,
+ * the windows passed by the gate should have the outputs of the standalone reference model,
+ * the rejected ones the reject class, and the cycles of the cascade and the standalone model are reported.
+ */
+#include "models.h"
+#include "test_bench.h"
+#include "test_random.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_cascade.h>
+#include <neuton_user_model.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_NUM            (6U)
+#define WINDOWS_NUM         (100U)
+#define PASS_CLASS          (0U)
+#define REJECT_CLASS        (1U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_t*        p_ref_;
+static neuton_nn_cascade_t cascade_;
+static void*               p_gate_window_;
+static uint32_t            random_;
+static uint32_t            tick_;
+static float               freq_[AXES_NUM];
+static float               amplitude_[AXES_NUM];
+
+/** Cycles of the standalone reference model and of the cascade over the replayed trace */
+static uint32_t ref_cycles_;
+static uint32_t cascade_cycles_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Sine of the random frequency and amplitude on each axis, changed every 50 samples, mostly small as idle */
+static void trace_sample_(neuton_i16_t* p_sample)
+{
+    if ((tick_ % 50U) == 0)
+    {
+        const bool is_idle = (test_random_next(&random_) % 4U) != 0;
+
+        for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+        {
+            freq_[axis]      = 0.2f + 8.0f * test_random_unit(&random_);
+            amplitude_[axis] = (is_idle ? 500.0f : 20000.0f) * test_random_unit(&random_);
+        }
+    }
+
+    for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        const float t = (float)tick_ / 100.0f;
+
+        p_sample[axis] = (neuton_i16_t)(amplitude_[axis] * sinf(2.0f * 3.14159265f * freq_[axis] * t + (float)axis));
+    }
+
+    tick_++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Replays the trace through the cascade and the standalone reference model, which is bit-exact with
+ * the main model of the cascade, the windows passed by the gate are checked against the reference
+ */
+static void replay_(void)
+{
+    const neuton_u16_t outputs_num = p_ref_->model.output.num;
+    neuton_i16_t       sample[AXES_NUM];
+    uint32_t           windows = 0;
+
+    ref_cycles_     = 0;
+    cascade_cycles_ = 0;
+
+    while (windows < WINDOWS_NUM)
+    {
+        trace_sample_(sample);
+
+        const neuton_status_t status = neuton_nn_feed_inputs(p_ref_, sample, AXES_NUM);
+
+        zassert_equal(neuton_nn_cascade_feed_inputs(&cascade_, sample, AXES_NUM), status, "tick %u", tick_);
+
+        if (status != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        const uint32_t main_runs_num = cascade_.stats.main_runs_num;
+        uint32_t       start         = k_cycle_get_32();
+
+        zassert_equal(neuton_nn_run_inference(p_ref_), NEUTON_STATUS_SUCCESS);
+        ref_cycles_ += k_cycle_get_32() - start;
+
+        start = k_cycle_get_32();
+        zassert_equal(neuton_nn_cascade_run_inference(&cascade_), NEUTON_STATUS_SUCCESS);
+        cascade_cycles_ += k_cycle_get_32() - start;
+
+        const neuton_f32_t pass_probability =
+            cascade_.p_gate->decoded_output.classif.probabilities.p_f32[cascade_.pass_class];
+        const neuton_f32_t* p_outputs = cascade_.p_main->decoded_output.classif.probabilities.p_f32;
+
+        if (pass_probability >= cascade_.pass_threshold)
+        {
+            zassert_equal(cascade_.stats.main_runs_num, main_runs_num + 1, "window %u", windows);
+            zassert_equal(cascade_.p_main->decoded_output.classif.predicted_class,
+                          p_ref_->decoded_output.classif.predicted_class, "window %u", windows);
+            zassert_mem_equal(p_outputs, p_ref_->model.output.memory.p_f32, outputs_num * sizeof(neuton_f32_t),
+                              "window %u", windows);
+        }
+        else
+        {
+            zassert_equal(cascade_.stats.main_runs_num, main_runs_num, "window %u", windows);
+            zassert_equal(cascade_.p_main->decoded_output.classif.predicted_class, REJECT_CLASS, "window %u",
+                          windows);
+
+            for (neuton_u16_t o = 0; o < outputs_num; o++)
+            {
+                zassert_equal(p_outputs[o], (o == REJECT_CLASS) ? 1.0f - pass_probability : 0.0f,
+                              "output %u of window %u", o, windows);
+            }
+        }
+
+        windows++;
+    }
+
+    zassert_equal(cascade_.stats.windows_num, WINDOWS_NUM);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void setup_cascade_(neuton_f32_t pass_threshold)
+{
+    cascade_.pass_threshold = pass_threshold;
+    zassert_equal(neuton_nn_cascade_setup(&cascade_), NEUTON_STATUS_SUCCESS);
+    zassert_equal(cascade_.p_gate->input.window_memory.p_void, cascade_.p_main->input.window_memory.p_void);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    tick_   = 0;
+    p_ref_  = reference_user_model();
+
+    memset(&cascade_, 0, sizeof(cascade_));
+    cascade_.p_gate       = q8w_user_model();
+    cascade_.p_main       = neuton_nn_user_model();
+    cascade_.pass_class   = PASS_CLASS;
+    cascade_.reject_class = REJECT_CLASS;
+
+    p_gate_window_ = cascade_.p_gate->input.window_memory.p_void;
+
+    zassert_equal(neuton_nn_setup(p_ref_), NEUTON_STATUS_SUCCESS);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Gate model window is given back, the models are shared with the other suites */
+static void after_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    cascade_.p_gate->input.window_memory.p_void = p_gate_window_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_cascade, test_setup_invalid_arguments)
+{
+    zassert_equal(neuton_nn_cascade_setup(NULL), NEUTON_STATUS_NULL_ARGUMENT);
+
+    cascade_.pass_class = cascade_.p_gate->model.meta.outputs_num;
+    zassert_equal(neuton_nn_cascade_setup(&cascade_), NEUTON_STATUS_INVALID_ARGUMENT);
+
+    cascade_.pass_class   = PASS_CLASS;
+    cascade_.reject_class = cascade_.p_main->model.meta.outputs_num;
+    zassert_equal(neuton_nn_cascade_setup(&cascade_), NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_equal(cascade_.p_gate->input.window_memory.p_void, p_gate_window_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Zero threshold passes every window, the cascade is the main model with the gate overhead */
+ZTEST(neuton_nn_cascade, test_pass_all)
+{
+    setup_cascade_(0.0f);
+    replay_();
+
+    zassert_equal(cascade_.stats.main_runs_num, WINDOWS_NUM);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Threshold above any probability rejects every window, the main model is not evaluated */
+ZTEST(neuton_nn_cascade, test_reject_all)
+{
+    setup_cascade_(2.0f);
+    replay_();
+
+    zassert_equal(cascade_.stats.main_runs_num, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Windows are passed by the gate probability, the cycles are printed and not asserted: the gate here
+ * is as large as the main model, so the cycles only show the overhead of the cascade on the gated share
+ */
+ZTEST(neuton_nn_cascade, test_gated_cycles)
+{
+    setup_cascade_(0.5f);
+    replay_();
+
+    TC_PRINT("cascade: main model runs %u of %u windows\n", cascade_.stats.main_runs_num,
+             cascade_.stats.windows_num);
+    test_bench_print("standalone vs cascade inference of 100 windows", ref_cycles_, cascade_cycles_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_cascade, NULL, NULL, before_, after_, NULL);
@@ -0,0 +1,205 @@
+/*
+ * Per-channel clipping test: the interleaved INT8, INT16 and floating-point clipping, whole buffers and
+ * streams split into blocks at random positions of the frame, is compared with the scalar clipping
+ * of each sample to the limits of its channel.
+ */
+#include "test_random.h"
+
+#include <neuton/dsp/support/neuton_dsp_clipping.h>
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CHANNELS_MAX        (7U)
+#define NUM_MAX             (CHANNELS_MAX * 40U)
+#define BLOCK_MAX           (17U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_u16_t CHANNELS_[] = { 1, 2, 3, 6, CHANNELS_MAX };
+static const neuton_u16_t FRAMES_[]   = { 1, 2, 5, 40 };
+
+static uint32_t     random_;
+static neuton_i8_t  min_i8_[CHANNELS_MAX];
+static neuton_i8_t  max_i8_[CHANNELS_MAX];
+static neuton_i16_t min_i16_[CHANNELS_MAX + 1U];
+static neuton_i16_t max_i16_[CHANNELS_MAX + 1U];
+static neuton_f32_t min_f32_[CHANNELS_MAX];
+static neuton_f32_t max_f32_[CHANNELS_MAX];
+static neuton_i8_t  input_i8_[NUM_MAX];
+static neuton_i8_t  output_i8_[NUM_MAX];
+static neuton_i16_t input_i16_[NUM_MAX + 1U];
+static neuton_i16_t output_i16_[NUM_MAX + 1U];
+static neuton_f32_t input_f32_[NUM_MAX];
+static neuton_f32_t output_f32_[NUM_MAX];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random limits of each channel, some of them are the full range or a single value */
+static void fill_limits_(neuton_u16_t channels, neuton_i16_t* p_min_i16, neuton_i16_t* p_max_i16)
+{
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+    {
+        neuton_i32_t a = test_random_range(&random_, -32768, 32767);
+        neuton_i32_t b = test_random_range(&random_, -32768, 32767);
+
+        if (ch == 1)
+        {
+            b = a;
+        }
+        else if (ch == 2)
+        {
+            a = -32768;
+            b = 32767;
+        }
+
+        p_min_i16[ch] = (neuton_i16_t)((a < b) ? a : b);
+        p_max_i16[ch] = (neuton_i16_t)((a < b) ? b : a);
+
+        min_i8_[ch]  = (neuton_i8_t)(p_min_i16[ch] >> 8);
+        max_i8_[ch]  = (neuton_i8_t)(p_max_i16[ch] >> 8);
+        min_f32_[ch] = (neuton_f32_t)p_min_i16[ch] / 32768.0f;
+        max_f32_[ch] = (neuton_f32_t)p_max_i16[ch] / 32768.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void fill_input_(neuton_u16_t num, neuton_i16_t* p_input_i16)
+{
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        p_input_i16[i] = (neuton_i16_t)test_random_range(&random_, -32768, 32767);
+        input_i8_[i]   = (neuton_i8_t)(p_input_i16[i] >> 8);
+        input_f32_[i]  = (neuton_f32_t)p_input_i16[i] / 32768.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Scalar clipping of each sample to the limits of its channel */
+static void check_clipped_(neuton_u16_t num, neuton_u16_t channels, const neuton_i16_t* p_input_i16,
+                           const neuton_i16_t* p_output_i16, const neuton_i16_t* p_min_i16,
+                           const neuton_i16_t* p_max_i16)
+{
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const neuton_u16_t ch = i % channels;
+
+        zassert_equal(p_output_i16[i], neuton_dsp_clip(p_input_i16[i], p_min_i16[ch], p_max_i16[ch]),
+                      "i16 channels %u, sample %u", channels, i);
+        zassert_equal(output_i8_[i], neuton_dsp_clip(input_i8_[i], min_i8_[ch], max_i8_[ch]),
+                      "i8 channels %u, sample %u", channels, i);
+        zassert_equal(output_f32_[i], neuton_dsp_clip(input_f32_[i], min_f32_[ch], max_f32_[ch]),
+                      "f32 channels %u, sample %u", channels, i);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Whole buffers of each layout are clipped, INT16 samples and limits are also taken
+ * at the odd halfword, so the dual halfword words are not word aligned
+ */
+static void check_buffers_(neuton_u16_t offset)
+{
+    neuton_i16_t* p_input_i16  = &input_i16_[offset];
+    neuton_i16_t* p_output_i16 = &output_i16_[offset];
+    neuton_i16_t* p_min_i16    = &min_i16_[offset];
+    neuton_i16_t* p_max_i16    = &max_i16_[offset];
+
+    for (size_t c = 0; c < ARRAY_SIZE(CHANNELS_); c++)
+    {
+        for (size_t f = 0; f < ARRAY_SIZE(FRAMES_); f++)
+        {
+            const neuton_u16_t channels = CHANNELS_[c];
+            const neuton_u16_t num      = channels * FRAMES_[f];
+
+            fill_limits_(channels, p_min_i16, p_max_i16);
+            fill_input_(num, p_input_i16);
+
+            memcpy(p_output_i16, p_input_i16, num * sizeof(neuton_i16_t));
+            memcpy(output_i8_, input_i8_, num * sizeof(neuton_i8_t));
+            memcpy(output_f32_, input_f32_, num * sizeof(neuton_f32_t));
+
+            neuton_dsp_clip_channels_i16(p_output_i16, num, p_min_i16, p_max_i16, channels);
+            neuton_dsp_clip_channels_i8(output_i8_, num, min_i8_, max_i8_, channels);
+            neuton_dsp_clip_channels_f32(output_f32_, num, min_f32_, max_f32_, channels);
+
+            check_clipped_(num, channels, p_input_i16, p_output_i16, p_min_i16, p_max_i16);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_clip_channels, test_vs_scalar)
+{
+    check_buffers_(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_clip_channels, test_unaligned_vs_scalar)
+{
+    check_buffers_(1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Stream is clipped by blocks of 1 to BLOCK_MAX samples, that start and end in the middle of the frame */
+ZTEST(neuton_dsp_clip_channels, test_stream_vs_scalar)
+{
+    for (size_t c = 0; c < ARRAY_SIZE(CHANNELS_); c++)
+    {
+        const neuton_u16_t channels = CHANNELS_[c];
+        const neuton_u16_t num      = NUM_MAX - (NUM_MAX % channels) - 1U;
+        neuton_u16_t       channel  = 0;
+        neuton_u16_t       position = 0;
+
+        fill_limits_(channels, min_i16_, max_i16_);
+        fill_input_(num, input_i16_);
+
+        memcpy(output_i16_, input_i16_, num * sizeof(neuton_i16_t));
+        memcpy(output_i8_, input_i8_, num * sizeof(neuton_i8_t));
+        memcpy(output_f32_, input_f32_, num * sizeof(neuton_f32_t));
+
+        while (position < num)
+        {
+            neuton_u16_t block = (neuton_u16_t)test_random_range(&random_, 1, BLOCK_MAX);
+
+            if (block > num - position)
+                block = num - position;
+
+            const neuton_u16_t next = neuton_dsp_clip_channels_stream_i16(&output_i16_[position], block, min_i16_,
+                                                                          max_i16_, channels, channel);
+
+            zassert_equal(next, (position + block) % channels, "channels %u, position %u", channels, position);
+            zassert_equal(neuton_dsp_clip_channels_stream_i8(&output_i8_[position], block, min_i8_, max_i8_,
+                                                             channels, channel), next);
+            zassert_equal(neuton_dsp_clip_channels_stream_f32(&output_f32_[position], block, min_f32_, max_f32_,
+                                                              channels, channel), next);
+
+            channel = next;
+            position += block;
+        }
+
+        check_clipped_(num, channels, input_i16_, output_i16_, min_i16_, max_i16_);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_clip_channels, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,177 @@
+/*
+ * Float24 vector kernels test: the results are compared with the float arithmetic on the same values,
+ * the inputs span a wide dynamic range so the block floating point accumulator realigns often.
+ */
+#include "test_random.h"
+
+#include <neuton/dsp/support/neuton_f24_vector.h>
+
+#include <math.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define VECTOR_LEN          (256U)
+#define ROUNDS_NUM          (20U)
+
+/** Relative error of the 16-bit mantissa truncation */
+#define MANTISSA_EPS        (1.0f / 32768.0f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t     random_;
+static neuton_i16_t input_[VECTOR_LEN];
+static neuton_u16_t x_man_[VECTOR_LEN];
+static neuton_u8_t  x_exps_[VECTOR_LEN];
+static neuton_u16_t y_man_[VECTOR_LEN];
+static neuton_u8_t  y_exps_[VECTOR_LEN];
+static float        x_[VECTOR_LEN];
+static float        y_[VECTOR_LEN];
+
+static const neuton_f24_vec_t x_vec_ = { .p_man = x_man_, .p_exps = x_exps_ };
+static const neuton_f24_vec_t y_vec_ = { .p_man = y_man_, .p_exps = y_exps_ };
+
+//////////////////////////////////////////////////////////////////////////////
+
+static float to_float_(neuton_u16_t man, neuton_u8_t exps)
+{
+    const neuton_f24_t x     = { .man = man, .exps = exps };
+    const float        value = ldexpf((float)man, neuton_f24_get_exp(x));
+
+    return (exps & NEUTON_F24_SIGNED) ? -value : value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random i16 samples with random magnitudes from a few LSB to the full scale */
+static void fill_input_(void)
+{
+    for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+        input_[i] = (neuton_i16_t)(test_random_range(&random_, INT16_MIN, INT16_MAX) >>
+                                   (test_random_next(&random_) % 15U));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random vector with not normalized mantissas and exponents in [-20, 20], values are kept in p_values */
+static void fill_vector_(const neuton_f24_vec_t* p_vec, float* p_values)
+{
+    for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+    {
+        const neuton_i32_t exp  = test_random_range(&random_, -20, 20);
+        const neuton_u8_t  sign = (test_random_next(&random_) & 1U) ? NEUTON_F24_SIGNED : NEUTON_F24_UNSIGNED;
+
+        p_vec->p_man[i]  = (neuton_u16_t)(test_random_next(&random_) >> (8U + test_random_next(&random_) % 16U));
+        p_vec->p_exps[i] = (neuton_u8_t)(((exp < 0) ? (0x80U | (neuton_u32_t)-exp) : (neuton_u32_t)exp) | sign);
+        p_values[i]      = to_float_(p_vec->p_man[i], p_vec->p_exps[i]);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Result should be within the mantissa truncation of the terms magnitude sum */
+static void check_sum_(neuton_f24_t result, double expected, double magnitude)
+{
+    const double value = (double)to_float_(result.man, result.exps);
+
+    zassert_true(fabs(value - expected) <= 2.0 * MANTISSA_EPS * magnitude, "%f != %f", value, expected);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_f24_vector, test_from_i16_and_normalize)
+{
+    for (uint32_t r = 0; r < ROUNDS_NUM; r++)
+    {
+        fill_input_();
+        neuton_f24_vec_from_i16(input_, VECTOR_LEN, &x_vec_);
+
+        for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+        {
+            zassert_equal(to_float_(x_man_[i], x_exps_[i]), (float)input_[i], "sample %u", i);
+            zassert_true((input_[i] == 0) || (x_man_[i] & 0x8000U), "sample %u isn't left aligned", i);
+        }
+
+        fill_vector_(&x_vec_, x_);
+        neuton_f24_vec_normalize(&x_vec_, VECTOR_LEN);
+
+        for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+        {
+            zassert_equal(to_float_(x_man_[i], x_exps_[i]), x_[i], "value %u", i);
+            zassert_true((x_[i] == 0.0f) || (x_man_[i] & 0x8000U), "value %u isn't left aligned", i);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_f24_vector, test_scale)
+{
+    for (uint32_t r = 0; r < ROUNDS_NUM; r++)
+    {
+        const neuton_f24_t scale = {
+            .man  = (neuton_u16_t)test_random_next(&random_),
+            .exps = (neuton_u8_t)(0x80U | (test_random_next(&random_) % 16U) |
+                                  ((r & 1U) ? NEUTON_F24_SIGNED : NEUTON_F24_UNSIGNED)),
+        };
+        const float scale_value = to_float_(scale.man, scale.exps);
+
+        fill_vector_(&x_vec_, x_);
+        neuton_f24_vec_scale(&x_vec_, VECTOR_LEN, scale, &y_vec_);
+
+        for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+        {
+            const float expected = x_[i] * scale_value;
+
+            zassert_true(fabsf(to_float_(y_man_[i], y_exps_[i]) - expected) <= MANTISSA_EPS * fabsf(expected),
+                         "value %u", i);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_f24_vector, test_sum_sum_sq_dot)
+{
+    for (uint32_t r = 0; r < ROUNDS_NUM; r++)
+    {
+        double sum     = 0.0;
+        double sum_abs = 0.0;
+        double sum_sq  = 0.0;
+        double dot     = 0.0;
+        double dot_abs = 0.0;
+
+        /* Sums keep the precision relative to the largest term exponent, so the terms are normalized first */
+        fill_vector_(&x_vec_, x_);
+        fill_vector_(&y_vec_, y_);
+        neuton_f24_vec_normalize(&x_vec_, VECTOR_LEN);
+        neuton_f24_vec_normalize(&y_vec_, VECTOR_LEN);
+
+        for (neuton_u16_t i = 0; i < VECTOR_LEN; i++)
+        {
+            sum += (double)x_[i];
+            sum_abs += fabs((double)x_[i]);
+            sum_sq += (double)x_[i] * x_[i];
+            dot += (double)x_[i] * y_[i];
+            dot_abs += fabs((double)x_[i] * y_[i]);
+        }
+
+        check_sum_(neuton_f24_vec_sum(&x_vec_, VECTOR_LEN), sum, sum_abs);
+        check_sum_(neuton_f24_vec_sum_sq(&x_vec_, VECTOR_LEN), sum_sq, sum_sq);
+        check_sum_(neuton_f24_vec_dot(&x_vec_, &y_vec_, VECTOR_LEN), dot, dot_abs);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_f24_vector, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,354 @@
+/*
+ * Block floating point FFT test: the spectrum scaled by 2^exponent is compared with the reference DFT
+ * of the same input, small, full-scale and single tone inputs are checked for all the lengths.
+ * Windowed real FFT of each window type should be the same as the window applied before the real FFT.
+ */
+#include "test_random.h"
+
+#include <neuton/common/neuton_platform.h>
+#include <neuton/dsp/support/neuton_dsp_windowing.h>
+#include <neuton/dsp/transform/fft/neuton_dsp_fft_const_tables_f32.h>
+#include <neuton/dsp/transform/fft/neuton_dsp_fft_const_tables_i16.h>
+#include <neuton/dsp/transform/fft/neuton_dsp_fft_f32.h>
+#include <neuton/dsp/transform/fft/neuton_dsp_fft_i16.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define LEN_MIN             (16U)
+#define LEN_MAX             (1024U)
+#define PI                  (3.14159265358979f)
+#define WINDOWED_LEN        (512U)
+#define TUKEY_FRACTION      (0.5f)
+
+/** Signal to error ratio of the spectrum, dB */
+#define SNR_MIN_DB          (50.0f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    INPUT_SMALL,
+    INPUT_FULL_SCALE,
+    INPUT_TONE,
+    INPUT_KINDS_NUM
+} input_kind_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t     random_;
+static neuton_i16_t twiddle_cfft_[3U * LEN_MAX];
+static neuton_i16_t twiddle_rfft_[LEN_MAX];
+static neuton_i16_t buffer_[2U * LEN_MAX] __NEUTON_ALIGNED;
+static float        input_[2U * LEN_MAX];
+static float        spectrum_[2U * LEN_MAX];
+static float        cos_[LEN_MAX];
+static float        sin_[LEN_MAX];
+static neuton_i16_t windowed_[LEN_MAX] __NEUTON_ALIGNED;
+static neuton_i16_t window_q15_[NEUTON_DSP_WINDOW_COEFFS_NUM(LEN_MAX)];
+static neuton_f32_t window_f32_[NEUTON_DSP_WINDOW_COEFFS_NUM(LEN_MAX)];
+static neuton_f32_t output_f32_[LEN_MAX];
+static neuton_f32_t windowed_f32_[LEN_MAX];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random or single tone samples, input_ is the same samples in float */
+static void fill_input_(input_kind_t kind, neuton_u32_t num)
+{
+    const neuton_u32_t bin = 1U + test_random_next(&random_) % (num / 2U - 1U);
+
+    for (neuton_u32_t i = 0; i < num; i++)
+    {
+        neuton_i32_t value;
+
+        if (kind == INPUT_SMALL)
+            value = test_random_range(&random_, -64, 64);
+        else if (kind == INPUT_FULL_SCALE)
+            value = test_random_range(&random_, INT16_MIN, INT16_MAX);
+        else
+            value = (neuton_i32_t)(20000.0f * cosf(2.0f * PI * (float)(bin * i) / (float)num));
+
+        buffer_[i] = (neuton_i16_t)value;
+        input_[i]  = (float)value;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Reference DFT of the len complex or real input_ samples to spectrum_, interleaved */
+static void dft_(neuton_u32_t len, bool is_complex)
+{
+    for (neuton_u32_t n = 0; n < len; n++)
+    {
+        cos_[n] = cosf(2.0f * PI * (float)n / (float)len);
+        sin_[n] = sinf(2.0f * PI * (float)n / (float)len);
+    }
+
+    for (neuton_u32_t k = 0; k < len; k++)
+    {
+        float re = 0.0f;
+        float im = 0.0f;
+
+        for (neuton_u32_t n = 0; n < len; n++)
+        {
+            const neuton_u32_t m  = (k * n) % len;
+            const float        xr = is_complex ? input_[2 * n] : input_[n];
+            const float        xi = is_complex ? input_[2 * n + 1] : 0.0f;
+
+            re += xr * cos_[m] + xi * sin_[m];
+            im += xi * cos_[m] - xr * sin_[m];
+        }
+
+        spectrum_[2 * k]     = re;
+        spectrum_[2 * k + 1] = im;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Signal to error ratio of bins_num bins of buffer_ scaled by 2^exponent to the reference spectrum_ */
+static float snr_db_(neuton_u32_t bins_num, neuton_i8_t exponent, bool is_rfft)
+{
+    const float scale  = ldexpf(1.0f, exponent);
+    float       signal = 0.0f;
+    float       error  = 0.0f;
+
+    for (neuton_u32_t k = 0; k < bins_num; k++)
+    {
+        float re = (float)buffer_[2 * k] * scale;
+        float im = (float)buffer_[2 * k + 1] * scale;
+
+        /* Real FFT packs the Nyquist real part in place of the zero DC imaginary part */
+        if (is_rfft && (k == 0))
+            im = 0.0f;
+
+        signal += spectrum_[2 * k] * spectrum_[2 * k] + spectrum_[2 * k + 1] * spectrum_[2 * k + 1];
+        error += (re - spectrum_[2 * k]) * (re - spectrum_[2 * k]) +
+                 (im - spectrum_[2 * k + 1]) * (im - spectrum_[2 * k + 1]);
+    }
+
+    if (is_rfft)
+    {
+        const float re  = (float)buffer_[1] * scale;
+        const float ref = spectrum_[bins_num * 2];
+
+        signal += ref * ref;
+        error += (re - ref) * (re - ref);
+    }
+
+    return 10.0f * log10f(signal / MAX(error, 1e-12f));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_fft, test_cfft_bfp_vs_dft)
+{
+    for (neuton_u16_t len = LEN_MIN; len <= LEN_MAX; len <<= 2)
+    {
+        neuton_dsp_cfft_i16_t cfft = { .len = len, .p_twiddle = twiddle_cfft_ };
+
+        neuton_dsp_cfft_twiddle_factors_i16(twiddle_cfft_, len);
+
+        for (input_kind_t kind = INPUT_SMALL; kind < INPUT_KINDS_NUM; kind++)
+        {
+            neuton_i8_t exponent;
+
+            fill_input_(kind, 2U * len);
+            dft_(len, true);
+
+            zassert_equal(neuton_dsp_cfft_bfp_i16(&cfft, buffer_, &exponent), NEUTON_STATUS_SUCCESS);
+
+            const float snr = snr_db_(len, exponent, false);
+
+            zassert_true(snr >= SNR_MIN_DB, "len %u input %d exponent %d snr %f", len, kind, exponent,
+                         (double)snr);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_fft, test_rfft_bfp_vs_dft)
+{
+    for (neuton_u16_t len = LEN_MIN; len <= LEN_MAX; len <<= 1)
+    {
+        const neuton_dsp_rfft_i16_t rfft = {
+            .cfft = { .len = len / 2U, .p_twiddle = twiddle_cfft_ },
+            .len = len,
+            .p_twiddle_rfft = twiddle_rfft_,
+        };
+
+        neuton_dsp_cfft_twiddle_factors_i16(twiddle_cfft_, len / 2U);
+        neuton_dsp_rfft_twiddle_factors_i16(twiddle_rfft_, len);
+
+        for (input_kind_t kind = INPUT_SMALL; kind < INPUT_KINDS_NUM; kind++)
+        {
+            neuton_i8_t exponent;
+
+            fill_input_(kind, len);
+            dft_(len, false);
+
+            zassert_equal(neuton_dsp_rfft_bfp_i16(&rfft, buffer_, &exponent), NEUTON_STATUS_SUCCESS);
+
+            const float snr = snr_db_(len / 2U, exponent, true);
+
+            zassert_true(snr >= SNR_MIN_DB, "len %u input %d exponent %d snr %f", len, kind, exponent,
+                         (double)snr);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Buffer at the odd halfword offset gives the same spectrum, complex samples are not word aligned there */
+ZTEST(neuton_dsp_fft, test_cfft_bfp_unaligned)
+{
+    static neuton_i16_t         aligned[LEN_MAX] __NEUTON_ALIGNED;
+    const neuton_dsp_cfft_i16_t cfft = { .len = LEN_MAX / 2U, .p_twiddle = twiddle_cfft_ };
+    neuton_i8_t                 exponent;
+    neuton_i8_t                 unaligned_exponent;
+
+    neuton_dsp_cfft_twiddle_factors_i16(twiddle_cfft_, cfft.len);
+
+    fill_input_(INPUT_FULL_SCALE, LEN_MAX);
+    memcpy(aligned, buffer_, sizeof(aligned));
+    memmove(&buffer_[1], buffer_, sizeof(aligned));
+
+    zassert_equal(neuton_dsp_cfft_bfp_i16(&cfft, aligned, &exponent), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_dsp_cfft_bfp_i16(&cfft, &buffer_[1], &unaligned_exponent), NEUTON_STATUS_SUCCESS);
+
+    zassert_equal(unaligned_exponent, exponent);
+    zassert_mem_equal(&buffer_[1], aligned, sizeof(aligned));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Block floating point windowed real FFT, out of place and in place, is the same as the window applied before it */
+ZTEST(neuton_dsp_fft, test_rfft_bfp_windowed_vs_window_then_rfft)
+{
+    for (neuton_u16_t len = LEN_MIN; len <= LEN_MAX; len <<= 1)
+    {
+        const neuton_dsp_rfft_i16_t rfft = {
+            .cfft = { .len = len / 2U, .p_twiddle = twiddle_cfft_ },
+            .len = len,
+            .p_twiddle_rfft = twiddle_rfft_,
+        };
+
+        neuton_dsp_cfft_twiddle_factors_i16(twiddle_cfft_, len / 2U);
+        neuton_dsp_rfft_twiddle_factors_i16(twiddle_rfft_, len);
+
+        for (neuton_dsp_window_type_t type = NEUTON_DSP_WINDOW_HANN; type <= NEUTON_DSP_WINDOW_TUKEY; type++)
+        {
+            neuton_dsp_window_q15_t window;
+
+            zassert_equal(neuton_dsp_window_init_q15(&window, window_q15_, len, type, TUKEY_FRACTION),
+                          NEUTON_STATUS_SUCCESS);
+
+            for (input_kind_t kind = INPUT_SMALL; kind < INPUT_KINDS_NUM; kind++)
+            {
+                neuton_i8_t exponent;
+                neuton_i8_t windowed_exponent;
+
+                fill_input_(kind, len);
+
+                neuton_dsp_window_apply_q15(&window, buffer_, windowed_);
+                zassert_equal(neuton_dsp_rfft_bfp_i16(&rfft, windowed_, &exponent), NEUTON_STATUS_SUCCESS);
+
+                zassert_equal(neuton_dsp_rfft_bfp_windowed_i16(&rfft, &window, buffer_, &buffer_[len],
+                                                               &windowed_exponent), NEUTON_STATUS_SUCCESS);
+                zassert_equal(windowed_exponent, exponent, "len %u window %d input %d", len, type, kind);
+                zassert_mem_equal(&buffer_[len], windowed_, len * sizeof(neuton_i16_t), "len %u window %d input %d",
+                                  len, type, kind);
+
+                zassert_equal(neuton_dsp_rfft_bfp_windowed_i16(&rfft, &window, buffer_, buffer_, &windowed_exponent),
+                              NEUTON_STATUS_SUCCESS);
+                zassert_equal(windowed_exponent, exponent, "in place len %u window %d input %d", len, type, kind);
+                zassert_mem_equal(buffer_, windowed_, len * sizeof(neuton_i16_t), "in place len %u window %d input %d",
+                                  len, type, kind);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Windowed real FFT keeps the input and gives the same spectrum as the window applied before the real FFT */
+ZTEST(neuton_dsp_fft, test_rfft_windowed_vs_window_then_rfft)
+{
+    neuton_dsp_rfft_i16_t rfft_i16;
+    neuton_dsp_rfft_f32_t rfft_f32;
+
+    neuton_dsp_rfft_init_i16(&rfft_i16, WINDOWED_LEN, NEUTON_RFFT_TWIDDLE_COEF_512_I16,
+                             NEUTON_CFFT_TWIDDLE_COEF_256_I16, NEUTON_BITREVINDEX_TABLE_256_I16,
+                             NEUTON_BITREVINDEX_TABLE_256_I16_LEN);
+    neuton_dsp_rfft_init_f32(&rfft_f32, WINDOWED_LEN, NEUTON_RFFT_TWIDDLE_COEF_512_F32,
+                             NEUTON_CFFT_TWIDDLE_COEF_256_F32, NEUTON_BITREVINDEX_TABLE_256_F32,
+                             NEUTON_BITREVINDEX_TABLE_256_F32_LEN);
+
+    for (neuton_dsp_window_type_t type = NEUTON_DSP_WINDOW_HANN; type <= NEUTON_DSP_WINDOW_TUKEY; type++)
+    {
+        neuton_dsp_window_q15_t window_q15;
+        neuton_dsp_window_f32_t window_f32;
+
+        zassert_equal(neuton_dsp_window_init_q15(&window_q15, window_q15_, WINDOWED_LEN, type, TUKEY_FRACTION),
+                      NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_dsp_window_init_f32(&window_f32, window_f32_, WINDOWED_LEN, type, TUKEY_FRACTION),
+                      NEUTON_STATUS_SUCCESS);
+
+        for (input_kind_t kind = INPUT_SMALL; kind < INPUT_KINDS_NUM; kind++)
+        {
+            fill_input_(kind, WINDOWED_LEN);
+            memcpy(&input_[WINDOWED_LEN], input_, WINDOWED_LEN * sizeof(float));
+
+            neuton_dsp_window_apply_q15(&window_q15, buffer_, windowed_);
+            neuton_dsp_rfft_i16(&rfft_i16, windowed_, windowed_);
+
+            neuton_dsp_window_apply_f32(&window_f32, input_, windowed_f32_);
+            neuton_dsp_rfft_f32(&rfft_f32, windowed_f32_, windowed_f32_);
+
+            zassert_equal(neuton_dsp_rfft_windowed_i16(&rfft_i16, &window_q15, buffer_, &buffer_[WINDOWED_LEN]),
+                          NEUTON_STATUS_SUCCESS);
+            zassert_mem_equal(&buffer_[WINDOWED_LEN], windowed_, WINDOWED_LEN * sizeof(neuton_i16_t),
+                              "window %d input %d", type, kind);
+
+            zassert_equal(neuton_dsp_rfft_windowed_f32(&rfft_f32, &window_f32, input_, output_f32_),
+                          NEUTON_STATUS_SUCCESS);
+            zassert_mem_equal(output_f32_, windowed_f32_, WINDOWED_LEN * sizeof(neuton_f32_t),
+                              "window %d input %d", type, kind);
+
+            /* Input is kept */
+            zassert_mem_equal(input_, &input_[WINDOWED_LEN], WINDOWED_LEN * sizeof(float), "window %d", type);
+
+            for (neuton_u32_t i = 0; i < WINDOWED_LEN; i++)
+                zassert_equal(buffer_[i], (neuton_i16_t)input_[i], "window %d sample %u", type, i);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_fft, test_bfp_invalid_arguments)
+{
+    neuton_dsp_cfft_i16_t cfft = { .len = 48, .p_twiddle = twiddle_cfft_ };
+    neuton_i8_t           exponent;
+
+    zassert_equal(neuton_dsp_cfft_bfp_i16(&cfft, buffer_, &exponent), NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_equal(neuton_dsp_cfft_bfp_i16(&cfft, NULL, &exponent), NEUTON_STATUS_NULL_ARGUMENT);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_fft, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,233 @@
+/*
+ * Fused moments features test: mean, std, skewness and kurtosis of the library time-domain features
+ * are compared with the ones derived from the fused moments, and the moments shared through
+ * the pipeline-owned cache are compared with the ones calculated for each pipeline function.
+ */
+#include "test_random.h"
+
+#include <neuton/nn/private/features/dsp/neuton_nn_features_timedomain.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define INPUT_LEN_MAX       (400U)
+
+/** Relative error of the floating-point features, fused moments are accumulated in a different order */
+#define F32_REL_TOLERANCE   (1e-3f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    neuton_i32_t mean;
+    neuton_i32_t std;
+    neuton_i32_t skew_kur[2];
+} features_i16_t;
+
+typedef struct
+{
+    neuton_f32_t mean;
+    neuton_f32_t std;
+    neuton_f32_t skew_kur[2];
+} features_f32_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_u16_t LENGTHS_[] = { 16, 50, 128, INPUT_LEN_MAX };
+
+static uint32_t                        random_;
+static neuton_i16_t                    input_i16_[INPUT_LEN_MAX];
+static neuton_f32_t                    input_f32_[INPUT_LEN_MAX];
+static neuton_nn_fused_moments_cache_t cache_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_features_mask_t mask_(bool mean, bool std, bool skew_kur)
+{
+    neuton_nn_features_mask_t mask = { .all = 0 };
+
+    mask.domain.time.is.mean = mean;
+    mask.domain.time.is.std  = std;
+    mask.domain.time.is.skew = skew_kur;
+    mask.domain.time.is.kur  = skew_kur;
+    return mask;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random samples with a random offset, so the moments are taken far from zero */
+static void fill_input_(neuton_u16_t num)
+{
+    const neuton_i32_t offset = test_random_range(&random_, -16000, 16000);
+
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        input_i16_[i] = (neuton_i16_t)(offset + test_random_range(&random_, -8000, 8000));
+        input_f32_[i] = (neuton_f32_t)input_i16_[i] / 256.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Library mean, std, skewness and kurtosis with the statistics context prepared by the caller */
+static void library_features_i16_(neuton_u16_t num, neuton_dsp_stat_ctx_i16_t* p_ctx, features_i16_t* p_features)
+{
+    neuton_nn_feature_mean_i16(input_i16_, num, &p_features->mean, mask_(true, false, false), p_ctx, NULL, NULL);
+    neuton_nn_feature_std_i16(input_i16_, num, &p_features->std, mask_(false, true, false), p_ctx, NULL, NULL);
+    neuton_nn_feature_skew_kur_i16(input_i16_, num, p_features->skew_kur, mask_(false, false, true), p_ctx,
+                                   NULL, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void library_features_f32_(neuton_u16_t num, neuton_dsp_stat_ctx_f32_t* p_ctx, features_f32_t* p_features)
+{
+    neuton_nn_feature_mean_f32(input_f32_, num, &p_features->mean, mask_(true, false, false), p_ctx, NULL, NULL);
+    neuton_nn_feature_std_f32(input_f32_, num, &p_features->std, mask_(false, true, false), p_ctx, NULL, NULL);
+    neuton_nn_feature_skew_kur_f32(input_f32_, num, p_features->skew_kur, mask_(false, false, true), p_ctx,
+                                   NULL, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void check_f32_(neuton_f32_t actual, neuton_f32_t expected, const char* p_name, neuton_u16_t num)
+{
+    zassert_true(fabsf(actual - expected) <= F32_REL_TOLERANCE * (1.0f + fabsf(expected)),
+                 "%s of %u samples: %f != %f", p_name, num, (double)actual, (double)expected);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    memset(&cache_, 0, sizeof(cache_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void after_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    neuton_nn_features_fused_moments_bind(NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Statistics context filled from the exact integer sums gives the same features as the library one */
+ZTEST(neuton_nn_features_fused, test_i16_vs_library)
+{
+    neuton_nn_features_fused_moments_bind(&cache_);
+
+    for (size_t l = 0; l < ARRAY_SIZE(LENGTHS_); l++)
+    {
+        const neuton_u16_t        num = LENGTHS_[l];
+        neuton_dsp_stat_ctx_i16_t ctx;
+        features_i16_t            expected;
+        features_i16_t            actual;
+
+        fill_input_(num);
+
+        memset(&ctx, 0, sizeof(ctx));
+        library_features_i16_(num, &ctx, &expected);
+
+        memset(&ctx, 0, sizeof(ctx));
+        neuton_nn_feature_utility_fused_moments_i16(input_i16_, num, NULL, mask_(true, true, true), &ctx,
+                                                    NULL, NULL);
+        zassert_true(ctx.flags.all & NEUTON_DSP_STAT_CTX_FUSED_FLAG);
+        library_features_i16_(num, &ctx, &actual);
+
+        zassert_equal(actual.mean, expected.mean, "mean of %u samples", num);
+        zassert_equal(actual.std, expected.std, "std of %u samples", num);
+        zassert_equal(actual.skew_kur[0], expected.skew_kur[0], "skew of %u samples", num);
+        zassert_equal(actual.skew_kur[1], expected.skew_kur[1], "kur of %u samples", num);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Mean and std from the fused context and the fused skewness and kurtosis match the library ones */
+ZTEST(neuton_nn_features_fused, test_f32_vs_library)
+{
+    neuton_nn_features_fused_moments_bind(&cache_);
+
+    for (size_t l = 0; l < ARRAY_SIZE(LENGTHS_); l++)
+    {
+        const neuton_u16_t        num = LENGTHS_[l];
+        neuton_dsp_stat_ctx_f32_t ctx;
+        features_f32_t            expected;
+        features_f32_t            actual;
+
+        fill_input_(num);
+
+        memset(&ctx, 0, sizeof(ctx));
+        library_features_f32_(num, &ctx, &expected);
+
+        memset(&ctx, 0, sizeof(ctx));
+        neuton_nn_feature_utility_fused_moments_f32(input_f32_, num, NULL, mask_(true, true, true), &ctx,
+                                                    NULL, NULL);
+        neuton_nn_feature_mean_f32(input_f32_, num, &actual.mean, mask_(true, false, false), &ctx, NULL, NULL);
+        neuton_nn_feature_std_f32(input_f32_, num, &actual.std, mask_(false, true, false), &ctx, NULL, NULL);
+
+        zassert_equal(neuton_nn_feature_fused_skew_kur_f32(input_f32_, num, actual.skew_kur,
+                                                           mask_(false, false, true), &ctx, NULL, NULL), 2);
+
+        check_f32_(actual.mean, expected.mean, "mean", num);
+        check_f32_(actual.std, expected.std, "std", num);
+        check_f32_(actual.skew_kur[0], expected.skew_kur[0], "skew", num);
+        check_f32_(actual.skew_kur[1], expected.skew_kur[1], "kur", num);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Moments are shared through the bound cache within a pipeline call and calculated again for the next one */
+ZTEST(neuton_nn_features_fused, test_bound_cache)
+{
+    const neuton_nn_features_mask_t mask = { .domain.time.is = { .hjorth_m = true, .hjorth_c = true } };
+    neuton_dsp_stat_ctx_i16_t       ctx;
+    neuton_i32_t                    first[2];
+    neuton_i32_t                    second[2];
+    neuton_i32_t                    unbound[2];
+
+    fill_input_(INPUT_LEN_MAX);
+
+    /* Without the bound cache the moments are calculated for each function */
+    memset(&ctx, 0, sizeof(ctx));
+    zassert_equal(neuton_nn_feature_fused_hjorth_i16(input_i16_, 100, unbound, mask, &ctx, NULL, NULL), 2);
+    zassert_false(ctx.flags.all & NEUTON_DSP_STAT_CTX_FUSED_FLAG);
+
+    neuton_nn_features_fused_moments_bind(&cache_);
+
+    memset(&ctx, 0, sizeof(ctx));
+    zassert_equal(neuton_nn_feature_fused_hjorth_i16(input_i16_, 100, first, mask, &ctx, NULL, NULL), 2);
+    zassert_true(ctx.flags.all & NEUTON_DSP_STAT_CTX_FUSED_FLAG);
+    zassert_equal(cache_.i16.num, 100);
+    zassert_mem_equal(first, unbound, sizeof(first));
+
+    /* Same pipeline call reuses the shared moments */
+    zassert_equal(neuton_nn_feature_fused_hjorth_i16(&input_i16_[100], 100, second, mask, &ctx, NULL, NULL), 2);
+    zassert_mem_equal(second, first, sizeof(first));
+
+    /* Reset context of the next call */
+    memset(&ctx, 0, sizeof(ctx));
+    zassert_equal(neuton_nn_feature_fused_hjorth_i16(&input_i16_[100], 300, second, mask, &ctx, NULL, NULL), 2);
+    zassert_equal(cache_.i16.num, 300);
+
+    neuton_nn_features_fused_moments_bind(NULL);
+
+    memset(&ctx, 0, sizeof(ctx));
+    zassert_equal(neuton_nn_feature_fused_hjorth_i16(&input_i16_[100], 300, unbound, mask, &ctx, NULL, NULL), 2);
+    zassert_mem_equal(second, unbound, sizeof(second));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_features_fused, NULL, NULL, before_, after_, NULL);
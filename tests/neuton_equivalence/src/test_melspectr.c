@@ -0,0 +1,207 @@
+/*
+ * Mel-spectrogram test: the ring-buffered floating-point mel-spectrogram is fed with the same frames
+ * as neuton_dsp_melspectr_make_f32(), its columns in the time order should be equal to the library
+ * spectrogram after each frame and each shift. The sparse filterbank energies of the FHT power
+ * spectrum should be the library column before log10, the benchmark compares both paths.
+ */
+#include "test_bench.h"
+#include "test_random.h"
+
+#include <neuton/common/neuton_platform.h>
+#include <neuton/dsp/transform/neuton_dsp_mel_filterbank.h>
+#include <neuton/dsp/transform/neuton_dsp_melspectr.h>
+#include <neuton/dsp/transform/neuton_dsp_melspectr_ring.h>
+#include <neuton/dsp/transform/neuton_dsp_rfht.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define WINDOW_SIZE         (256U)
+#define LOG_N               (8U)
+#define SAMPLE_RATE         (16000U)
+#define FREQ_BANDS          (32U)
+#define TIME_BANDS          (8U)
+#define FRAMES_NUM          (5U * TIME_BANDS)
+#define PI                  (3.14159265358979f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t                        random_;
+static neuton_f32_t                    sin_[WINDOW_SIZE / 4U];
+static neuton_f32_t                    tg_[WINDOW_SIZE / 4U];
+static neuton_u16_t                    rev_bit_index_[WINDOW_SIZE];
+static neuton_f32_t                    frame_[WINDOW_SIZE];
+static neuton_f32_t                    make_frame_[WINDOW_SIZE];
+static neuton_dsp_rfht_instance_t      fht_;
+static neuton_dsp_mel_band_t           bands_[FREQ_BANDS];
+static neuton_f32_t                    weights_[NEUTON_DSP_MEL_FILTERBANK_WEIGHTS_NUM(WINDOW_SIZE)];
+static neuton_dsp_mel_filterbank_f32_t filterbank_;
+static neuton_f32_t                    ring_memory_[FREQ_BANDS * TIME_BANDS];
+static neuton_f32_t                    ring_copy_[FREQ_BANDS * TIME_BANDS];
+static neuton_f32_t                    melspectrum_[FREQ_BANDS * TIME_BANDS];
+static neuton_dsp_melspectr_ring_t     ring_;
+static neuton_dsp_melspectr_ctx_f32_t  ctx_;
+static neuton_f32_t                    energies_[FREQ_BANDS];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** FHT tables: sine and tangent of the half angle of the Hartley rotations, bit reversed indices */
+static void fht_tables_(void)
+{
+    for (neuton_u16_t k = 0; k < WINDOW_SIZE / 4U; k++)
+    {
+        sin_[k] = sinf(2.0f * PI * (float)k / (float)WINDOW_SIZE);
+        tg_[k]  = tanf(PI * (float)k / (float)WINDOW_SIZE);
+    }
+
+    for (neuton_u16_t i = 0; i < WINDOW_SIZE; i++)
+    {
+        neuton_u16_t reversed = 0;
+
+        for (neuton_u16_t bit = 0; bit < LOG_N; bit++)
+            reversed |= ((i >> bit) & 1U) << (LOG_N - 1U - bit);
+
+        rev_bit_index_[i] = reversed;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Tone of the random frequency and amplitude with noise, some frames are silent */
+static void fill_frame_(void)
+{
+    const bool  is_silent = (test_random_next(&random_) % 8U) == 0;
+    const float freq      = 50.0f + (float)(SAMPLE_RATE / 2U - 100U) * test_random_unit(&random_);
+    const float amplitude = test_random_unit(&random_);
+
+    for (neuton_u16_t i = 0; i < WINDOW_SIZE; i++)
+    {
+        const float tone  = amplitude * sinf(2.0f * PI * freq * (float)i / (float)SAMPLE_RATE);
+        const float noise = 0.01f * (2.0f * test_random_unit(&random_) - 1.0f);
+
+        frame_[i] = is_silent ? 0.0f : (tone + noise);
+    }
+
+    memcpy(make_frame_, frame_, sizeof(make_frame_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Column of the frame by the sparse filterbank, in place of the frame and the energies */
+static void filterbank_column_(void)
+{
+    fht_.p_window = frame_;
+    neuton_dsp_rfht_f32(&fht_);
+
+    neuton_dsp_mel_filterbank_apply_f32(&filterbank_, frame_, energies_);
+
+    for (neuton_u16_t i = 0; i < FREQ_BANDS; i++)
+        energies_[i] = log10f((energies_[i] == 0.0f) ? NEUTON_F32_NP_MIN : energies_[i]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+
+    fht_tables_();
+
+    zassert_equal(neuton_dsp_rfht_init(&fht_, sin_, tg_, rev_bit_index_, frame_, WINDOW_SIZE, LOG_N),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_dsp_mel_filterbank_init_f32(&filterbank_, bands_, weights_, WINDOW_SIZE, SAMPLE_RATE,
+                                                      FREQ_BANDS), NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_dsp_melspectr_ring_init_f32(&ring_, &fht_, &filterbank_, ring_memory_, TIME_BANDS),
+                  NEUTON_STATUS_SUCCESS);
+
+    memset(&ctx_, 0, sizeof(ctx_));
+    ctx_.p_melspectrum = melspectrum_;
+    ctx_.fht           = fht_;
+    ctx_.sample_rate   = SAMPLE_RATE;
+    ctx_.freq_bands    = FREQ_BANDS;
+    ctx_.time_bands    = TIME_BANDS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Frames are pushed to the ring and made by the library, the full spectrograms are shifted by
+ * the random number of columns, the valid columns should be the same bit by bit
+ */
+ZTEST(neuton_dsp_melspectr, test_ring_vs_make)
+{
+    for (uint32_t n = 0; n < FRAMES_NUM; n++)
+    {
+        if (ctx_.current_fill == TIME_BANDS)
+        {
+            const neuton_u16_t shift = (neuton_u16_t)test_random_range(&random_, 1, TIME_BANDS - 1U);
+
+            neuton_dsp_melspectr_shift_f32(&ctx_, shift);
+            neuton_dsp_melspectr_ring_shift(&ring_, shift);
+        }
+
+        fill_frame_();
+
+        const neuton_status_t status = neuton_dsp_melspectr_ring_push_f32(&ring_, frame_);
+        const neuton_i8_t     ready  = neuton_dsp_melspectr_make_f32(&ctx_, make_frame_);
+
+        zassert_equal(status == NEUTON_STATUS_SUCCESS, ready == 0, "frame %u", n);
+        zassert_equal(ring_.filled, ctx_.current_fill, "frame %u", n);
+
+        neuton_dsp_melspectr_ring_copy_f32(&ring_, ring_copy_);
+        zassert_mem_equal(ring_copy_, melspectrum_, ctx_.current_fill * FREQ_BANDS * sizeof(neuton_f32_t),
+                          "frame %u", n);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Each frame column of the sparse filterbank is the first library column of the same frame */
+ZTEST(neuton_dsp_melspectr, test_filterbank_vs_make)
+{
+    for (uint32_t n = 0; n < FRAMES_NUM; n++)
+    {
+        fill_frame_();
+
+        ctx_.current_fill = 0;
+        zassert_equal(neuton_dsp_melspectr_make_f32(&ctx_, make_frame_), 1);
+
+        filterbank_column_();
+        zassert_mem_equal(energies_, melspectrum_, sizeof(energies_), "frame %u", n);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_melspectr, test_benchmark)
+{
+    uint32_t make;
+    uint32_t sparse;
+
+    fill_frame_();
+
+    TEST_BENCH_CYCLES(make, {
+        memcpy(make_frame_, frame_, sizeof(make_frame_));
+        ctx_.current_fill = 0;
+        neuton_dsp_melspectr_make_f32(&ctx_, make_frame_);
+    });
+
+    memcpy(ring_copy_, frame_, sizeof(frame_));
+
+    TEST_BENCH_CYCLES(sparse, {
+        memcpy(frame_, ring_copy_, sizeof(frame_));
+        filterbank_column_();
+    });
+
+    test_bench_print("mel column of 256 samples, 32 bands", make, sparse);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_melspectr, NULL, NULL, before_, NULL, NULL);
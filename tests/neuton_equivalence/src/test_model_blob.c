@@ -0,0 +1,306 @@
+/*
+ * Serialized model test: blobs written from the reference, 8-bit weights and fused scaling models are loaded
+ * to the shipped model context, that should then infer bit-exact with the source model, and broken blobs
+ * are rejected with the context unchanged. A/B slots load the newest valid blob over the sequence wrap-around.
+ */
+#include "models.h"
+#include "test_random.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_model_blob.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton/nn/private/inference/neuton_nn_packed_model.h>
+#include <neuton/nn/private/inference/neuton_nn_run_inference.h>
+#include <neuton_user_model.h>
+
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define SLOT_SIZE           (4096U)
+#define VECTORS_NUM         (200U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Slots are 64-bit arrays, so they are aligned to NEUTON_NN_BLOB_ALIGN */
+static neuton_u64_t slot_a_[SLOT_SIZE / sizeof(neuton_u64_t)];
+static neuton_u64_t slot_b_[SLOT_SIZE / sizeof(neuton_u64_t)];
+
+static neuton_nn_t*             p_dut_;
+static neuton_nn_t              saved_nn_;
+static neuton_nn_dsp_pipeline_t saved_dsp_;
+static neuton_nn_t              snapshot_nn_;
+static neuton_nn_dsp_pipeline_t snapshot_dsp_;
+static uint32_t                 random_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** CRC-32 (IEEE 802.3) of the blob bytes after the crc32 field, so a broken field is found by its own check */
+static void seal_(void* p_blob)
+{
+    neuton_nn_blob_header_t* p_header = (neuton_nn_blob_header_t*)p_blob;
+    const neuton_u32_t       skip     = offsetof(neuton_nn_blob_header_t, crc32) + sizeof(p_header->crc32);
+    const neuton_u8_t*       p_data   = (const neuton_u8_t*)p_blob + skip;
+    neuton_u32_t             crc      = 0xFFFFFFFFUL;
+
+    for (neuton_u32_t i = 0; i < p_header->total_size - skip; i++)
+    {
+        crc ^= p_data[i];
+
+        for (uint32_t bit = 0; bit < 8U; bit++)
+            crc = (crc >> 1) ^ ((crc & 1U) ? 0xEDB88320UL : 0);
+    }
+
+    p_header->crc32 = ~crc;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_blob_header_t* write_(const neuton_nn_t* p_nn, neuton_u64_t* p_slot, neuton_u32_t sequence)
+{
+    neuton_u32_t size = 0;
+
+    zassert_equal(neuton_nn_blob_write(p_nn, sequence, p_slot, SLOT_SIZE, &size), NEUTON_STATUS_SUCCESS);
+    zassert_true((size > sizeof(neuton_nn_blob_header_t)) && (size <= SLOT_SIZE));
+
+    return (neuton_nn_blob_header_t*)p_slot;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t* records_(neuton_nn_blob_header_t* p_header)
+{
+    return (neuton_u16_t*)((neuton_u8_t*)p_header + p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].offset);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Broken blob is rejected and leaves the model context and its pipeline as they were */
+static void check_rejected_(const void* p_blob, const char* p_case)
+{
+    memcpy(&snapshot_nn_, p_dut_, sizeof(snapshot_nn_));
+    memcpy(&snapshot_dsp_, p_dut_->p_dsp, sizeof(snapshot_dsp_));
+
+    zassert_equal(neuton_nn_blob_load(p_dut_, p_blob, SLOT_SIZE), NEUTON_STATUS_INVALID_ARGUMENT, "%s", p_case);
+    zassert_mem_equal(p_dut_, &snapshot_nn_, sizeof(snapshot_nn_), "%s", p_case);
+    zassert_mem_equal(p_dut_->p_dsp, &snapshot_dsp_, sizeof(snapshot_dsp_), "%s", p_case);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random model input vectors are run through the loaded model and the source model, scaled features
+ * or unscaled ones in [min - range, max + range] for the fused scaling model
+ */
+static void check_inference_(neuton_nn_t* p_source)
+{
+    const bool                           is_fused = p_source->interfaces.run_inference ==
+                                                    neuton_nn_run_model_inference_packed_fused;
+    const neuton_nn_features_meta_i32_t* p_meta   = &p_source->p_dsp->features.meta.i32;
+    const neuton_u16_t                   num      = p_source->p_dsp->features.overall_num;
+
+    /* Separate arrays models are written packed */
+    zassert_equal(p_dut_->interfaces.run_inference,
+                  (p_source->interfaces.run_inference == neuton_nn_run_model_inference_q16) ?
+                      neuton_nn_run_model_inference_packed_q16 : p_source->interfaces.run_inference);
+
+    for (uint32_t v = 0; v < VECTORS_NUM; v++)
+    {
+        for (neuton_u16_t i = 0; i < num; i++)
+        {
+            if (is_fused)
+            {
+                const neuton_i32_t range = p_meta->p_max[i] - p_meta->p_min[i];
+
+                p_source->p_dsp->features.extracted_memory.p_i32[i] =
+                    p_meta->p_min[i] - range + test_random_range(&random_, 0, 3 * range);
+            }
+            else
+            {
+                ((neuton_u16_t*)p_source->p_dsp->features.extracted_memory.p_void)[i] =
+                    (neuton_u16_t)test_random_next(&random_);
+            }
+        }
+
+        memcpy(p_dut_->p_dsp->features.extracted_memory.p_void, p_source->p_dsp->features.extracted_memory.p_void,
+               num * (is_fused ? sizeof(neuton_i32_t) : sizeof(neuton_u16_t)));
+
+        p_source->interfaces.run_inference(p_source);
+        p_dut_->interfaces.run_inference(p_dut_);
+
+        zassert_mem_equal(p_dut_->model.params.q16.p_neurons, p_source->model.params.q16.p_neurons,
+                          p_source->model.meta.neurons_num * sizeof(neuton_u16_t), "vector %u", v);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    p_dut_  = neuton_nn_user_model();
+
+    memset(slot_a_, 0, sizeof(slot_a_));
+    memset(slot_b_, 0, sizeof(slot_b_));
+
+    zassert_equal(neuton_nn_setup(p_dut_), NEUTON_STATUS_SUCCESS);
+
+    memcpy(&saved_nn_, p_dut_, sizeof(saved_nn_));
+    memcpy(&saved_dsp_, p_dut_->p_dsp, sizeof(saved_dsp_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Compiled model context, the loaded one points to the slot, that is going to be rewritten */
+static void restore_(void)
+{
+    memcpy(p_dut_, &saved_nn_, sizeof(saved_nn_));
+    memcpy(p_dut_->p_dsp, &saved_dsp_, sizeof(saved_dsp_));
+    neuton_nn_features_scale_reset(p_dut_->p_dsp);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Compiled model is given back, the models are shared with the other suites */
+static void after_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    restore_();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Blob of each layout is loaded without copying and infers bit-exact with the model it was written from */
+ZTEST(neuton_nn_model_blob, test_write_load_round_trip)
+{
+    neuton_nn_t* sources[] = { reference_user_model(), q8w_user_model(), fused_user_model() };
+
+    for (size_t s = 0; s < ARRAY_SIZE(sources); s++)
+    {
+        zassert_equal(neuton_nn_setup(sources[s]), NEUTON_STATUS_SUCCESS);
+        restore_();
+
+        neuton_nn_blob_header_t* p_header = write_(sources[s], slot_a_, 1);
+
+        zassert_equal(neuton_nn_blob_load(p_dut_, slot_a_, SLOT_SIZE), NEUTON_STATUS_SUCCESS, "source %u", s);
+        zassert_equal(p_dut_->model.params.packed_q16.p_records, records_(p_header));
+        zassert_equal(p_dut_->model.params.packed_q16.records_num,
+                      p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].size / sizeof(neuton_u16_t));
+        zassert_mem_equal(p_dut_->p_dsp->features.p_masks, sources[s]->p_dsp->features.p_masks,
+                          p_header->masks_num * sizeof(neuton_nn_features_mask_t));
+        zassert_equal(strcmp(p_dut_->model.meta.p_solution_id_str, sources[s]->model.meta.p_solution_id_str), 0);
+
+        check_inference_(sources[s]);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_model_blob, test_broken_blobs_rejected)
+{
+    neuton_nn_blob_header_t* p_header = write_(reference_user_model(), slot_a_, 1);
+    neuton_u16_t*            p_record = records_(p_header);
+
+    /* Corrupted records without the CRC update */
+    p_record[0] ^= 1U;
+    check_rejected_(slot_a_, "corrupted CRC");
+
+    /* Records section out of the blob */
+    p_header = write_(reference_user_model(), slot_a_, 1);
+    p_header->sections[NEUTON_NN_BLOB_SECTION_RECORDS].size = p_header->total_size;
+    seal_(slot_a_);
+    check_rejected_(slot_a_, "records section bounds");
+
+    p_header = write_(reference_user_model(), slot_a_, 1);
+    p_header->sections[NEUTON_NN_BLOB_SECTION_SOLUTION_ID].offset = p_header->total_size + NEUTON_NN_BLOB_ALIGN;
+    seal_(slot_a_);
+    check_rejected_(slot_a_, "solution ID section bounds");
+
+    /* Internal link of the first neuron that has one points out of the neurons */
+    p_header = write_(reference_user_model(), slot_a_, 1);
+    p_record = records_(p_header);
+
+    for (neuton_u16_t n = 0; n < p_header->neurons_num; n++)
+    {
+        const neuton_u16_t internal_num = p_record[0] & NEUTON_NN_PACKED_LINKS_NUM_MASK;
+
+        if (internal_num != 0)
+        {
+            p_record[NEUTON_NN_PACKED_HEADER_WORDS] = p_header->neurons_num;
+            break;
+        }
+
+        p_record += NEUTON_NN_PACKED_HEADER_WORDS + 2U * (internal_num + p_record[1]);
+    }
+
+    seal_(slot_a_);
+    check_rejected_(slot_a_, "internal link index");
+
+    /* External link of the fused record points out of the features */
+    p_header = write_(fused_user_model(), slot_a_, 1);
+    p_record = records_(p_header);
+    p_record[NEUTON_NN_PACKED_FUSED_HEADER_WORDS + 2U * (p_record[0] & NEUTON_NN_PACKED_LINKS_NUM_MASK)] =
+        p_header->features_num;
+    seal_(slot_a_);
+    zassert_true(p_record[1] != 0, "first fused neuron has external links");
+    check_rejected_(slot_a_, "external link index");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_model_blob, test_ab_fallback)
+{
+    const neuton_nn_t* p_ref = reference_user_model();
+    neuton_u8_t        loaded = 0xFF;
+
+    write_(p_ref, slot_a_, 1);
+    write_(p_ref, slot_b_, 2);
+
+    zassert_equal(neuton_nn_blob_load_ab(p_dut_, slot_a_, slot_b_, SLOT_SIZE, &loaded), NEUTON_STATUS_SUCCESS);
+    zassert_equal(loaded, 1, "newer slot B");
+
+    /* Newer slot B is broken, e.g. the update was interrupted */
+    records_((neuton_nn_blob_header_t*)slot_b_)[0] ^= 1U;
+
+    zassert_equal(neuton_nn_blob_load_ab(p_dut_, slot_a_, slot_b_, SLOT_SIZE, &loaded), NEUTON_STATUS_SUCCESS);
+    zassert_equal(loaded, 0, "fallback to slot A");
+
+    /* Both slots are broken, the loaded model is kept */
+    records_((neuton_nn_blob_header_t*)slot_a_)[0] ^= 1U;
+    memcpy(&snapshot_nn_, p_dut_, sizeof(snapshot_nn_));
+
+    zassert_equal(neuton_nn_blob_load_ab(p_dut_, slot_a_, slot_b_, SLOT_SIZE, &loaded),
+                  NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_mem_equal(p_dut_, &snapshot_nn_, sizeof(snapshot_nn_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Sequence numbers are compared as serial numbers, so the wrapped around sequence is the newer one */
+ZTEST(neuton_nn_model_blob, test_ab_sequence_wrap_around)
+{
+    const neuton_nn_t* p_ref  = reference_user_model();
+    neuton_u8_t        loaded = 0xFF;
+
+    write_(p_ref, slot_a_, UINT32_MAX);
+    write_(p_ref, slot_b_, 0);
+
+    zassert_equal(neuton_nn_blob_load_ab(p_dut_, slot_a_, slot_b_, SLOT_SIZE, &loaded), NEUTON_STATUS_SUCCESS);
+    zassert_equal(loaded, 1, "slot B sequence wrapped around");
+
+    write_(p_ref, slot_a_, 1);
+    write_(p_ref, slot_b_, UINT32_MAX - 1U);
+
+    zassert_equal(neuton_nn_blob_load_ab(p_dut_, slot_a_, slot_b_, SLOT_SIZE, &loaded), NEUTON_STATUS_SUCCESS);
+    zassert_equal(loaded, 0, "slot A sequence wrapped around");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_model_blob, NULL, NULL, before_, after_, NULL);
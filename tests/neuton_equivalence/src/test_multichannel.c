@@ -0,0 +1,230 @@
+/*
+ * Multi-channel statistics test: the results of the single pass over the interleaved window are compared
+ * with the library strided functions called for each channel, and both paths are benchmarked.
+ */
+#include "test_bench.h"
+#include "test_random.h"
+
+#include <neuton/dsp/neuton_dsp_statistic.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CHANNELS_MAX        (6U)
+#define NUM_MAX             (256U)
+
+/** Relative error of the floating-point sums, the library may accumulate in a different order */
+#define F32_REL_TOLERANCE   (1e-5f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_u16_t CHANNELS_[] = { 1, 3, CHANNELS_MAX };
+static const neuton_u16_t LENGTHS_[]  = { 2, 16, 100, NUM_MAX };
+
+static uint32_t                  random_;
+static neuton_i16_t              input_i16_[NUM_MAX * CHANNELS_MAX];
+static neuton_f32_t              input_f32_[NUM_MAX * CHANNELS_MAX];
+static neuton_dsp_stat_ctx_i16_t ctx_i16_[CHANNELS_MAX];
+static neuton_dsp_stat_ctx_f32_t ctx_f32_[CHANNELS_MAX];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Random samples around a random offset of each channel, so all the crossing rates are not zero */
+static void fill_input_(neuton_u16_t num, neuton_u16_t channels)
+{
+    neuton_i32_t offset[CHANNELS_MAX];
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        offset[ch] = test_random_range(&random_, -4000, 4000);
+
+    for (neuton_u32_t i = 0; i < (neuton_u32_t)num * channels; i++)
+    {
+        input_i16_[i] = (neuton_i16_t)(offset[i % channels] + test_random_range(&random_, -20000, 20000));
+        input_f32_[i] = (neuton_f32_t)input_i16_[i] / 1024.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void check_f32_(neuton_f32_t actual, neuton_f32_t expected, neuton_f32_t magnitude, const char* p_name,
+                       neuton_u16_t ch)
+{
+    zassert_true(fabsf(actual - expected) <= F32_REL_TOLERANCE * magnitude, "%s of channel %u: %f != %f", p_name,
+                 ch, (double)actual, (double)expected);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    memset(ctx_i16_, 0, sizeof(ctx_i16_));
+    memset(ctx_f32_, 0, sizeof(ctx_f32_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_multichannel, test_i16_vs_strided)
+{
+    for (size_t c = 0; c < ARRAY_SIZE(CHANNELS_); c++)
+    {
+        for (size_t l = 0; l < ARRAY_SIZE(LENGTHS_); l++)
+        {
+            const neuton_u16_t channels = CHANNELS_[c];
+            const neuton_u16_t num      = LENGTHS_[l];
+            neuton_i16_t       mean[CHANNELS_MAX];
+            neuton_i32_t       rms[CHANNELS_MAX];
+            neuton_i16_t       min[CHANNELS_MAX];
+            neuton_i16_t       max[CHANNELS_MAX];
+            neuton_i16_t       zcr[CHANNELS_MAX];
+            neuton_i16_t       mcr[CHANNELS_MAX];
+
+            fill_input_(num, channels);
+            memset(ctx_i16_, 0, sizeof(ctx_i16_));
+
+            neuton_dsp_mc_stat_ctx_i16(input_i16_, num, channels, ctx_i16_);
+            neuton_dsp_mc_mean_i16(ctx_i16_, num, channels, mean);
+            neuton_dsp_mc_rms_i16(ctx_i16_, num, channels, rms);
+            neuton_dsp_mc_min_max_i16(input_i16_, num, channels, min, max);
+            neuton_dsp_mc_zcr_i16(input_i16_, num, channels, zcr);
+            neuton_dsp_mc_tcr_i16(input_i16_, num, channels, mean, mcr);
+
+            for (neuton_u16_t ch = 0; ch < channels; ch++)
+            {
+                const neuton_i16_t* p_channel = &input_i16_[ch];
+                neuton_i16_t        ref_min;
+                neuton_i16_t        ref_max;
+
+                neuton_dsp_min_max_i16_s(p_channel, num, channels, &ref_min, &ref_max);
+
+                zassert_equal(ctx_i16_[ch].value.sum, neuton_dsp_sum_i16_s(p_channel, num, channels, NULL),
+                              "sum of channel %u of %u", ch, channels);
+                zassert_equal(ctx_i16_[ch].value.abssum, neuton_dsp_abssum_i16_s(p_channel, num, channels, NULL),
+                              "abssum of channel %u of %u", ch, channels);
+                zassert_equal(ctx_i16_[ch].value.tss, neuton_dsp_tss_i16_s(p_channel, num, channels, NULL),
+                              "tss of channel %u of %u", ch, channels);
+                zassert_equal(mean[ch], neuton_dsp_mean_i16_s(p_channel, num, channels, NULL),
+                              "mean of channel %u of %u", ch, channels);
+                zassert_equal(rms[ch], neuton_dsp_rms_i16_s(p_channel, num, channels, NULL),
+                              "rms of channel %u of %u", ch, channels);
+                zassert_equal(min[ch], ref_min, "min of channel %u of %u", ch, channels);
+                zassert_equal(max[ch], ref_max, "max of channel %u of %u", ch, channels);
+                zassert_equal(zcr[ch], neuton_dsp_zcr_i16_s(p_channel, num, channels),
+                              "zcr of channel %u of %u", ch, channels);
+                zassert_equal(mcr[ch], neuton_dsp_mcr_i16_s(p_channel, num, channels, NULL),
+                              "mcr of channel %u of %u", ch, channels);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_multichannel, test_f32_vs_strided)
+{
+    for (size_t c = 0; c < ARRAY_SIZE(CHANNELS_); c++)
+    {
+        for (size_t l = 0; l < ARRAY_SIZE(LENGTHS_); l++)
+        {
+            const neuton_u16_t channels = CHANNELS_[c];
+            const neuton_u16_t num      = LENGTHS_[l];
+            neuton_f32_t       mean[CHANNELS_MAX];
+            neuton_f32_t       rms[CHANNELS_MAX];
+            neuton_f32_t       min[CHANNELS_MAX];
+            neuton_f32_t       max[CHANNELS_MAX];
+            neuton_f32_t       zcr[CHANNELS_MAX];
+            neuton_f32_t       mcr[CHANNELS_MAX];
+
+            fill_input_(num, channels);
+            memset(ctx_f32_, 0, sizeof(ctx_f32_));
+
+            neuton_dsp_mc_stat_ctx_f32(input_f32_, num, channels, ctx_f32_);
+            neuton_dsp_mc_mean_f32(ctx_f32_, num, channels, mean);
+            neuton_dsp_mc_rms_f32(ctx_f32_, num, channels, rms);
+            neuton_dsp_mc_min_max_f32(input_f32_, num, channels, min, max);
+            neuton_dsp_mc_zcr_f32(input_f32_, num, channels, zcr);
+            neuton_dsp_mc_tcr_f32(input_f32_, num, channels, mean, mcr);
+
+            for (neuton_u16_t ch = 0; ch < channels; ch++)
+            {
+                const neuton_f32_t* p_channel = &input_f32_[ch];
+                const neuton_f32_t  abssum    = neuton_dsp_abssum_f32_s(p_channel, num, channels, NULL);
+                const neuton_f32_t  tss       = neuton_dsp_tss_f32_s(p_channel, num, channels, NULL);
+                neuton_f32_t        ref_min;
+                neuton_f32_t        ref_max;
+
+                neuton_dsp_min_max_f32_s(p_channel, num, channels, &ref_min, &ref_max);
+
+                check_f32_(ctx_f32_[ch].value.sum, neuton_dsp_sum_f32_s(p_channel, num, channels, NULL), abssum,
+                           "sum", ch);
+                check_f32_(ctx_f32_[ch].value.abssum, abssum, abssum, "abssum", ch);
+                check_f32_(ctx_f32_[ch].value.tss, tss, tss, "tss", ch);
+                check_f32_(mean[ch], neuton_dsp_mean_f32_s(p_channel, num, channels, NULL), abssum / num, "mean",
+                           ch);
+                check_f32_(rms[ch], neuton_dsp_rms_f32_s(p_channel, num, channels, NULL), rms[ch], "rms", ch);
+
+                zassert_equal(min[ch], ref_min, "min of channel %u of %u", ch, channels);
+                zassert_equal(max[ch], ref_max, "max of channel %u of %u", ch, channels);
+                zassert_equal(zcr[ch], neuton_dsp_zcr_f32_s(p_channel, num, channels),
+                              "zcr of channel %u of %u", ch, channels);
+
+                /* Threshold of the library mean-crossing rate is its own mean, it may differ in the last bit */
+                zassert_within(mcr[ch], neuton_dsp_mcr_f32_s(p_channel, num, channels, NULL),
+                               2.0f / (num - 1), "mcr of channel %u of %u", ch, channels);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Statistics of the 6-axis window: single pass over the interleaved window against a strided pass per axis */
+ZTEST(neuton_dsp_multichannel, test_benchmark)
+{
+    neuton_i16_t mean[CHANNELS_MAX];
+    neuton_i32_t rms[CHANNELS_MAX];
+    neuton_i16_t min[CHANNELS_MAX];
+    neuton_i16_t max[CHANNELS_MAX];
+    neuton_i16_t zcr[CHANNELS_MAX];
+    neuton_i16_t mcr[CHANNELS_MAX];
+    uint32_t     strided;
+    uint32_t     batched;
+
+    fill_input_(NUM_MAX, CHANNELS_MAX);
+
+    TEST_BENCH_CYCLES(strided, {
+        memset(ctx_i16_, 0, sizeof(ctx_i16_));
+
+        for (neuton_u16_t ch = 0; ch < CHANNELS_MAX; ch++)
+        {
+            mean[ch] = neuton_dsp_mean_i16_s(&input_i16_[ch], NUM_MAX, CHANNELS_MAX, &ctx_i16_[ch]);
+            rms[ch]  = neuton_dsp_rms_i16_s(&input_i16_[ch], NUM_MAX, CHANNELS_MAX, &ctx_i16_[ch]);
+            zcr[ch]  = neuton_dsp_zcr_i16_s(&input_i16_[ch], NUM_MAX, CHANNELS_MAX);
+            mcr[ch]  = neuton_dsp_tcr_i16_s(&input_i16_[ch], NUM_MAX, CHANNELS_MAX, mean[ch]);
+            neuton_dsp_min_max_i16_s(&input_i16_[ch], NUM_MAX, CHANNELS_MAX, &min[ch], &max[ch]);
+        }
+    });
+
+    TEST_BENCH_CYCLES(batched, {
+        memset(ctx_i16_, 0, sizeof(ctx_i16_));
+
+        neuton_dsp_mc_stat_ctx_i16(input_i16_, NUM_MAX, CHANNELS_MAX, ctx_i16_);
+        neuton_dsp_mc_mean_i16(ctx_i16_, NUM_MAX, CHANNELS_MAX, mean);
+        neuton_dsp_mc_rms_i16(ctx_i16_, NUM_MAX, CHANNELS_MAX, rms);
+        neuton_dsp_mc_zcr_i16(input_i16_, NUM_MAX, CHANNELS_MAX, zcr);
+        neuton_dsp_mc_tcr_i16(input_i16_, NUM_MAX, CHANNELS_MAX, mean, mcr);
+        neuton_dsp_mc_min_max_i16(input_i16_, NUM_MAX, CHANNELS_MAX, min, max);
+    });
+
+    test_bench_print("mean, rms, zcr, mcr, min/max of 6 x 256 samples", strided, batched);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_multichannel, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,279 @@
+/*
+ * Multi-rate input test: the reference model features are split by axis pairs into 25, 100 and 400 Hz groups
+ * fed with synthetic streams of the same hop time, the model features vector of each tick should be
+ * the per-group features extraction on the group windows, with the ready groups and overruns accounted.
+ */
+#include "models.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_multirate.h>
+#include <neuton/nn/private/features/neuton_nn_extract_features.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define GROUPS_NUM          (3U)
+#define GROUP_AXES_NUM      (2U)
+#define BASE_RATE_HZ        (400U)
+#define WINDOW_MS           (1000U)
+#define HOP_MS              (320U)
+#define TICKS_NUM           (20U)
+#define FEATURES_MAX        (64U)
+#define WINDOW_SIZE_MAX     (BASE_RATE_HZ * WINDOW_MS / 1000U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_u16_t RATES_HZ[GROUPS_NUM] = { 25, 100, 400 };
+
+static neuton_nn_multirate_t    multirate_;
+static neuton_nn_input_t        inputs_[GROUPS_NUM];
+static neuton_nn_window_ctx_t   windows_ctx_[GROUPS_NUM];
+static neuton_i16_t             windows_[GROUPS_NUM][WINDOW_SIZE_MAX * GROUP_AXES_NUM];
+static neuton_nn_dsp_pipeline_t dsp_[GROUPS_NUM];
+static neuton_nn_dsp_pipeline_t check_dsp_[GROUPS_NUM];
+static neuton_i32_t             check_features_[FEATURES_MAX];
+static neuton_i16_t             samples_[2U * WINDOW_SIZE_MAX * GROUP_AXES_NUM];
+static uint32_t                 samples_num_[GROUPS_NUM];
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t bits_num_(neuton_u32_t mask)
+{
+    neuton_u16_t num = 0;
+
+    for (; mask != 0; mask &= mask - 1U)
+        num++;
+
+    return num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t window_size_(uint32_t group)
+{
+    return (neuton_u16_t)(RATES_HZ[group] * WINDOW_MS / 1000U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t window_shift_(uint32_t group)
+{
+    return (neuton_u16_t)(RATES_HZ[group] * HOP_MS / 1000U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Group input of two axes with its own window memory and context */
+static void make_input_(uint32_t group)
+{
+    const neuton_nn_t* p_ref = reference_user_model();
+
+    const neuton_nn_input_t input = {
+        .scale                = p_ref->input.scale,
+        .type                 = NEUTON_NN_INPUT_I16,
+        .unique_num           = GROUP_AXES_NUM,
+        .unique_num_used      = GROUP_AXES_NUM,
+        .unique_scales_num    = p_ref->input.unique_scales_num,
+        .window_size          = window_size_(group),
+        .window_shift         = window_shift_(group),
+        .window_memory.p_i16  = windows_[group],
+        .p_window_ctx         = &windows_ctx_[group],
+    };
+
+    /* Input has constant members, so it is taken by memory */
+    memcpy(&inputs_[group], &input, sizeof(input));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Group DSP pipeline of the reference model masks of the group axes */
+static void make_dsp_(neuton_nn_dsp_pipeline_t* p_dsp, uint32_t group, neuton_i32_t* p_features)
+{
+    const neuton_nn_dsp_feature_extraction_t* p_ref   = &reference_user_model()->p_dsp->features;
+    const neuton_nn_features_mask_t*          p_masks = &p_ref->p_masks[group * GROUP_AXES_NUM];
+
+    const neuton_nn_dsp_pipeline_t dsp = {
+        .features = {
+            .extracted_memory.p_i32 = p_features,
+            .overall_num            = bits_num_(p_masks[0].domain.time.all) + bits_num_(p_masks[1].domain.time.all),
+            .masks_num              = GROUP_AXES_NUM,
+            .p_masks                = p_masks,
+            .p_timedomain_pipeline  = p_ref->p_timedomain_pipeline,
+            .p_freqdomain_pipeline  = NULL,
+        },
+    };
+
+    memcpy(p_dsp, &dsp, sizeof(dsp));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Sine of the own frequency on each axis of each group, sampled at the group rate */
+static void group_sample_(uint32_t group, neuton_i16_t* p_sample)
+{
+    const float t = (float)samples_num_[group] / (float)RATES_HZ[group];
+
+    for (uint32_t axis = 0; axis < GROUP_AXES_NUM; axis++)
+    {
+        const float freq = 0.5f + (float)(group * GROUP_AXES_NUM + axis) * 1.5f;
+
+        p_sample[axis] = (neuton_i16_t)(15000.0f * sinf(2.0f * 3.14159265f * freq * t + (float)axis));
+    }
+
+    samples_num_[group]++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Group window is collected by its first window_size samples and by each window_shift samples after them */
+static bool is_collected_(uint32_t group)
+{
+    const uint32_t size  = window_size_(group);
+    const uint32_t shift = window_shift_(group);
+
+    return (samples_num_[group] >= size) && (((samples_num_[group] - size) % shift) == 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    memset(&multirate_, 0, sizeof(multirate_));
+    memset(windows_, 0, sizeof(windows_));
+    memset(samples_num_, 0, sizeof(samples_num_));
+
+    multirate_.p_nn = reference_user_model();
+
+    for (uint32_t g = 0; g < GROUPS_NUM; g++)
+    {
+        neuton_u16_t index;
+
+        make_input_(g);
+        make_dsp_(&dsp_[g], g, NULL);
+        make_dsp_(&check_dsp_[g], g, check_features_);
+
+        zassert_true(dsp_[g].features.overall_num <= FEATURES_MAX);
+        zassert_equal(neuton_nn_multirate_add_group(&multirate_, &inputs_[g], &dsp_[g], RATES_HZ[g], &index),
+                      NEUTON_STATUS_SUCCESS);
+        zassert_equal(index, g);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_multirate, test_setup)
+{
+    zassert_equal(neuton_nn_multirate_setup(&multirate_), NEUTON_STATUS_SUCCESS);
+    zassert_equal(multirate_.tick_us, HOP_MS * 1000U);
+    zassert_equal(multirate_.ready_mask, 0);
+    zassert_equal(multirate_.overruns_num, 0);
+
+    /* Group features follow each other in the model features vector */
+    zassert_equal(multirate_.groups[0].features_offset, 0);
+
+    for (uint32_t g = 1; g < GROUPS_NUM; g++)
+    {
+        zassert_equal(multirate_.groups[g].features_offset,
+                      multirate_.groups[g - 1].features_offset + dsp_[g - 1].features.overall_num, "group %u", g);
+    }
+
+    /* Hop of the last group takes the other time */
+    multirate_.groups[GROUPS_NUM - 1].rate_hz++;
+    zassert_equal(neuton_nn_multirate_setup(&multirate_), NEUTON_STATUS_INVALID_ARGUMENT);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Streams are fed sample by sample in time order at the base rate, features of each complete tick
+ * are compared with the features extraction of each group window
+ */
+ZTEST(neuton_nn_multirate, test_features_vs_groups)
+{
+    const neuton_u32_t  all_mask   = (1UL << GROUPS_NUM) - 1U;
+    const neuton_i32_t* p_features = multirate_.p_nn->p_dsp->features.extracted_memory.p_i32;
+    neuton_u32_t        ready_mask = 0;
+    uint32_t            ticks      = 0;
+    neuton_i16_t        sample[GROUP_AXES_NUM];
+
+    zassert_equal(neuton_nn_multirate_setup(&multirate_), NEUTON_STATUS_SUCCESS);
+
+    for (uint32_t n = 0; ticks < TICKS_NUM; n++)
+    {
+        for (uint32_t g = 0; g < GROUPS_NUM; g++)
+        {
+            if ((n % (BASE_RATE_HZ / RATES_HZ[g])) != 0)
+                continue;
+
+            group_sample_(g, sample);
+
+            const neuton_status_t status = neuton_nn_multirate_feed_inputs(&multirate_, g, sample, GROUP_AXES_NUM);
+
+            if (is_collected_(g))
+                ready_mask |= 1UL << g;
+
+            zassert_equal(multirate_.ready_mask, ready_mask, "group %u, sample %u", g, n);
+            zassert_equal(status, (ready_mask == all_mask) ? NEUTON_STATUS_SUCCESS : NEUTON_STATUS_INPROGRESS,
+                          "group %u, sample %u", g, n);
+
+            if (status != NEUTON_STATUS_SUCCESS)
+                continue;
+
+            /* Model features are scaled in place by the inference, so they are checked before it */
+            for (uint32_t c = 0; c < GROUPS_NUM; c++)
+            {
+                const neuton_u16_t num = check_dsp_[c].features.overall_num;
+
+                zassert_equal(extract_features_i16(&inputs_[c], &check_dsp_[c]), num);
+                zassert_mem_equal(&p_features[multirate_.groups[c].features_offset], check_features_,
+                                  num * sizeof(neuton_i32_t), "group %u, tick %u", c, ticks);
+            }
+
+            zassert_equal(neuton_nn_multirate_run_inference(&multirate_), NEUTON_STATUS_SUCCESS);
+            zassert_equal(multirate_.ready_mask, 0);
+
+            ready_mask = 0;
+            ticks++;
+        }
+    }
+
+    zassert_equal(multirate_.overruns_num, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Group window collected twice before the tick is complete is an overrun, the tick is still incomplete */
+ZTEST(neuton_nn_multirate, test_overrun)
+{
+    const uint32_t      fast       = GROUPS_NUM - 1;
+    const neuton_u16_t  num        = window_size_(fast) + window_shift_(fast);
+    const neuton_i32_t* p_features = multirate_.p_nn->p_dsp->features.extracted_memory.p_i32;
+
+    zassert_equal(neuton_nn_multirate_setup(&multirate_), NEUTON_STATUS_SUCCESS);
+
+    for (neuton_u16_t i = 0; i < num; i++)
+        group_sample_(fast, &samples_[i * GROUP_AXES_NUM]);
+
+    zassert_equal(neuton_nn_multirate_feed_inputs(&multirate_, fast, samples_, num * GROUP_AXES_NUM),
+                  NEUTON_STATUS_INPROGRESS);
+    zassert_equal(multirate_.ready_mask, 1UL << fast);
+    zassert_equal(multirate_.overruns_num, 1);
+    zassert_equal(neuton_nn_multirate_run_inference(&multirate_), NEUTON_STATUS_INPROGRESS);
+
+    /* Newest window features are used */
+    const neuton_u16_t features_num = check_dsp_[fast].features.overall_num;
+
+    zassert_equal(extract_features_i16(&inputs_[fast], &check_dsp_[fast]), features_num);
+    zassert_mem_equal(&p_features[multirate_.groups[fast].features_offset], check_features_,
+                      features_num * sizeof(neuton_i32_t));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_multirate, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,289 @@
+/*
+ * Extracted features pruning test: a copy of the reference model gets a synthetic feature that no neuron
+ * is linked to, the copy should predict the same as the reference model, and pruning of the copy
+ * should give back the reference masks, scaling factors and links with the same predictions.
+ */
+#include "models.h"
+#include "test_random.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/private/features/neuton_nn_features_prune.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define FEATURES_MAX        (64U)
+#define NEURONS_MAX         (64U)
+#define LINKS_MAX           (1024U)
+#define MASKS_MAX           (8U)
+#define VECTORS_NUM         (500U)
+
+/** Synthetic feature is the range of the third input axis, that is not extracted by the shipped model */
+#define SYNTH_MASK          (2U)
+#define SYNTH_BIT           (NEUTON_NN_FEATURE_RANGE)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_t*                 p_ref_;
+static neuton_nn_t                  copy_;
+static neuton_nn_dsp_pipeline_t     copy_dsp_;
+static neuton_dsp_scale_plan_t      copy_plan_;
+static neuton_dsp_scale_plan_item_t copy_plan_items_[FEATURES_MAX];
+static neuton_nn_features_mask_t    copy_masks_[MASKS_MAX];
+static neuton_i32_t                 copy_min_[FEATURES_MAX];
+static neuton_i32_t                 copy_max_[FEATURES_MAX];
+static neuton_u16_t                 copy_links_[LINKS_MAX];
+static neuton_i32_t                 copy_features_[FEATURES_MAX];
+static neuton_u16_t                 copy_neurons_[NEURONS_MAX];
+static neuton_u16_t                 synth_;
+static uint32_t                     random_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_u16_t bits_num_(neuton_u32_t mask)
+{
+    neuton_u16_t num = 0;
+
+    for (; mask != 0; mask &= mask - 1U)
+        num++;
+
+    return num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Features extraction context of the copy with its masks, scaling factors and features buffer */
+static void set_copy_features_num_(neuton_u16_t features_num)
+{
+    const neuton_nn_dsp_feature_extraction_t* p_ref = &p_ref_->p_dsp->features;
+
+    const neuton_nn_dsp_feature_extraction_t features = {
+        .extracted_memory.p_i32 = copy_features_,
+        .meta.i32.p_min         = copy_min_,
+        .meta.i32.p_max         = copy_max_,
+        .meta.i32.p_arguments   = p_ref->meta.i32.p_arguments,
+        .overall_num            = features_num,
+        .masks_num              = p_ref->masks_num,
+        .p_masks                = copy_masks_,
+        .p_timedomain_pipeline  = p_ref->p_timedomain_pipeline,
+        .p_freqdomain_pipeline  = p_ref->p_freqdomain_pipeline,
+    };
+
+    memcpy(&copy_dsp_.features, &features, sizeof(features));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Copy of the reference model with the synthetic feature inserted at synth_ of the extracted features,
+ * following external links and the bias input are shifted by one
+ */
+static void make_copy_(void)
+{
+    const neuton_nn_dsp_pipeline_t* p_dsp        = p_ref_->p_dsp;
+    const neuton_nn_model_meta_t*   p_meta       = &p_ref_->model.meta;
+    const neuton_u16_t              features_num = p_dsp->features.overall_num;
+
+    zassert_true(features_num < FEATURES_MAX);
+    zassert_true(p_meta->neurons_num <= NEURONS_MAX);
+    zassert_true(p_meta->weights_num <= LINKS_MAX);
+    zassert_true(p_dsp->features.masks_num <= MASKS_MAX);
+    zassert_false(p_dsp->features.p_masks[SYNTH_MASK].domain.time.all & (1UL << SYNTH_BIT));
+
+    memcpy(copy_masks_, p_dsp->features.p_masks, p_dsp->features.masks_num * sizeof(copy_masks_[0]));
+    copy_masks_[SYNTH_MASK].domain.time.all |= 1UL << SYNTH_BIT;
+
+    /* Features are extracted mask by mask in order of the mask bits */
+    synth_ = bits_num_(copy_masks_[SYNTH_MASK].domain.time.all & ((1UL << SYNTH_BIT) - 1U));
+
+    for (neuton_u16_t m = 0; m < SYNTH_MASK; m++)
+        synth_ += bits_num_(copy_masks_[m].domain.time.all);
+
+    for (neuton_u16_t i = 0; i < features_num; i++)
+    {
+        copy_min_[i + (i >= synth_)] = p_dsp->features.meta.i32.p_min[i];
+        copy_max_[i + (i >= synth_)] = p_dsp->features.meta.i32.p_max[i];
+    }
+
+    copy_min_[synth_] = -1000;
+    copy_max_[synth_] = 1000;
+
+    neuton_u32_t link = 0;
+
+    for (neuton_u16_t n = 0; n < p_meta->neurons_num; n++)
+    {
+        for (; link < p_meta->p_neuron_internal_links_num[n]; link++)
+            copy_links_[link] = p_meta->p_neuron_links[link];
+
+        for (; link < p_meta->p_neuron_external_links_num[n]; link++)
+        {
+            const neuton_u16_t input = p_meta->p_neuron_links[link];
+
+            copy_links_[link] = (input >= features_num) ? (neuton_u16_t)(features_num + 1U) : input + (input >= synth_);
+        }
+    }
+
+    copy_plan_.p_items   = copy_plan_items_;
+    copy_plan_.items_num = 0;
+
+    /* Models have constant members, so the copies are taken by memory */
+    memcpy(&copy_dsp_, p_dsp, sizeof(copy_dsp_));
+    copy_dsp_.p_scale_plan = &copy_plan_;
+    set_copy_features_num_(features_num + 1U);
+
+    memcpy(&copy_, p_ref_, sizeof(copy_));
+    copy_.p_dsp                      = &copy_dsp_;
+    copy_.model.meta.p_neuron_links  = copy_links_;
+    copy_.model.params.q16.p_neurons = copy_neurons_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random unscaled features in [min - range, max + range] are run through the reference model
+ * and the copy, with the random synthetic feature while it is not pruned
+ */
+static void check_predictions_(bool is_pruned)
+{
+    const neuton_nn_features_meta_i32_t* p_meta       = &p_ref_->p_dsp->features.meta.i32;
+    const neuton_u16_t                   features_num = p_ref_->p_dsp->features.overall_num;
+    neuton_i32_t*                        p_features   = p_ref_->p_dsp->features.extracted_memory.p_i32;
+
+    neuton_nn_features_scale_reset(p_ref_->p_dsp);
+    neuton_nn_features_scale_reset(&copy_dsp_);
+
+    for (uint32_t v = 0; v < VECTORS_NUM; v++)
+    {
+        for (neuton_u16_t i = 0; i < features_num; i++)
+        {
+            const neuton_i32_t range = p_meta->p_max[i] - p_meta->p_min[i];
+
+            p_features[i] = p_meta->p_min[i] - range + test_random_range(&random_, 0, 3 * range);
+            copy_features_[i + (!is_pruned && (i >= synth_))] = p_features[i];
+        }
+
+        if (!is_pruned)
+            copy_features_[synth_] = test_random_range(&random_, -4000, 4000);
+
+        zassert_equal(neuton_nn_features_scale_q16(p_ref_->p_dsp), NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_nn_features_scale_q16(&copy_dsp_), NEUTON_STATUS_SUCCESS);
+
+        p_ref_->interfaces.run_inference(p_ref_);
+        copy_.interfaces.run_inference(&copy_);
+
+        zassert_mem_equal(copy_neurons_, p_ref_->model.params.q16.p_neurons,
+                          p_ref_->model.meta.neurons_num * sizeof(neuton_u16_t), "vector %u", v);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    p_ref_  = reference_user_model();
+
+    zassert_equal(neuton_nn_setup(p_ref_), NEUTON_STATUS_SUCCESS);
+    make_copy_();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Synthetic feature is not reachable from the outputs, so the copy predicts as the reference model */
+ZTEST(neuton_nn_features_prune, test_unreachable_feature)
+{
+    const neuton_u16_t inputs_num = copy_dsp_.features.overall_num;
+    neuton_u8_t        used_inputs[(FEATURES_MAX + 7U) / 8U];
+    neuton_u8_t        used_neurons[(NEURONS_MAX + 7U) / 8U];
+    neuton_u8_t        ref_used_neurons[(NEURONS_MAX + 7U) / 8U];
+
+    check_predictions_(false);
+
+    zassert_equal(neuton_nn_model_used_inputs(&p_ref_->model, inputs_num - 1U, used_inputs, ref_used_neurons),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_model_used_inputs(&copy_.model, inputs_num, used_inputs, used_neurons),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_mem_equal(used_neurons, ref_used_neurons, (copy_.model.meta.neurons_num + 7U) / 8U);
+
+    for (neuton_u16_t i = 0; i < inputs_num; i++)
+    {
+        const bool is_used = (used_inputs[i / 8U] >> (i % 8U)) & 1U;
+
+        zassert_equal(is_used, i != synth_, "feature %u", i);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Pruned copy has the reference masks, scaling factors and links, and predicts as the reference model */
+ZTEST(neuton_nn_features_prune, test_prune_copy)
+{
+    const neuton_nn_dsp_pipeline_t* p_dsp        = p_ref_->p_dsp;
+    const neuton_u16_t              features_num = copy_dsp_.features.overall_num;
+    neuton_u8_t                     used_inputs[(FEATURES_MAX + 7U) / 8U];
+    neuton_u8_t                     used_neurons[(NEURONS_MAX + 7U) / 8U];
+    neuton_u16_t                    index_map[FEATURES_MAX];
+    neuton_u16_t                    pruned_num = 0;
+
+    zassert_equal(neuton_nn_model_used_inputs(&copy_.model, features_num, used_inputs, used_neurons),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_features_prune(copy_masks_, copy_dsp_.features.masks_num, used_inputs, features_num,
+                                           copy_masks_, index_map, &pruned_num),
+                  NEUTON_STATUS_SUCCESS);
+
+    zassert_equal(pruned_num, p_dsp->features.overall_num);
+    zassert_mem_equal(copy_masks_, p_dsp->features.p_masks, p_dsp->features.masks_num * sizeof(copy_masks_[0]));
+
+    for (neuton_u16_t i = 0; i < features_num; i++)
+    {
+        const neuton_u16_t expected = (i == synth_) ? NEUTON_NN_FEATURE_PRUNED : i - (i > synth_);
+
+        zassert_equal(index_map[i], expected, "feature %u", i);
+    }
+
+    zassert_equal(neuton_nn_features_compact(copy_min_, copy_min_, sizeof(neuton_i32_t), index_map, features_num),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_equal(neuton_nn_features_compact(copy_max_, copy_max_, sizeof(neuton_i32_t), index_map, features_num),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_mem_equal(copy_min_, p_dsp->features.meta.i32.p_min, pruned_num * sizeof(neuton_i32_t));
+    zassert_mem_equal(copy_max_, p_dsp->features.meta.i32.p_max, pruned_num * sizeof(neuton_i32_t));
+
+    zassert_equal(neuton_nn_model_remap_inputs(&copy_.model, index_map, features_num, pruned_num, copy_links_),
+                  NEUTON_STATUS_SUCCESS);
+    zassert_mem_equal(copy_links_, p_ref_->model.meta.p_neuron_links,
+                      p_ref_->model.meta.weights_num * sizeof(neuton_u16_t));
+
+    set_copy_features_num_(pruned_num);
+    check_predictions_(true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_nn_features_prune, test_invalid_arguments)
+{
+    neuton_nn_features_mask_t mask = copy_masks_[0];
+    neuton_u8_t               used[(FEATURES_MAX + 7U) / 8U];
+    neuton_u16_t              index_map[FEATURES_MAX];
+    neuton_u16_t              pruned_num;
+
+    memset(used, 0xFF, sizeof(used));
+
+    zassert_equal(neuton_nn_model_used_inputs(NULL, 1, used, used), NEUTON_STATUS_NULL_ARGUMENT);
+    zassert_equal(neuton_nn_features_prune(&mask, 1, used, FEATURES_MAX, &mask, index_map, &pruned_num),
+                  NEUTON_STATUS_INVALID_ARGUMENT, "features number does not match the mask");
+
+    mask.domain.freq.all = 1;
+    zassert_equal(neuton_nn_features_prune(&mask, 1, used, bits_num_(mask.domain.time.all), &mask, index_map,
+                                           &pruned_num),
+                  NEUTON_STATUS_NOT_SUPPORTED);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_features_prune, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,255 @@
+/*
+ * Quantization statistics test: the interleaved quantization to INT8, INT16 and INT32 with the saturation
+ * counters and the scale adaptation is compared with the scalar quantization of each element,
+ * on random values in and out of the range, infinities and NaN.
+ */
+#include "test_random.h"
+
+#include <neuton/dsp/support/neuton_dsp_quantization_stats.h>
+#include <neuton/private/neuton_defs.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define CHANNELS_MAX        (6U)
+#define FRAMES_MAX          (64U)
+#define NUM_MAX             (FRAMES_MAX * CHANNELS_MAX + CHANNELS_MAX - 1U)
+#define BLOCKS_NUM          (20U)
+#define ADAPT_THRESHOLD     (4U)
+#define OUTPUT_SENTINEL     (0x5A)
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    OUTPUT_I8,
+    OUTPUT_I16,
+    OUTPUT_I32,
+    OUTPUT_cnt
+} output_t;
+
+static const neuton_u16_t CHANNELS_[] = { 1, 3, CHANNELS_MAX };
+static const neuton_u16_t FRAMES_[]   = { 1, 3, 4, 17, FRAMES_MAX };
+static const double       MIN_[]      = { NEUTON_INT8_MIN, NEUTON_INT16_MIN, (double)NEUTON_INT32_MIN };
+static const double       MAX_[]      = { NEUTON_INT8_MAX, NEUTON_INT16_MAX, (double)NEUTON_INT32_MAX };
+
+static uint32_t                    random_;
+static neuton_f32_t                input_[NUM_MAX];
+static neuton_i8_t                 out_i8_[NUM_MAX];
+static neuton_i16_t                out_i16_[NUM_MAX];
+static neuton_i32_t                out_i32_[NUM_MAX];
+static neuton_f32_t                scales_[CHANNELS_MAX];
+static neuton_u32_t                saturated_num_[CHANNELS_MAX];
+static neuton_dsp_quantize_stats_t stats_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Mostly values in the output range, some out of it, infinities and NaN */
+static void fill_input_(neuton_u16_t num, output_t output, neuton_f32_t scale)
+{
+    for (neuton_u16_t i = 0; i < num; i++)
+    {
+        const uint32_t kind = test_random_next(&random_) % 32U;
+        const float    unit = 2.0f * test_random_unit(&random_) - 1.0f;
+
+        if (kind == 0)
+            input_[i] = NAN;
+        else if (kind == 1)
+            input_[i] = (unit > 0.0f) ? INFINITY : -INFINITY;
+        else if (kind < 6)
+            input_[i] = (neuton_f32_t)(4.0 * unit * MAX_[output] / scale);
+        else
+            input_[i] = (neuton_f32_t)(unit * MAX_[output] / scale);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void quantize_(output_t output, neuton_u16_t num)
+{
+    if (output == OUTPUT_I8)
+        neuton_dsp_quantize_stats_f32_to_i8(input_, out_i8_, num, &stats_);
+    else if (output == OUTPUT_I16)
+        neuton_dsp_quantize_stats_f32_to_i16(input_, out_i16_, num, &stats_);
+    else
+        neuton_dsp_quantize_stats_f32_to_i32(input_, out_i32_, num, &stats_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_i32_t output_(output_t output, neuton_u16_t index)
+{
+    if (output == OUTPUT_I8)
+        return out_i8_[index];
+
+    return (output == OUTPUT_I16) ? out_i16_[index] : out_i32_[index];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Scalar quantization in double precision of the single precision scaled value, the element is saturated
+ * if its rounded value is out of the output range, NaN is saturated to 0
+ */
+static neuton_i32_t reference_(output_t output, neuton_f32_t scaled, bool* p_saturated)
+{
+    *p_saturated = true;
+
+    if (isnan(scaled))
+        return 0;
+
+    const double rounded = NEUTON_USE_MATH_ROUNDING ? round((double)scaled) : trunc((double)scaled);
+
+    if (rounded > MAX_[output])
+        return (neuton_i32_t)MAX_[output];
+
+    if (rounded < MIN_[output])
+        return (neuton_i32_t)MIN_[output];
+
+    *p_saturated = false;
+
+    return (neuton_i32_t)rounded;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Blocks of random frames with a trailing partial frame are quantized with the adaptation,
+ * each element, the saturation counters and the channel scales are checked after each block
+ */
+static void check_(output_t output, neuton_u16_t channels, neuton_u16_t frames)
+{
+    const neuton_f32_t scale     = (neuton_f32_t)MAX_[output];
+    const neuton_u16_t num       = frames * channels;
+    const neuton_u16_t trailing  = channels - 1U;
+    neuton_u32_t       saturated[CHANNELS_MAX] = { 0 };
+    neuton_f32_t       scales[CHANNELS_MAX];
+    neuton_u16_t       adaptations = 0;
+
+    zassert_equal(neuton_dsp_quantize_stats_init(&stats_, scales_, saturated_num_, channels, scale, ADAPT_THRESHOLD),
+                  NEUTON_STATUS_SUCCESS);
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+        scales[ch] = scale;
+
+    for (uint32_t block = 0; block < BLOCKS_NUM; block++)
+    {
+        fill_input_(num + trailing, output, scale);
+
+        memset(out_i8_, OUTPUT_SENTINEL, sizeof(out_i8_));
+        memset(out_i16_, OUTPUT_SENTINEL, sizeof(out_i16_));
+        memset(out_i32_, OUTPUT_SENTINEL, sizeof(out_i32_));
+
+        quantize_(output, num + trailing);
+
+        for (neuton_u16_t ch = 0; ch < channels; ch++)
+        {
+            neuton_u32_t block_saturated = 0;
+
+            for (neuton_u16_t f = 0; f < frames; f++)
+            {
+                const neuton_u16_t i = f * channels + ch;
+                bool               is_saturated;
+
+                zassert_equal(output_(output, i), reference_(output, input_[i] * scales[ch], &is_saturated),
+                              "output %u, channels %u, frame %u, channel %u, input %f", output, channels, f, ch,
+                              (double)input_[i]);
+
+                block_saturated += is_saturated ? 1U : 0;
+            }
+
+            saturated[ch] += block_saturated;
+
+            if (block_saturated >= ADAPT_THRESHOLD)
+            {
+                scales[ch] *= NEUTON_DSP_QUANTIZE_ADAPT_FACTOR;
+                adaptations++;
+            }
+
+            zassert_equal(saturated_num_[ch], saturated[ch], "block %u, channel %u", block, ch);
+            zassert_equal(scales_[ch], scales[ch], "block %u, channel %u", block, ch);
+        }
+
+        /* Partial frame is not written */
+        for (neuton_u16_t i = num; i < num + trailing; i++)
+        {
+            neuton_i32_t sentinel;
+
+            memset(&sentinel, OUTPUT_SENTINEL, sizeof(sentinel));
+            zassert_equal(output_(output, i), (output == OUTPUT_I8) ? (neuton_i8_t)sentinel :
+                                              (output == OUTPUT_I16) ? (neuton_i16_t)sentinel : sentinel,
+                          "trailing sample %u", i);
+        }
+
+        zassert_equal(stats_.frames_num, (block + 1U) * frames);
+        zassert_equal(stats_.adaptations_num, adaptations);
+    }
+
+    for (neuton_u16_t ch = 0; ch < channels; ch++)
+    {
+        zassert_within(neuton_dsp_quantize_stats_saturation_ratio(&stats_, ch),
+                       (neuton_f32_t)saturated[ch] / (neuton_f32_t)stats_.frames_num, 1e-6f);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_quantize_stats, test_vs_scalar)
+{
+    for (uint32_t output = 0; output < OUTPUT_cnt; output++)
+    {
+        for (size_t c = 0; c < ARRAY_SIZE(CHANNELS_); c++)
+        {
+            for (size_t f = 0; f < ARRAY_SIZE(FRAMES_); f++)
+                check_((output_t)output, CHANNELS_[c], FRAMES_[f]);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_quantize_stats, test_nan_and_bounds)
+{
+    /* Values are quantized the same with the truncation and the rounding */
+    static const neuton_f32_t VALUES[]    = { NAN, -NAN, INFINITY, -INFINITY, 1e30f, -1e30f, 32767.0f, 32767.4f,
+                                              32768.0f, -32768.0f, -32768.4f, -32769.0f, 0.0f, -0.4f };
+    static const neuton_i16_t EXPECTED[]  = { 0, 0, NEUTON_INT16_MAX, NEUTON_INT16_MIN, NEUTON_INT16_MAX,
+                                              NEUTON_INT16_MIN, 32767, 32767, NEUTON_INT16_MAX, -32768, -32768,
+                                              NEUTON_INT16_MIN, 0, 0 };
+    static const bool         SATURATED[] = { true, true, true, true, true, true, false, false,
+                                              true, false, false, true, false, false };
+
+    zassert_equal(neuton_dsp_quantize_stats_init(&stats_, scales_, saturated_num_, 1, 1.0f, 0),
+                  NEUTON_STATUS_SUCCESS);
+
+    memcpy(input_, VALUES, sizeof(VALUES));
+    neuton_dsp_quantize_stats_f32_to_i16(input_, out_i16_, ARRAY_SIZE(VALUES), &stats_);
+
+    neuton_u32_t saturated = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(VALUES); i++)
+    {
+        zassert_equal(out_i16_[i], EXPECTED[i], "value %f", (double)VALUES[i]);
+        saturated += SATURATED[i] ? 1U : 0;
+    }
+
+    zassert_equal(saturated_num_[0], saturated);
+    zassert_equal(stats_.adaptations_num, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_quantize_stats, NULL, NULL, before_, NULL, NULL);
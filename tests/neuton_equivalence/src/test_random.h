@@ -0,0 +1,28 @@
+/*
+ * Pseudo-random inputs of the test suites, each suite keeps its own generator state
+ */
+#ifndef _NEUTON_EQUIVALENCE_TEST_RANDOM_H_
+#define _NEUTON_EQUIVALENCE_TEST_RANDOM_H_
+
+#include <stdint.h>
+
+/** Linear congruential generator, 24 upper bits of the state */
+static inline uint32_t test_random_next(uint32_t* p_state)
+{
+    *p_state = *p_state * 1664525U + 1013904223U;
+    return *p_state >> 8;
+}
+
+/** Uniform random value in [min, max] */
+static inline int32_t test_random_range(uint32_t* p_state, int32_t min, int32_t max)
+{
+    return min + (int32_t)(test_random_next(p_state) % (uint32_t)(max - min + 1));
+}
+
+/** Uniform random value in [0, 1) */
+static inline float test_random_unit(uint32_t* p_state)
+{
+    return (float)test_random_next(p_state) / (float)(1U << 24);
+}
+
+#endif /* _NEUTON_EQUIVALENCE_TEST_RANDOM_H_ */
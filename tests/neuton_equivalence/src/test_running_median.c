@@ -0,0 +1,310 @@
+/*
+ * Running median test: the heap based median, MAD, median and Hampel filters are compared
+ * with the median of the sorted copy of the same sliding window, including the window filling.
+ */
+#include "test_random.h"
+
+#include <neuton/dsp/support/neuton_dsp_running_median.h>
+#include <neuton/private/neuton_defs.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define WINDOW_MAX          (33U)
+#define STREAM_LEN          (300U)
+#define AXES_NUM            (3U)
+
+/** Hampel threshold of 3 standard deviations of normal distribution in MAD units */
+#define HAMPEL_THRESHOLD    (4.448f)
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Reference sliding window of the last samples */
+typedef struct
+{
+    neuton_f32_t samples[WINDOW_MAX];
+    neuton_u16_t window;
+    neuton_u16_t count;
+    neuton_u16_t index;
+} window_ref_t;
+
+//////////////////////////////////////////////////////////////////////////////
+
+static const neuton_u16_t WINDOWS_[] = { 1, 2, 5, 16, WINDOW_MAX };
+
+static uint32_t     random_;
+static neuton_i16_t stream_i16_[STREAM_LEN * AXES_NUM];
+static neuton_f32_t stream_f32_[STREAM_LEN * AXES_NUM];
+static neuton_u32_t pool_[2U * NEUTON_DSP_RUNNING_MAD_POOL_SIZE(WINDOW_MAX, neuton_f32_t) / sizeof(neuton_u32_t)];
+static neuton_u32_t median_pool_[AXES_NUM][NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(WINDOW_MAX, neuton_f32_t) /
+                                           sizeof(neuton_u32_t)];
+static neuton_u32_t mad_pool_[AXES_NUM][NEUTON_DSP_RUNNING_MAD_POOL_SIZE(WINDOW_MAX, neuton_f32_t) /
+                                        sizeof(neuton_u32_t)];
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random stream with many equal samples and rare spikes, values are multiples of 4,
+ * so the means of two middle samples are the same in INT16 and floating-point
+ */
+static void fill_stream_(void)
+{
+    for (neuton_u32_t i = 0; i < STREAM_LEN * AXES_NUM; i++)
+    {
+        neuton_i32_t value = 4 * test_random_range(&random_, -50, 50);
+
+        if ((test_random_next(&random_) % 16U) == 0)
+            value = 4 * test_random_range(&random_, -8000, 8000);
+
+        stream_i16_[i] = (neuton_i16_t)value;
+        stream_f32_[i] = (neuton_f32_t)value;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void window_ref_init_(window_ref_t* p_ref, neuton_u16_t window)
+{
+    memset(p_ref, 0, sizeof(*p_ref));
+    p_ref->window = window;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Push the sample and return the median of the sorted copy of the window */
+static neuton_f32_t window_ref_update_(window_ref_t* p_ref, neuton_f32_t x, bool is_i16)
+{
+    neuton_f32_t sorted[WINDOW_MAX];
+
+    p_ref->samples[p_ref->index] = x;
+    p_ref->index                 = (neuton_u16_t)((p_ref->index + 1U) % p_ref->window);
+    p_ref->count                 = (neuton_u16_t)MIN(p_ref->count + 1U, p_ref->window);
+
+    memcpy(sorted, p_ref->samples, p_ref->count * sizeof(sorted[0]));
+
+    for (neuton_u16_t i = 1; i < p_ref->count; i++)
+    {
+        const neuton_f32_t value = sorted[i];
+        neuton_u16_t       j     = i;
+
+        for (; (j > 0) && (sorted[j - 1] > value); j--)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = value;
+    }
+
+    const neuton_u16_t middle = p_ref->count / 2U;
+
+    if (p_ref->count & 1U)
+        return sorted[middle];
+
+    /* INT16 mean of two middle samples is rounded down */
+    return is_i16 ? floorf((sorted[middle - 1] + sorted[middle]) * 0.5f)
+                  : (sorted[middle - 1] + sorted[middle]) * 0.5f;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    fill_stream_();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_running_median, test_median_vs_sorted_window)
+{
+    for (size_t w = 0; w < ARRAY_SIZE(WINDOWS_); w++)
+    {
+        const neuton_u16_t              window = WINDOWS_[w];
+        neuton_dsp_running_median_ctx_t ctx_i16;
+        neuton_dsp_running_median_ctx_t ctx_f32;
+        window_ref_t                    ref_i16;
+        window_ref_t                    ref_f32;
+
+        zassert_equal(neuton_dsp_running_median_init_i16(&ctx_i16, window, pool_, sizeof(pool_) / 2U),
+                      NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_dsp_running_median_init_f32(&ctx_f32, window, &pool_[ARRAY_SIZE(pool_) / 2U],
+                                                         sizeof(pool_) / 2U),
+                      NEUTON_STATUS_SUCCESS);
+        window_ref_init_(&ref_i16, window);
+        window_ref_init_(&ref_f32, window);
+
+        for (neuton_u32_t i = 0; i < STREAM_LEN; i++)
+        {
+            const neuton_f32_t expected_i16 = window_ref_update_(&ref_i16, stream_f32_[i], true);
+            const neuton_f32_t expected_f32 = window_ref_update_(&ref_f32, stream_f32_[i], false);
+
+            zassert_equal(neuton_dsp_running_median_update_i16(&ctx_i16, stream_i16_[i]), (neuton_i16_t)expected_i16,
+                          "window %u sample %u", window, i);
+            zassert_equal(neuton_dsp_running_median_update_f32(&ctx_f32, stream_f32_[i]), expected_f32,
+                          "window %u sample %u", window, i);
+        }
+
+        /* Reset starts the window filling again */
+        neuton_dsp_running_median_reset(&ctx_i16);
+        window_ref_init_(&ref_i16, window);
+
+        for (neuton_u32_t i = 0; i < 2U * window; i++)
+        {
+            const neuton_f32_t expected = window_ref_update_(&ref_i16, stream_f32_[i], true);
+
+            zassert_equal(neuton_dsp_running_median_update_i16(&ctx_i16, stream_i16_[i]), (neuton_i16_t)expected,
+                          "window %u sample %u after reset", window, i);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** MAD is the median of the deviations from the median at the moment each sample arrived */
+ZTEST(neuton_dsp_running_median, test_mad_vs_sorted_window)
+{
+    for (size_t w = 0; w < ARRAY_SIZE(WINDOWS_); w++)
+    {
+        const neuton_u16_t           window = WINDOWS_[w];
+        neuton_dsp_running_mad_ctx_t ctx;
+        window_ref_t                 ref_median;
+        window_ref_t                 ref_deviation;
+
+        zassert_equal(neuton_dsp_running_mad_init_i16(&ctx, window, pool_, sizeof(pool_)), NEUTON_STATUS_SUCCESS);
+        window_ref_init_(&ref_median, window);
+        window_ref_init_(&ref_deviation, window);
+
+        for (neuton_u32_t i = 0; i < STREAM_LEN; i++)
+        {
+            const neuton_f32_t expected_median = window_ref_update_(&ref_median, stream_f32_[i], true);
+            const neuton_f32_t expected_mad    = window_ref_update_(
+                &ref_deviation, MIN(fabsf(stream_f32_[i] - expected_median), (neuton_f32_t)NEUTON_INT16_MAX), true);
+            neuton_i16_t median;
+
+            zassert_equal(neuton_dsp_running_mad_update_i16(&ctx, stream_i16_[i], &median),
+                          (neuton_i16_t)expected_mad, "window %u sample %u", window, i);
+            zassert_equal(median, (neuton_i16_t)expected_median, "window %u sample %u", window, i);
+        }
+
+        zassert_equal(neuton_dsp_running_mad_init_f32(&ctx, window, pool_, sizeof(pool_)), NEUTON_STATUS_SUCCESS);
+        window_ref_init_(&ref_median, window);
+        window_ref_init_(&ref_deviation, window);
+
+        for (neuton_u32_t i = 0; i < STREAM_LEN; i++)
+        {
+            const neuton_f32_t expected_median = window_ref_update_(&ref_median, stream_f32_[i], false);
+            const neuton_f32_t expected_mad =
+                window_ref_update_(&ref_deviation, fabsf(stream_f32_[i] - expected_median), false);
+
+            zassert_equal(neuton_dsp_running_mad_update_f32(&ctx, stream_f32_[i], NULL), expected_mad,
+                          "window %u sample %u", window, i);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Axes of the interleaved stream are filtered in chunks, the window state is kept between the calls */
+ZTEST(neuton_dsp_running_median, test_filters_strided)
+{
+    const neuton_u16_t              window = 5;
+    neuton_dsp_running_median_ctx_t median_ctx[AXES_NUM];
+    neuton_dsp_running_mad_ctx_t    mad_ctx[AXES_NUM];
+    static neuton_i16_t             median_i16[STREAM_LEN * AXES_NUM];
+    static neuton_i16_t             hampel_i16[STREAM_LEN * AXES_NUM];
+    static neuton_f32_t             hampel_f32[STREAM_LEN * AXES_NUM];
+    neuton_u32_t                    replaced_i16 = 0;
+    neuton_u32_t                    replaced_f32 = 0;
+    neuton_u32_t                    expected_replaced = 0;
+
+    memcpy(median_i16, stream_i16_, sizeof(median_i16));
+    memcpy(hampel_i16, stream_i16_, sizeof(hampel_i16));
+    memcpy(hampel_f32, stream_f32_, sizeof(hampel_f32));
+
+    for (neuton_u16_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        zassert_equal(neuton_dsp_running_median_init_i16(&median_ctx[axis], window, median_pool_[axis],
+                                                         sizeof(median_pool_[axis])),
+                      NEUTON_STATUS_SUCCESS);
+        zassert_equal(neuton_dsp_running_mad_init_i16(&mad_ctx[axis], window, mad_pool_[axis],
+                                                      sizeof(mad_pool_[axis])),
+                      NEUTON_STATUS_SUCCESS);
+    }
+
+    for (neuton_u32_t start = 0; start < STREAM_LEN;)
+    {
+        const neuton_u16_t num = (neuton_u16_t)MIN(1U + test_random_next(&random_) % 40U, STREAM_LEN - start);
+
+        for (neuton_u16_t axis = 0; axis < AXES_NUM; axis++)
+        {
+            const neuton_u32_t offset = start * AXES_NUM + axis;
+
+            neuton_dsp_median_filter_i16_s(&median_ctx[axis], &median_i16[offset], num, AXES_NUM);
+            replaced_i16 += neuton_dsp_hampel_filter_i16_s(&mad_ctx[axis], &hampel_i16[offset], num, AXES_NUM,
+                                                           (neuton_u16_t)(HAMPEL_THRESHOLD *
+                                                                          NEUTON_PERCENTAGE_TO_INT_FACTOR));
+        }
+        start += num;
+    }
+
+    for (neuton_u16_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        zassert_equal(neuton_dsp_running_mad_init_f32(&mad_ctx[axis], window, mad_pool_[axis],
+                                                      sizeof(mad_pool_[axis])),
+                      NEUTON_STATUS_SUCCESS);
+        replaced_f32 += neuton_dsp_hampel_filter_f32_s(&mad_ctx[axis], &hampel_f32[axis], STREAM_LEN, AXES_NUM,
+                                                       HAMPEL_THRESHOLD);
+    }
+
+    for (neuton_u16_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        window_ref_t ref_median;
+        window_ref_t ref_deviation;
+
+        window_ref_init_(&ref_median, window);
+        window_ref_init_(&ref_deviation, window);
+
+        for (neuton_u32_t i = 0; i < STREAM_LEN; i++)
+        {
+            const neuton_u32_t k         = i * AXES_NUM + axis;
+            const neuton_f32_t median    = window_ref_update_(&ref_median, stream_f32_[k], true);
+            const neuton_f32_t deviation = fabsf(stream_f32_[k] - median);
+            const neuton_f32_t mad       = window_ref_update_(&ref_deviation, deviation, true);
+            const bool         is_spike  = deviation > HAMPEL_THRESHOLD * mad;
+
+            expected_replaced += is_spike;
+
+            zassert_equal(median_i16[k], (neuton_i16_t)median, "axis %u sample %u", axis, i);
+            zassert_equal(hampel_i16[k], is_spike ? (neuton_i16_t)median : stream_i16_[k], "axis %u sample %u",
+                          axis, i);
+            zassert_equal(hampel_f32[k], (neuton_f32_t)hampel_i16[k], "axis %u sample %u", axis, i);
+        }
+    }
+
+    zassert_true(expected_replaced > 0, "stream has no spikes");
+    zassert_equal(replaced_i16, expected_replaced);
+    zassert_equal(replaced_f32, expected_replaced);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST(neuton_dsp_running_median, test_init_invalid_arguments)
+{
+    neuton_dsp_running_median_ctx_t ctx;
+
+    zassert_equal(neuton_dsp_running_median_init_i16(&ctx, 16, pool_,
+                                                     NEUTON_DSP_RUNNING_MEDIAN_POOL_SIZE(16, neuton_i16_t) - 1U),
+                  NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_equal(neuton_dsp_running_median_init_i16(&ctx, 0, pool_, sizeof(pool_)), NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_equal(neuton_dsp_running_median_init_f32(&ctx, 16, (neuton_u8_t*)pool_ + 2, sizeof(pool_) - 2U),
+                  NEUTON_STATUS_WRONG_MEM_ALIGNMENT);
+    zassert_equal(neuton_dsp_running_median_init_f32(NULL, 16, pool_, sizeof(pool_)), NEUTON_STATUS_NULL_ARGUMENT);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_dsp_running_median, NULL, NULL, before_, NULL, NULL);
@@ -0,0 +1,220 @@
+/*
+ * Multi-model runtime test: the shipped, fused scaling and 8-bit weights models share the input window
+ * and the features cache, features and outputs of each model taken from the runtime should be the same
+ * as of the single model features processing and inference on the same window.
+ */
+#include "models.h"
+#include "test_random.h"
+
+#include <neuton/neuton.h>
+#include <neuton/nn/neuton_nn_runtime.h>
+#include <neuton/nn/private/features/neuton_nn_features_scale.h>
+#include <neuton_user_model.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define AXES_NUM            (6U)
+#define WINDOWS_NUM         (50U)
+#define MODELS_NUM          (3U)
+#define FEATURES_MAX        (64U)
+#define OUTPUTS_MAX         (16U)
+
+//////////////////////////////////////////////////////////////////////////////
+
+static neuton_nn_runtime_t      runtime_;
+static neuton_nn_dsp_pipeline_t shared_dsp_;
+static neuton_i32_t             shared_features_[FEATURES_MAX];
+static neuton_u16_t             features_maps_[MODELS_NUM][FEATURES_MAX];
+static neuton_nn_t*             p_models_[MODELS_NUM];
+static void*                    p_windows_[MODELS_NUM];
+static neuton_i32_t             features_[FEATURES_MAX];
+static neuton_f32_t             outputs_[OUTPUTS_MAX];
+static uint32_t                 random_;
+static uint32_t                 tick_;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Sine of the random frequency and amplitude on each axis, changed every 50 samples */
+static void trace_sample_(neuton_i16_t* p_sample)
+{
+    static float freq[AXES_NUM];
+    static float amplitude[AXES_NUM];
+
+    if ((tick_ % 50U) == 0)
+    {
+        for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+        {
+            freq[axis]      = 0.2f + 8.0f * test_random_unit(&random_);
+            amplitude[axis] = 20000.0f * test_random_unit(&random_);
+        }
+    }
+
+    for (uint32_t axis = 0; axis < AXES_NUM; axis++)
+    {
+        const float t = (float)tick_ / 100.0f;
+
+        p_sample[axis] = (neuton_i16_t)(amplitude[axis] * sinf(2.0f * 3.14159265f * freq[axis] * t + (float)axis));
+    }
+
+    tick_++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Shared DSP pipeline of the models with the same features: masks and time-domain pipeline
+ * of the reference model, extracted to the 32-bit features cache
+ */
+static void make_shared_dsp_(void)
+{
+    const neuton_nn_dsp_feature_extraction_t* p_ref = &reference_user_model()->p_dsp->features;
+
+    const neuton_nn_dsp_pipeline_t dsp = {
+        .features = {
+            .extracted_memory.p_i32 = shared_features_,
+            .overall_num            = p_ref->overall_num,
+            .masks_num              = p_ref->masks_num,
+            .p_masks                = p_ref->p_masks,
+            .p_timedomain_pipeline  = p_ref->p_timedomain_pipeline,
+            .p_freqdomain_pipeline  = NULL,
+        },
+    };
+
+    zassert_true(p_ref->overall_num <= FEATURES_MAX);
+
+    /* Pipeline has constant members, so it is taken by memory */
+    memcpy(&shared_dsp_, &dsp, sizeof(dsp));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void before_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    random_ = 1;
+    tick_   = 0;
+
+    p_models_[0] = neuton_nn_user_model();
+    p_models_[1] = fused_user_model();
+    p_models_[2] = q8w_user_model();
+
+    make_shared_dsp_();
+
+    memset(&runtime_, 0, sizeof(runtime_));
+    runtime_.p_shared_dsp = &shared_dsp_;
+
+    for (uint32_t m = 0; m < MODELS_NUM; m++)
+    {
+        p_windows_[m] = p_models_[m]->input.window_memory.p_void;
+
+        zassert_equal(neuton_nn_runtime_register(&runtime_, p_models_[m], features_maps_[m], NULL),
+                      NEUTON_STATUS_SUCCESS);
+    }
+
+    zassert_equal(neuton_nn_runtime_setup(&runtime_), NEUTON_STATUS_SUCCESS);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Input windows are given back, the models are shared with the other suites */
+static void after_(void* p_fixture)
+{
+    ARG_UNUSED(p_fixture);
+
+    for (uint32_t m = 0; m < MODELS_NUM; m++)
+        p_models_[m]->input.window_memory.p_void = p_windows_[m];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Features and outputs of each model after the runtime inference are compared with the ones of
+ * the model own features processing and inference on the shared window
+ */
+ZTEST(neuton_nn_runtime, test_features_vs_single_model)
+{
+    neuton_i16_t sample[AXES_NUM];
+    uint32_t     windows = 0;
+
+    while (windows < WINDOWS_NUM)
+    {
+        trace_sample_(sample);
+
+        if (neuton_nn_runtime_feed_inputs(&runtime_, sample, AXES_NUM) != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_equal(neuton_nn_runtime_run_inference(&runtime_), NEUTON_STATUS_SUCCESS);
+
+        for (uint32_t m = 0; m < MODELS_NUM; m++)
+        {
+            neuton_nn_t*       p_nn        = p_models_[m];
+            const bool         is_unscaled = neuton_nn_features_is_dsp_i16_unscaled(p_nn->interfaces.process_features);
+            const neuton_u16_t outputs_num = p_nn->model.output.num;
+            const neuton_u16_t predicted   = p_nn->decoded_output.classif.predicted_class;
+
+            /* Fused scaling model takes the unscaled features, the others are scaled to 16 bits in place */
+            const neuton_sz_t features_size = p_nn->p_dsp->features.overall_num *
+                                              (is_unscaled ? sizeof(neuton_i32_t) : sizeof(neuton_u16_t));
+
+            zassert_true(outputs_num <= OUTPUTS_MAX);
+
+            memcpy(features_, p_nn->p_dsp->features.extracted_memory.p_void, features_size);
+            memcpy(outputs_, p_nn->model.output.memory.p_f32, outputs_num * sizeof(neuton_f32_t));
+
+            zassert_equal(p_nn->interfaces.process_features(&p_nn->input, p_nn->p_dsp), NEUTON_STATUS_SUCCESS);
+            zassert_mem_equal(p_nn->p_dsp->features.extracted_memory.p_void, features_, features_size,
+                              "features of model %u, window %u", m, windows);
+
+            p_nn->interfaces.run_inference(p_nn);
+            p_nn->interfaces.propagate_outputs(&p_nn->model);
+            p_nn->interfaces.decode_outputs(&p_nn->model.output, &p_nn->decoded_output);
+
+            zassert_mem_equal(p_nn->model.output.memory.p_f32, outputs_, outputs_num * sizeof(neuton_f32_t),
+                              "outputs of model %u, window %u", m, windows);
+            zassert_equal(p_nn->decoded_output.classif.predicted_class, predicted, "model %u, window %u", m,
+                          windows);
+        }
+
+        windows++;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/** Disabled model keeps the outputs of the previous window */
+ZTEST(neuton_nn_runtime, test_disabled_model)
+{
+    neuton_nn_t* p_nn = p_models_[1];
+    neuton_i16_t sample[AXES_NUM];
+    uint32_t     windows = 0;
+
+    zassert_equal(neuton_nn_runtime_enable(&runtime_, MODELS_NUM, false), NEUTON_STATUS_INVALID_ARGUMENT);
+    zassert_equal(neuton_nn_runtime_enable(&runtime_, 1, false), NEUTON_STATUS_SUCCESS);
+
+    memset(p_nn->model.output.memory.p_f32, 0, p_nn->model.output.num * sizeof(neuton_f32_t));
+    memset(outputs_, 0, sizeof(outputs_));
+
+    while (windows < WINDOWS_NUM)
+    {
+        trace_sample_(sample);
+
+        if (neuton_nn_runtime_feed_inputs(&runtime_, sample, AXES_NUM) != NEUTON_STATUS_SUCCESS)
+            continue;
+
+        zassert_equal(neuton_nn_runtime_run_inference(&runtime_), NEUTON_STATUS_SUCCESS);
+        zassert_mem_equal(p_nn->model.output.memory.p_f32, outputs_, p_nn->model.output.num * sizeof(neuton_f32_t),
+                          "window %u", windows);
+
+        windows++;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ZTEST_SUITE(neuton_nn_runtime, NULL, NULL, before_, after_, NULL);